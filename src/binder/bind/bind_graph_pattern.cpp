@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/path_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression_visitor.h"
@@ -11,6 +12,7 @@
 #include "common/exception/binder.h"
 #include "common/keyword/rdf_keyword.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "function/cast/functions/cast_from_string_functions.h"
 
 using namespace kuzu::common;
@@ -385,9 +387,23 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     bindRecursiveRelProjectionList(relProjectionList, relFields);
     auto relExtraInfo = std::make_unique<StructTypeInfo>(std::move(relFields));
     rel->setExtraTypeInfo(std::move(relExtraInfo));
-    // Bind predicates in {}, e.g. [e* {date=1999-01-01}]
+    // Bind predicates in {}, e.g. [e* {date=1999-01-01}]. The reserved key _WEIGHT names the rel
+    // property whose values are the weights of a weighted shortest path instead, e.g.
+    // [e* SHORTEST {_WEIGHT: 'distance'}].
     std::shared_ptr<Expression> relPredicate;
+    std::shared_ptr<Expression> weightExpression;
     for (auto& [propertyName, rhs] : relPattern.getPropertyKeyVals()) {
+        if (StringUtils::caseInsensitiveEquals(propertyName, InternalKeyword::WEIGHT)) {
+            auto weightPropertyName = expressionBinder.bindExpression(*rhs);
+            ExpressionUtil::validateExpressionType(*weightPropertyName, ExpressionType::LITERAL);
+            ExpressionUtil::validateDataType(*weightPropertyName, LogicalTypeID::STRING);
+            weightExpression = bindWeightExpression(*rel,
+                weightPropertyName->constPtrCast<LiteralExpression>()
+                    ->getValue()
+                    ->getValue<std::string>(),
+                relPattern.getVariableName());
+            continue;
+        }
         auto boundLhs = expressionBinder.bindNodeOrRelPropertyExpression(*rel, propertyName);
         auto boundRhs = expressionBinder.bindExpression(*rhs);
         boundRhs = expressionBinder.implicitCastIfNecessary(boundRhs, boundLhs->dataType);
@@ -417,6 +433,16 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
             }
         }
     }
+    auto relType = relPattern.getRelType();
+    if (weightExpression != nullptr) {
+        if (relType != QueryRelType::SHORTEST) {
+            throw BinderException(
+                stringFormat("Cannot give weights to recursive pattern {}. Weights can only be "
+                             "given to SHORTEST patterns.",
+                    relPattern.getVariableName()));
+        }
+        relType = QueryRelType::WEIGHTED_SHORTEST;
+    }
     auto nodePredicateExecutionFlag = expressionBinder.createVariableExpression(
         LogicalType{LogicalTypeID::BOOL}, std::string(InternalKeyword::ANONYMOUS));
     if (nodePredicate != nullptr) {
@@ -429,7 +455,7 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     auto queryRel = make_shared<RelExpression>(
         *getRecursiveRelLogicalType(node->getDataType(), rel->getDataType()),
         getUniqueExpressionName(parsedName), parsedName, relTableIDs, std::move(srcNode),
-        std::move(dstNode), directionType, relPattern.getRelType());
+        std::move(dstNode), directionType, relType);
     auto lengthExpression = expressionBinder.createInternalLengthExpression(*queryRel);
     auto [lowerBound, upperBound] = bindVariableLengthRelBound(relPattern);
     auto recursiveInfo = std::make_unique<RecursiveInfo>();
@@ -442,12 +468,24 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     recursiveInfo->nodePredicateExecFlag = std::move(nodePredicateExecutionFlag);
     recursiveInfo->nodePredicate = std::move(nodePredicate);
     recursiveInfo->relPredicate = std::move(relPredicate);
+    recursiveInfo->weightExpression = std::move(weightExpression);
     recursiveInfo->nodeProjectionList = std::move(nodeProjectionList);
     recursiveInfo->relProjectionList = std::move(relProjectionList);
     queryRel->setRecursiveInfo(std::move(recursiveInfo));
     return queryRel;
 }
 
+std::shared_ptr<Expression> Binder::bindWeightExpression(const RelExpression& rel,
+    const std::string& propertyName, const std::string& patternName) {
+    auto weightExpression = expressionBinder.bindNodeOrRelPropertyExpression(rel, propertyName);
+    if (!LogicalTypeUtils::isNumerical(weightExpression->dataType)) {
+        throw BinderException(stringFormat("Cannot use property {} as the weight of shortest path "
+                                           "{}. Expect a numerical property.",
+            propertyName, patternName));
+    }
+    return weightExpression;
+}
+
 std::pair<uint64_t, uint64_t> Binder::bindVariableLengthRelBound(
     const kuzu::parser::RelPattern& relPattern) {
     auto recursiveInfo = relPattern.getRecursiveInfo();
@@ -130,6 +130,13 @@ void Catalog::checkpointInMemory() {
     }
 }
 
+void Catalog::rollbackInMemory() {
+    if (hasUpdates()) {
+        readWriteVersion.reset();
+        resetToNotUpdated();
+    }
+}
+
 table_id_t Catalog::createTableSchema(const BoundCreateTableInfo& info) {
     KU_ASSERT(readWriteVersion != nullptr);
     setToUpdated();
@@ -286,6 +293,39 @@ void Catalog::setTableComment(table_id_t tableID, const std::string& comment) {
     ku_dynamic_cast<CatalogEntry*, TableCatalogEntry*>(tableEntry)->setComment(comment);
 }
 
+void Catalog::createPropertyIndex(table_id_t tableID, property_id_t propertyID) {
+    KU_ASSERT(readWriteVersion != nullptr);
+    setToUpdated();
+    auto tableEntry = readWriteVersion->getTableCatalogEntry(tableID);
+    ku_dynamic_cast<CatalogEntry*, NodeTableCatalogEntry*>(tableEntry)->addPropertyIndex(
+        propertyID);
+}
+
+void Catalog::dropPropertyIndex(table_id_t tableID, property_id_t propertyID) {
+    KU_ASSERT(readWriteVersion != nullptr);
+    setToUpdated();
+    auto tableEntry = readWriteVersion->getTableCatalogEntry(tableID);
+    ku_dynamic_cast<CatalogEntry*, NodeTableCatalogEntry*>(tableEntry)->dropPropertyIndex(
+        propertyID);
+}
+
+void Catalog::createVectorIndex(table_id_t tableID, property_id_t propertyID,
+    const VectorIndexConfig& config) {
+    KU_ASSERT(readWriteVersion != nullptr);
+    setToUpdated();
+    auto tableEntry = readWriteVersion->getTableCatalogEntry(tableID);
+    ku_dynamic_cast<CatalogEntry*, NodeTableCatalogEntry*>(tableEntry)->addVectorIndex(propertyID,
+        config);
+}
+
+void Catalog::dropVectorIndex(table_id_t tableID, property_id_t propertyID) {
+    KU_ASSERT(readWriteVersion != nullptr);
+    setToUpdated();
+    auto tableEntry = readWriteVersion->getTableCatalogEntry(tableID);
+    ku_dynamic_cast<CatalogEntry*, NodeTableCatalogEntry*>(tableEntry)->dropVectorIndex(
+        propertyID);
+}
+
 CatalogContent* Catalog::getVersion(Transaction* tx) const {
     return tx->getType() == TransactionType::READ_ONLY ? readOnlyVersion.get() :
                                                          readWriteVersion.get();
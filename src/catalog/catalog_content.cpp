@@ -184,6 +184,10 @@ void CatalogContent::alterTable(const BoundAlterInfo& info) {
         auto tableEntry =
             ku_dynamic_cast<CatalogEntry*, TableCatalogEntry*>(getTableCatalogEntry(info.tableID));
         tableEntry->dropProperty(dropPropInfo.propertyID);
+        if (tableEntry->getTableType() == TableType::NODE) {
+            ku_dynamic_cast<TableCatalogEntry*, NodeTableCatalogEntry*>(tableEntry)->dropIndexes(
+                dropPropInfo.propertyID);
+        }
     } break;
     default: {
         KU_UNREACHABLE;
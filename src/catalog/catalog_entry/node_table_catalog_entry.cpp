@@ -13,6 +13,13 @@ NodeTableCatalogEntry::NodeTableCatalogEntry(const NodeTableCatalogEntry& other)
     primaryKeyPID = other.primaryKeyPID;
     fwdRelTableIDSet = other.fwdRelTableIDSet;
     bwdRelTableIDSet = other.bwdRelTableIDSet;
+    propertyIndexPIDs = other.propertyIndexPIDs;
+    vectorIndexConfigs = other.vectorIndexConfigs;
+}
+
+void NodeTableCatalogEntry::dropIndexes(common::property_id_t propertyID) {
+    propertyIndexPIDs.erase(propertyID);
+    vectorIndexConfigs.erase(propertyID);
 }
 
 void NodeTableCatalogEntry::serialize(common::Serializer& serializer) const {
@@ -20,6 +27,12 @@ void NodeTableCatalogEntry::serialize(common::Serializer& serializer) const {
     serializer.write(primaryKeyPID);
     serializer.serializeUnorderedSet(fwdRelTableIDSet);
     serializer.serializeUnorderedSet(bwdRelTableIDSet);
+    serializer.serializeUnorderedSet(propertyIndexPIDs);
+    serializer.serializeValue<uint64_t>(vectorIndexConfigs.size());
+    for (auto& [propertyID, config] : vectorIndexConfigs) {
+        serializer.serializeValue(propertyID);
+        config.serialize(serializer);
+    }
 }
 
 std::unique_ptr<NodeTableCatalogEntry> NodeTableCatalogEntry::deserialize(
@@ -27,13 +40,25 @@ std::unique_ptr<NodeTableCatalogEntry> NodeTableCatalogEntry::deserialize(
     common::property_id_t primaryKeyPID;
     common::table_id_set_t fwdRelTableIDSet;
     common::table_id_set_t bwdRelTableIDSet;
+    std::unordered_set<common::property_id_t> propertyIndexPIDs;
+    std::unordered_map<common::property_id_t, VectorIndexConfig> vectorIndexConfigs;
     deserializer.deserializeValue(primaryKeyPID);
     deserializer.deserializeUnorderedSet(fwdRelTableIDSet);
     deserializer.deserializeUnorderedSet(bwdRelTableIDSet);
+    deserializer.deserializeUnorderedSet(propertyIndexPIDs);
+    uint64_t numVectorIndexes;
+    deserializer.deserializeValue(numVectorIndexes);
+    for (auto i = 0u; i < numVectorIndexes; i++) {
+        common::property_id_t propertyID;
+        deserializer.deserializeValue(propertyID);
+        vectorIndexConfigs.emplace(propertyID, VectorIndexConfig::deserialize(deserializer));
+    }
     auto nodeTableEntry = std::make_unique<NodeTableCatalogEntry>();
     nodeTableEntry->primaryKeyPID = primaryKeyPID;
     nodeTableEntry->fwdRelTableIDSet = std::move(fwdRelTableIDSet);
     nodeTableEntry->bwdRelTableIDSet = std::move(bwdRelTableIDSet);
+    nodeTableEntry->propertyIndexPIDs = std::move(propertyIndexPIDs);
+    nodeTableEntry->vectorIndexConfigs = std::move(vectorIndexConfigs);
     return nodeTableEntry;
 }
 
@@ -0,0 +1,55 @@
+#include "catalog/vector_index_config.h"
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/string_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace catalog {
+
+bool VectorDistanceMetricUtils::fromString(const std::string& name, VectorDistanceMetric& metric) {
+    auto upperName = StringUtils::getUpper(name);
+    if (upperName == "L2") {
+        metric = VectorDistanceMetric::L2;
+    } else if (upperName == "COSINE") {
+        metric = VectorDistanceMetric::COSINE;
+    } else if (upperName == "IP") {
+        metric = VectorDistanceMetric::INNER_PRODUCT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string VectorDistanceMetricUtils::toString(VectorDistanceMetric metric) {
+    switch (metric) {
+    case VectorDistanceMetric::L2:
+        return "l2";
+    case VectorDistanceMetric::COSINE:
+        return "cosine";
+    case VectorDistanceMetric::INNER_PRODUCT:
+        return "ip";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void VectorIndexConfig::serialize(Serializer& serializer) const {
+    serializer.serializeValue(metric);
+    serializer.serializeValue(maxDegree);
+    serializer.serializeValue(efConstruction);
+}
+
+VectorIndexConfig VectorIndexConfig::deserialize(Deserializer& deserializer) {
+    VectorIndexConfig config;
+    deserializer.deserializeValue(config.metric);
+    deserializer.deserializeValue(config.maxDegree);
+    deserializer.deserializeValue(config.efConstruction);
+    return config;
+}
+
+} // namespace catalog
+} // namespace kuzu
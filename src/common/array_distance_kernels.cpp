@@ -0,0 +1,279 @@
+#include "common/array_distance_kernels.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace kuzu {
+namespace common {
+
+namespace {
+
+template<typename T, bool SQUARED_DISTANCE>
+T sumScalar(const T* left, const T* right, uint64_t size) {
+    T result = 0;
+    for (auto i = 0u; i < size; i++) {
+        if constexpr (SQUARED_DISTANCE) {
+            auto diff = left[i] - right[i];
+            result += diff * diff;
+        } else {
+            result += left[i] * right[i];
+        }
+    }
+    return result;
+}
+
+#ifdef KUZU_X86_SIMD
+#define KUZU_AVX2_TARGET __attribute__((target("avx2,fma")))
+#define KUZU_AVX512_TARGET __attribute__((target("avx512f")))
+
+// Operations on registers of FLOAT or DOUBLE lanes. The last partial register of an array is read
+// with a masked load, which doesn't read the masked out elements.
+template<typename T>
+struct AVX2Ops;
+
+template<>
+struct AVX2Ops<float> {
+    using register_t = __m256;
+    static constexpr uint64_t NUM_LANES = 8;
+
+    KUZU_AVX2_TARGET static inline register_t zero() { return _mm256_setzero_ps(); }
+    KUZU_AVX2_TARGET static inline register_t load(const float* values) {
+        return _mm256_loadu_ps(values);
+    }
+    KUZU_AVX2_TARGET static inline register_t load(const float* values, uint64_t numValues) {
+        auto mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(numValues),
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        return _mm256_maskload_ps(values, mask);
+    }
+    KUZU_AVX2_TARGET static inline register_t add(register_t a, register_t b) {
+        return _mm256_add_ps(a, b);
+    }
+    KUZU_AVX2_TARGET static inline register_t sub(register_t a, register_t b) {
+        return _mm256_sub_ps(a, b);
+    }
+    KUZU_AVX2_TARGET static inline register_t fmadd(register_t a, register_t b, register_t c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+    KUZU_AVX2_TARGET static inline float reduce(register_t a) {
+        auto sum = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+        return _mm_cvtss_f32(sum);
+    }
+};
+
+template<>
+struct AVX2Ops<double> {
+    using register_t = __m256d;
+    static constexpr uint64_t NUM_LANES = 4;
+
+    KUZU_AVX2_TARGET static inline register_t zero() { return _mm256_setzero_pd(); }
+    KUZU_AVX2_TARGET static inline register_t load(const double* values) {
+        return _mm256_loadu_pd(values);
+    }
+    KUZU_AVX2_TARGET static inline register_t load(const double* values, uint64_t numValues) {
+        auto mask =
+            _mm256_cmpgt_epi64(_mm256_set1_epi64x(numValues), _mm256_setr_epi64x(0, 1, 2, 3));
+        return _mm256_maskload_pd(values, mask);
+    }
+    KUZU_AVX2_TARGET static inline register_t add(register_t a, register_t b) {
+        return _mm256_add_pd(a, b);
+    }
+    KUZU_AVX2_TARGET static inline register_t sub(register_t a, register_t b) {
+        return _mm256_sub_pd(a, b);
+    }
+    KUZU_AVX2_TARGET static inline register_t fmadd(register_t a, register_t b, register_t c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+    KUZU_AVX2_TARGET static inline double reduce(register_t a) {
+        auto sum = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+};
+
+template<typename T>
+struct AVX512Ops;
+
+template<>
+struct AVX512Ops<float> {
+    using register_t = __m512;
+    static constexpr uint64_t NUM_LANES = 16;
+
+    KUZU_AVX512_TARGET static inline register_t zero() { return _mm512_setzero_ps(); }
+    KUZU_AVX512_TARGET static inline register_t load(const float* values) {
+        return _mm512_loadu_ps(values);
+    }
+    KUZU_AVX512_TARGET static inline register_t load(const float* values, uint64_t numValues) {
+        return _mm512_maskz_loadu_ps(((__mmask16)1 << numValues) - 1, values);
+    }
+    KUZU_AVX512_TARGET static inline register_t add(register_t a, register_t b) {
+        return _mm512_add_ps(a, b);
+    }
+    KUZU_AVX512_TARGET static inline register_t sub(register_t a, register_t b) {
+        return _mm512_sub_ps(a, b);
+    }
+    KUZU_AVX512_TARGET static inline register_t fmadd(register_t a, register_t b, register_t c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+    // Lanes go through memory, since GCC 12 warns about the uninitialized operands of the
+    // AVX-512 shuffles.
+    KUZU_AVX512_TARGET static inline float reduce(register_t a) {
+        float lanes[NUM_LANES];
+        _mm512_storeu_ps(lanes, a);
+        auto half = _mm256_add_ps(_mm256_loadu_ps(lanes), _mm256_loadu_ps(lanes + NUM_LANES / 2));
+        auto sum = _mm_add_ps(_mm256_castps256_ps128(half), _mm256_extractf128_ps(half, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        return _mm_cvtss_f32(_mm_add_ss(sum, _mm_movehdup_ps(sum)));
+    }
+};
+
+template<>
+struct AVX512Ops<double> {
+    using register_t = __m512d;
+    static constexpr uint64_t NUM_LANES = 8;
+
+    KUZU_AVX512_TARGET static inline register_t zero() { return _mm512_setzero_pd(); }
+    KUZU_AVX512_TARGET static inline register_t load(const double* values) {
+        return _mm512_loadu_pd(values);
+    }
+    KUZU_AVX512_TARGET static inline register_t load(const double* values, uint64_t numValues) {
+        return _mm512_maskz_loadu_pd(((__mmask8)1 << numValues) - 1, values);
+    }
+    KUZU_AVX512_TARGET static inline register_t add(register_t a, register_t b) {
+        return _mm512_add_pd(a, b);
+    }
+    KUZU_AVX512_TARGET static inline register_t sub(register_t a, register_t b) {
+        return _mm512_sub_pd(a, b);
+    }
+    KUZU_AVX512_TARGET static inline register_t fmadd(register_t a, register_t b, register_t c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+    KUZU_AVX512_TARGET static inline double reduce(register_t a) {
+        double lanes[NUM_LANES];
+        _mm512_storeu_pd(lanes, a);
+        auto half = _mm256_add_pd(_mm256_loadu_pd(lanes), _mm256_loadu_pd(lanes + NUM_LANES / 2));
+        auto sum = _mm_add_pd(_mm256_castpd256_pd128(half), _mm256_extractf128_pd(half, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+};
+
+// Adds the squared differences or the products of the lanes of l and r to sum.
+template<typename OPS, bool SQUARED_DISTANCE>
+KUZU_AVX2_TARGET static inline typename OPS::register_t accumulateAVX2(typename OPS::register_t l,
+    typename OPS::register_t r, typename OPS::register_t sum) {
+    if constexpr (SQUARED_DISTANCE) {
+        auto diff = OPS::sub(l, r);
+        return OPS::fmadd(diff, diff, sum);
+    } else {
+        return OPS::fmadd(l, r, sum);
+    }
+}
+
+template<typename OPS, bool SQUARED_DISTANCE>
+KUZU_AVX512_TARGET static inline typename OPS::register_t accumulateAVX512(
+    typename OPS::register_t l, typename OPS::register_t r, typename OPS::register_t sum) {
+    if constexpr (SQUARED_DISTANCE) {
+        auto diff = OPS::sub(l, r);
+        return OPS::fmadd(diff, diff, sum);
+    } else {
+        return OPS::fmadd(l, r, sum);
+    }
+}
+
+// Sums are accumulated into two registers, so that consecutive FMAs don't depend on each other.
+// Masked out lanes of the last register are zero, which adds nothing to either sum.
+template<typename T, bool SQUARED_DISTANCE>
+KUZU_AVX2_TARGET static T sumAVX2(const T* left, const T* right, uint64_t size) {
+    using OPS = AVX2Ops<T>;
+    static constexpr uint64_t NUM_LANES = OPS::NUM_LANES;
+    auto sum0 = OPS::zero(), sum1 = OPS::zero();
+    uint64_t i = 0;
+    for (; i + 2 * NUM_LANES <= size; i += 2 * NUM_LANES) {
+        sum0 = accumulateAVX2<OPS, SQUARED_DISTANCE>(OPS::load(left + i), OPS::load(right + i),
+            sum0);
+        sum1 = accumulateAVX2<OPS, SQUARED_DISTANCE>(OPS::load(left + i + NUM_LANES),
+            OPS::load(right + i + NUM_LANES), sum1);
+    }
+    if (i + NUM_LANES <= size) {
+        sum0 = accumulateAVX2<OPS, SQUARED_DISTANCE>(OPS::load(left + i), OPS::load(right + i),
+            sum0);
+        i += NUM_LANES;
+    }
+    if (i < size) {
+        sum1 = accumulateAVX2<OPS, SQUARED_DISTANCE>(OPS::load(left + i, size - i),
+            OPS::load(right + i, size - i), sum1);
+    }
+    return OPS::reduce(OPS::add(sum0, sum1));
+}
+
+template<typename T, bool SQUARED_DISTANCE>
+KUZU_AVX512_TARGET static T sumAVX512(const T* left, const T* right, uint64_t size) {
+    using OPS = AVX512Ops<T>;
+    static constexpr uint64_t NUM_LANES = OPS::NUM_LANES;
+    auto sum0 = OPS::zero(), sum1 = OPS::zero();
+    uint64_t i = 0;
+    for (; i + 2 * NUM_LANES <= size; i += 2 * NUM_LANES) {
+        sum0 = accumulateAVX512<OPS, SQUARED_DISTANCE>(OPS::load(left + i), OPS::load(right + i),
+            sum0);
+        sum1 = accumulateAVX512<OPS, SQUARED_DISTANCE>(OPS::load(left + i + NUM_LANES),
+            OPS::load(right + i + NUM_LANES), sum1);
+    }
+    if (i + NUM_LANES <= size) {
+        sum0 = accumulateAVX512<OPS, SQUARED_DISTANCE>(OPS::load(left + i), OPS::load(right + i),
+            sum0);
+        i += NUM_LANES;
+    }
+    if (i < size) {
+        sum1 = accumulateAVX512<OPS, SQUARED_DISTANCE>(OPS::load(left + i, size - i),
+            OPS::load(right + i, size - i), sum1);
+    }
+    return OPS::reduce(OPS::add(sum0, sum1));
+}
+#endif
+
+template<typename T>
+struct SumKernels {
+    T (*innerProduct)(const T*, const T*, uint64_t) = sumScalar<T, false>;
+    T (*squaredDistance)(const T*, const T*, uint64_t) = sumScalar<T, true>;
+
+    static SumKernels select() {
+#ifdef KUZU_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SumKernels{sumAVX512<T, false>, sumAVX512<T, true>};
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SumKernels{sumAVX2<T, false>, sumAVX2<T, true>};
+        }
+#endif
+        return SumKernels{};
+    }
+};
+
+const SumKernels<float> floatKernels = SumKernels<float>::select();
+const SumKernels<double> doubleKernels = SumKernels<double>::select();
+
+} // namespace
+
+float ArrayDistanceKernels::innerProduct(const float* left, const float* right, uint64_t size) {
+    return floatKernels.innerProduct(left, right, size);
+}
+
+double ArrayDistanceKernels::innerProduct(const double* left, const double* right,
+    uint64_t size) {
+    return doubleKernels.innerProduct(left, right, size);
+}
+
+float ArrayDistanceKernels::squaredDistance(const float* left, const float* right, uint64_t size) {
+    return floatKernels.squaredDistance(left, right, size);
+}
+
+double ArrayDistanceKernels::squaredDistance(const double* left, const double* right,
+    uint64_t size) {
+    return doubleKernels.squaredDistance(left, right, size);
+}
+
+} // namespace common
+} // namespace kuzu
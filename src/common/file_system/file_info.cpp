@@ -23,6 +23,10 @@ int64_t FileInfo::readFile(void* buf, size_t nbyte) {
     return fileSystem->readFile(*this, buf, nbyte);
 }
 
+void FileInfo::prefetch(uint64_t position, uint64_t numBytes) {
+    fileSystem->prefetch(*this, position, numBytes);
+}
+
 void FileInfo::writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset) {
     fileSystem->writeFile(*this, buffer, numBytes, offset);
 }
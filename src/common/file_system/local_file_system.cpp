@@ -259,6 +259,16 @@ int64_t LocalFileSystem::readFile(FileInfo& fileInfo, void* buf, size_t nbyte) c
 #endif
 }
 
+void LocalFileSystem::prefetch([[maybe_unused]] FileInfo& fileInfo,
+    [[maybe_unused]] uint64_t position, [[maybe_unused]] uint64_t numBytes) const {
+#if defined(__linux__)
+    auto& localFileInfo = ku_dynamic_cast<const FileInfo&, const LocalFileInfo&>(fileInfo);
+    // The kernel starts reading the range into the page cache and returns immediately. Failures
+    // only mean that the range is not read ahead, so they are ignored.
+    posix_fadvise(localFileInfo.fd, position, numBytes, POSIX_FADV_WILLNEED);
+#endif
+}
+
 void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
     uint64_t offset) const {
     auto& localFileInfo = ku_dynamic_cast<FileInfo&, LocalFileInfo&>(fileInfo);
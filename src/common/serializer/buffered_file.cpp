@@ -67,6 +67,16 @@ bool BufferedFileReader::finished() {
     return bufferOffset >= bufferSize && fileSize <= fileOffset;
 }
 
+void BufferedFileReader::seek(uint64_t offset) {
+    KU_ASSERT(offset <= fileSize);
+    fileOffset = offset;
+    bufferOffset = 0;
+    bufferSize = 0;
+    if (fileOffset < fileSize) {
+        readNextPage();
+    }
+}
+
 void BufferedFileReader::readNextPage() {
     bufferSize = std::min(fileSize - fileOffset, BUFFER_SIZE);
     if (bufferSize == 0) {
@@ -1,3 +1,4 @@
+#include "common/array_distance_kernels.h"
 #include "common/exception/binder.h"
 #include "function/array/functions/array_cosine_similarity.h"
 #include "function/array/functions/array_cross_product.h"
@@ -113,11 +114,53 @@ static LogicalType validateArrayFunctionParameters(const LogicalType& leftType,
             functionName));
 }
 
+// Computes the function between each array of an unflat vector and the single array of a flat
+// one, e.g., a query vector, whose squared norm is only computed once. Array functions are
+// symmetric, so the flat array may be either argument.
+template<typename OPERATION, typename RESULT>
+static void executeWithConstantArray(ValueVector& constantVector, ValueVector& arrayVector,
+    ValueVector& result) {
+    auto constantPos = constantVector.state->selVector->selectedPositions[0];
+    if (constantVector.isNull(constantPos)) {
+        result.setAllNull();
+        return;
+    }
+    auto constantEntry = constantVector.getValue<list_entry_t>(constantPos);
+    auto constantElements = (RESULT*)ListVector::getListValues(&constantVector, constantEntry);
+    auto constantSquaredNorm = ArrayDistanceKernels::innerProduct(constantElements,
+        constantElements, constantEntry.size);
+    auto& selVector = *arrayVector.state->selVector;
+    for (auto i = 0u; i < selVector.selectedSize; i++) {
+        auto pos = selVector.selectedPositions[i];
+        result.setNull(pos, arrayVector.isNull(pos));
+        if (!result.isNull(pos)) {
+            auto entry = arrayVector.getValue<list_entry_t>(pos);
+            result.setValue<RESULT>(pos,
+                OPERATION::compute((RESULT*)ListVector::getListValues(&arrayVector, entry),
+                    constantElements, entry.size, constantSquaredNorm));
+        }
+    }
+}
+
+template<typename OPERATION, typename RESULT>
+static void executeArrayFunction(const std::vector<std::shared_ptr<ValueVector>>& params,
+    ValueVector& result, void* /*dataPtr*/ = nullptr) {
+    KU_ASSERT(params.size() == 2);
+    auto& left = *params[0];
+    auto& right = *params[1];
+    if (left.state->isFlat() && !right.state->isFlat()) {
+        executeWithConstantArray<OPERATION, RESULT>(left, right, result);
+    } else if (!left.state->isFlat() && right.state->isFlat()) {
+        executeWithConstantArray<OPERATION, RESULT>(right, left, result);
+    } else {
+        BinaryFunctionExecutor::executeListStruct<list_entry_t, list_entry_t, RESULT, OPERATION>(
+            left, right, result);
+    }
+}
+
 template<typename OPERATION, typename RESULT>
 static scalar_func_exec_t getBinaryArrayExecFuncSwitchResultType() {
-    auto execFunc =
-        ScalarFunction::BinaryExecListStructFunction<list_entry_t, list_entry_t, RESULT, OPERATION>;
-    return execFunc;
+    return executeArrayFunction<OPERATION, RESULT>;
 }
 
 template<typename OPERATION>
@@ -18,6 +18,7 @@
 #include "function/schema/vector_node_rel_functions.h"
 #include "function/string/vector_string_functions.h"
 #include "function/struct/vector_struct_functions.h"
+#include "function/table/algorithm_functions.h"
 #include "function/table/call_functions.h"
 #include "function/timestamp/vector_timestamp_functions.h"
 #include "function/union/vector_union_functions.h"
@@ -197,7 +198,15 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(CurrentSettingFunction), TABLE_FUNCTION(DBVersionFunction),
         TABLE_FUNCTION(ShowTablesFunction), TABLE_FUNCTION(TableInfoFunction),
         TABLE_FUNCTION(ShowConnectionFunction), TABLE_FUNCTION(StorageInfoFunction),
-        TABLE_FUNCTION(ShowAttachedDatabasesFunction),
+        TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(CreatePropertyIndexFunction),
+        TABLE_FUNCTION(DropPropertyIndexFunction), TABLE_FUNCTION(CreateVectorIndexFunction),
+        TABLE_FUNCTION(DropVectorIndexFunction), TABLE_FUNCTION(QueryVectorIndexFunction),
+
+        // Graph algorithm functions
+        TABLE_FUNCTION(PageRankFunction), TABLE_FUNCTION(WeaklyConnectedComponentsFunction),
+        TABLE_FUNCTION(StronglyConnectedComponentsFunction),
+        TABLE_FUNCTION(LabelPropagationFunction), TABLE_FUNCTION(KCoreDecompositionFunction),
+        TABLE_FUNCTION(ProjectGraphFunction), TABLE_FUNCTION(DropProjectedGraphFunction),
 
         // Read functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
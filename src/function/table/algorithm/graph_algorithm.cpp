@@ -0,0 +1,217 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/interrupt.h"
+#include "function/table/algorithm_functions.h"
+#include "main/client_context.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+GraphAlgorithmSharedState::GraphAlgorithmSharedState(ClientContext* context, RelTable* relTable,
+    std::shared_ptr<CSRGraph> graph, bool isLoaded, std::string projectedGraphName,
+    std::unique_ptr<GraphAlgorithm> algorithm)
+    : CallFuncSharedState{graph->getNumNodes()}, graph{std::move(graph)},
+      algorithm{std::move(algorithm)}, context{context}, relTable{relTable},
+      projectedGraphName{std::move(projectedGraphName)}, isLoading{true}, numTasks{0},
+      nextTaskIdx{0}, numTasksFinished{0}, finished{false}, aborted{false} {
+    // A cached graph skips the loading round.
+    startRound(isLoaded ? 0 : this->graph->getNumNodeGroups());
+}
+
+bool GraphAlgorithmSharedState::compute() {
+    std::unique_lock lck{roundMtx};
+    while (!finished) {
+        if (nextTaskIdx == numTasks) {
+            cv.wait(lck, [&] { return finished || nextTaskIdx < numTasks; });
+            continue;
+        }
+        auto taskIdx = nextTaskIdx++;
+        lck.unlock();
+        try {
+            if (context->interrupted()) {
+                throw InterruptException{};
+            }
+            runTask(taskIdx);
+        } catch (...) {
+            lck.lock();
+            aborted = true;
+            finished = true;
+            cv.notify_all();
+            throw;
+        }
+        lck.lock();
+        if (!finished && ++numTasksFinished == numTasks) {
+            finishRound();
+            cv.notify_all();
+        }
+    }
+    return !aborted;
+}
+
+void GraphAlgorithmSharedState::runTask(uint64_t taskIdx) {
+    if (isLoading) {
+        graph->loadNodeGroup(context->getTx(), relTable, taskIdx);
+        return;
+    }
+    auto startOffset = taskIdx * GraphAlgorithm::MORSEL_SIZE;
+    auto endOffset = std::min(startOffset + GraphAlgorithm::MORSEL_SIZE, graph->getNumNodes());
+    algorithm->compute(*graph, startOffset, endOffset);
+}
+
+void GraphAlgorithmSharedState::finishRound() {
+    if (isLoading) {
+        isLoading = false;
+        if (!projectedGraphName.empty() && context->getTx()->isReadOnly()) {
+            context->getStorageManager()->getCSRGraphCache()->cacheGraph(projectedGraphName,
+                graph);
+        }
+        algorithm->init(*graph);
+    } else if (!algorithm->finalizeRound(*graph)) {
+        finished = true;
+        return;
+    }
+    startRound(
+        (graph->getNumNodes() + GraphAlgorithm::MORSEL_SIZE - 1) / GraphAlgorithm::MORSEL_SIZE);
+}
+
+void GraphAlgorithmSharedState::startRound(uint64_t numTasks_) {
+    numTasks = numTasks_;
+    nextTaskIdx = 0;
+    numTasksFinished = 0;
+    // Rounds without tasks, i.e., over empty graphs, are finished right away.
+    if (numTasks == 0) {
+        finishRound();
+    }
+}
+
+RelTableCatalogEntry* GraphAlgorithmFunction::bindRelTable(ClientContext* context,
+    const std::string& functionName, const std::string& relTableName) {
+    auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), relTableName)) {
+        throw BinderException{"Table " + relTableName + " does not exist!"};
+    }
+    auto tableID = catalog->getTableID(context->getTx(), relTableName);
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
+    if (tableEntry->getTableType() != TableType::REL) {
+        throw BinderException{stringFormat("Cannot run {} on table {}. Expect a rel table.",
+            functionName, relTableName)};
+    }
+    auto relTableEntry = ku_dynamic_cast<TableCatalogEntry*, RelTableCatalogEntry*>(tableEntry);
+    if (relTableEntry->getDstTableID() != relTableEntry->getSrcTableID()) {
+        throw BinderException{stringFormat("Cannot run {} on rel table {}. Expect the source and "
+                                           "destination node tables of the rel table to be the "
+                                           "same.",
+            functionName, relTableName)};
+    }
+    return relTableEntry;
+}
+
+std::unique_ptr<TableFuncBindData> GraphAlgorithmFunction::bind(ClientContext* context,
+    const std::string& functionName, const std::string& graphName,
+    const std::string& valueColumnName, LogicalType valueColumnType,
+    graph_algorithm_create_t createAlgorithm) {
+    auto cache = context->getStorageManager()->getCSRGraphCache();
+    std::string projectedGraphName;
+    table_id_t tableID;
+    table_id_t nodeTableID;
+    if (cache->containsProjection(graphName)) {
+        projectedGraphName = graphName;
+        auto projection = cache->getProjection(graphName);
+        auto relTableIDs = context->getCatalog()->getRelTableIDs(context->getTx());
+        if (std::find(relTableIDs.begin(), relTableIDs.end(), projection.relTableID) ==
+            relTableIDs.end()) {
+            throw BinderException{stringFormat(
+                "Cannot run {} on projected graph {}, whose rel table has been dropped.",
+                functionName, graphName)};
+        }
+        tableID = projection.relTableID;
+        nodeTableID = projection.nodeTableID;
+    } else {
+        auto relTableEntry = bindRelTable(context, functionName, graphName);
+        tableID = relTableEntry->getTableID();
+        nodeTableID = relTableEntry->getSrcTableID();
+        projectedGraphName = cache->getUnfilteredProjectionName(tableID);
+    }
+    // Graphs are loaded from the committed CSRs of the rel table.
+    auto localStorage = context->getTx()->getLocalStorage();
+    if (localStorage->getLocalTable(tableID) != nullptr ||
+        localStorage->getLocalTable(nodeTableID) != nullptr) {
+        throw BinderException{stringFormat("Cannot run {} on rel table {}, which has uncommitted "
+                                           "changes in the current transaction.",
+            functionName, context->getCatalog()->getTableName(context->getTx(), tableID))};
+    }
+    auto projection = projectedGraphName.empty() ? GraphProjection{tableID, nodeTableID} :
+                                                   cache->getProjection(projectedGraphName);
+    auto relTable =
+        ku_dynamic_cast<Table*, RelTable*>(context->getStorageManager()->getTable(tableID));
+    std::vector<std::string> columnNames = {"node_id", valueColumnName};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::INTERNAL_ID());
+    columnTypes.push_back(std::move(valueColumnType));
+    return std::make_unique<GraphAlgorithmBindData>(std::move(columnTypes),
+        std::move(columnNames), context, relTable, projection, std::move(projectedGraphName),
+        std::move(createAlgorithm));
+}
+
+std::unique_ptr<TableFuncSharedState> GraphAlgorithmFunction::initSharedState(
+    TableFunctionInitInput& input) {
+    auto bindData = input.bindData->constPtrCast<GraphAlgorithmBindData>();
+    auto context = bindData->context;
+    auto transaction = context->getTx();
+    auto cache = context->getStorageManager()->getCSRGraphCache();
+    std::shared_ptr<CSRGraph> graph;
+    // Cached snapshots only hold committed rels, which write transactions may not see as is.
+    if (!bindData->projectedGraphName.empty() && transaction->isReadOnly()) {
+        graph = cache->getCachedGraph(bindData->projectedGraphName);
+    }
+    auto isLoaded = graph != nullptr;
+    if (!isLoaded) {
+        graph = cache->createGraph(transaction, *context->getCatalog(), bindData->projection);
+    }
+    return std::make_unique<GraphAlgorithmSharedState>(context, bindData->relTable,
+        std::move(graph), isLoaded, bindData->projectedGraphName, bindData->createAlgorithm());
+}
+
+offset_t GraphAlgorithmFunction::tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<GraphAlgorithmSharedState>();
+    if (!sharedState->compute()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<GraphAlgorithmBindData>();
+    auto& graph = *sharedState->graph;
+    auto nodeIDVector = output.dataChunk.getValueVector(0).get();
+    auto valueVector = output.dataChunk.getValueVector(1).get();
+    while (true) {
+        auto morsel = sharedState->getMorsel();
+        if (!morsel.hasMoreToOutput()) {
+            return 0;
+        }
+        auto numNodes = 0u;
+        for (auto nodeOffset = morsel.startOffset; nodeOffset < morsel.endOffset; nodeOffset++) {
+            if (graph.isDeleted(nodeOffset)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(numNodes,
+                nodeID_t{nodeOffset, bindData->projection.nodeTableID});
+            sharedState->algorithm->writeResult(nodeOffset, *valueVector, numNodes);
+            numNodes++;
+        }
+        // Morsels of deleted nodes only are skipped, since no output ends the scan.
+        if (numNodes > 0) {
+            return numNodes;
+        }
+    }
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,107 @@
+#include <atomic>
+
+#include "function/table/algorithm_functions.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+/*
+ * Computes the core number of each node, i.e., the largest k such that the node is part of a
+ * subgraph in which every node has at least k rels in either direction. Self loops are ignored.
+ * Core numbers start at the degree of each node, and each round lowers them to the h-index of the
+ * core numbers of their nbrs, i.e., the largest k such that at least k nbrs have a core number of
+ * at least k, until no core number changes. Core numbers only decrease towards the same fixpoint in
+ * whichever order nodes are computed, so they are updated in place, which is only done by the
+ * thread computing the node.
+ */
+class KCoreDecomposition final : public GraphAlgorithm {
+public:
+    KCoreDecomposition() : changed{false} {}
+
+    void init(const CSRGraph& graph) override {
+        coreNumbers = std::make_unique<std::atomic<uint64_t>[]>(graph.getNumNodes());
+        for (auto nodeOffset = 0u; nodeOffset < graph.getNumNodes(); nodeOffset++) {
+            auto degree = 0u;
+            for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, direction)) {
+                    degree += nbrOffset != nodeOffset;
+                }
+            }
+            coreNumbers[nodeOffset].store(degree, std::memory_order_relaxed);
+        }
+    }
+
+    void compute(const CSRGraph& graph, offset_t startOffset, offset_t endOffset) override {
+        auto hasChanged = false;
+        // Number of nbrs by their core numbers, capped at the core number of the node.
+        std::vector<uint64_t> numNbrsPerCoreNumber;
+        for (auto nodeOffset = startOffset; nodeOffset < endOffset; nodeOffset++) {
+            auto coreNumber = getCoreNumber(nodeOffset);
+            if (coreNumber == 0) {
+                continue;
+            }
+            numNbrsPerCoreNumber.assign(coreNumber + 1, 0);
+            for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, direction)) {
+                    if (nbrOffset != nodeOffset) {
+                        numNbrsPerCoreNumber[std::min(getCoreNumber(nbrOffset), coreNumber)]++;
+                    }
+                }
+            }
+            auto newCoreNumber = coreNumber;
+            auto numNbrs = 0u;
+            for (; newCoreNumber > 0; newCoreNumber--) {
+                numNbrs += numNbrsPerCoreNumber[newCoreNumber];
+                if (numNbrs >= newCoreNumber) {
+                    break;
+                }
+            }
+            if (newCoreNumber < coreNumber) {
+                coreNumbers[nodeOffset].store(newCoreNumber, std::memory_order_relaxed);
+                hasChanged = true;
+            }
+        }
+        if (hasChanged) {
+            changed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool finalizeRound(const CSRGraph& /*graph*/) override {
+        return changed.exchange(false, std::memory_order_relaxed);
+    }
+
+    void writeResult(offset_t nodeOffset, ValueVector& vector, sel_t pos) const override {
+        vector.setValue<int64_t>(pos, getCoreNumber(nodeOffset));
+    }
+
+private:
+    inline uint64_t getCoreNumber(offset_t nodeOffset) const {
+        return coreNumbers[nodeOffset].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> coreNumbers;
+    std::atomic<bool> changed;
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    return GraphAlgorithmFunction::bind(context, KCoreDecompositionFunction::name,
+        input->inputs[0].getValue<std::string>(), "k_degree", *LogicalType::INT64(),
+        []() { return std::make_unique<KCoreDecomposition>(); });
+}
+
+function_set KCoreDecompositionFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <unordered_map>
+
+#include "common/exception/binder.h"
+#include "function/table/algorithm_functions.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+/*
+ * Detects communities by label propagation. Each node starts with its own offset as label, and then
+ * takes the most frequent label among itself and its nbrs over rels in both directions in each
+ * round, preferring the smallest label on ties. Counting the own label keeps labels from swapping
+ * back and forth between nbrs. Labels are double buffered, so each round only reads the labels of
+ * the previous one and the result does not depend on the number of threads. Rounds repeat until no
+ * label changes or the maximum number of iterations is reached.
+ */
+class LabelPropagation final : public GraphAlgorithm {
+public:
+    explicit LabelPropagation(uint64_t maxIterations)
+        : maxIterations{maxIterations}, numIterations{0}, changed{false} {}
+
+    void init(const CSRGraph& graph) override {
+        labels.resize(graph.getNumNodes());
+        nextLabels.resize(graph.getNumNodes());
+        for (auto nodeOffset = 0u; nodeOffset < graph.getNumNodes(); nodeOffset++) {
+            labels[nodeOffset] = nodeOffset;
+        }
+    }
+
+    void compute(const CSRGraph& graph, offset_t startOffset, offset_t endOffset) override {
+        auto hasChanged = false;
+        std::unordered_map<offset_t, uint64_t> labelCounts;
+        for (auto nodeOffset = startOffset; nodeOffset < endOffset; nodeOffset++) {
+            labelCounts.clear();
+            labelCounts[labels[nodeOffset]]++;
+            for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, direction)) {
+                    labelCounts[labels[nbrOffset]]++;
+                }
+            }
+            auto label = labels[nodeOffset];
+            uint64_t maxCount = 0;
+            for (auto& [nbrLabel, count] : labelCounts) {
+                if (count > maxCount || (count == maxCount && nbrLabel < label)) {
+                    label = nbrLabel;
+                    maxCount = count;
+                }
+            }
+            nextLabels[nodeOffset] = label;
+            hasChanged |= label != labels[nodeOffset];
+        }
+        if (hasChanged) {
+            changed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool finalizeRound(const CSRGraph& /*graph*/) override {
+        std::swap(labels, nextLabels);
+        numIterations++;
+        return changed.exchange(false, std::memory_order_relaxed) && numIterations < maxIterations;
+    }
+
+    void writeResult(offset_t nodeOffset, ValueVector& vector, sel_t pos) const override {
+        vector.setValue<int64_t>(pos, labels[nodeOffset]);
+    }
+
+private:
+    uint64_t maxIterations;
+    uint64_t numIterations;
+    std::vector<offset_t> labels;
+    std::vector<offset_t> nextLabels;
+    std::atomic<bool> changed;
+};
+
+static constexpr int64_t DEFAULT_MAX_ITERATIONS = 20;
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto maxIterations = DEFAULT_MAX_ITERATIONS;
+    if (input->inputs.size() > 1) {
+        maxIterations = input->inputs[1].getValue<int64_t>();
+    }
+    if (maxIterations <= 0) {
+        throw BinderException{stringFormat("Maximum number of iterations of {} must be positive.",
+            LabelPropagationFunction::name)};
+    }
+    return GraphAlgorithmFunction::bind(context, LabelPropagationFunction::name,
+        input->inputs[0].getValue<std::string>(), "label", *LogicalType::INT64(),
+        [maxIterations]() { return std::make_unique<LabelPropagation>(maxIterations); });
+}
+
+function_set LabelPropagationFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::INT64}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,152 @@
+#include <cmath>
+
+#include "common/exception/binder.h"
+#include "function/table/algorithm_functions.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+/*
+ * Computes PageRank by power iteration. The rank of each node is pulled from the nbrs of its
+ * incoming rels, whose ranks are spread evenly over their outgoing rels. The ranks of nodes without
+ * outgoing rels are spread over all nodes. Ranks are double buffered, so each round only reads the
+ * ranks of the previous one and the result does not depend on the number of threads.
+ */
+class PageRank final : public GraphAlgorithm {
+    static constexpr double TOLERANCE = 1e-7;
+
+public:
+    PageRank(double dampingFactor, uint64_t maxIterations)
+        : dampingFactor{dampingFactor}, maxIterations{maxIterations}, numIterations{0},
+          danglingRankSum{0} {}
+
+    void init(const CSRGraph& graph) override {
+        auto numNodes = graph.getNumNodes();
+        auto initialRank = 1.0 / graph.getNumActiveNodes();
+        ranks.resize(numNodes, 0);
+        nextRanks.resize(numNodes, 0);
+        contributions.resize(numNodes, 0);
+        nextContributions.resize(numNodes, 0);
+        auto numMorsels = (numNodes + MORSEL_SIZE - 1) / MORSEL_SIZE;
+        danglingRankSums.resize(numMorsels, 0);
+        rankDiffs.resize(numMorsels, 0);
+        for (auto nodeOffset = 0u; nodeOffset < numNodes; nodeOffset++) {
+            if (graph.isDeleted(nodeOffset)) {
+                continue;
+            }
+            ranks[nodeOffset] = initialRank;
+            auto numOutRels = graph.getNumNbrs(nodeOffset, RelDataDirection::FWD);
+            if (numOutRels == 0) {
+                danglingRankSum += initialRank;
+            } else {
+                contributions[nodeOffset] = initialRank / numOutRels;
+            }
+        }
+    }
+
+    void compute(const CSRGraph& graph, offset_t startOffset, offset_t endOffset) override {
+        auto numNodes = (double)graph.getNumActiveNodes();
+        auto baseRank = (1 - dampingFactor) / numNodes + dampingFactor * danglingRankSum / numNodes;
+        auto danglingSum = 0.0;
+        auto diff = 0.0;
+        for (auto nodeOffset = startOffset; nodeOffset < endOffset; nodeOffset++) {
+            if (graph.isDeleted(nodeOffset)) {
+                continue;
+            }
+            auto sum = 0.0;
+            for (auto nbrOffset : graph.getNbrs(nodeOffset, RelDataDirection::BWD)) {
+                sum += contributions[nbrOffset];
+            }
+            auto rank = baseRank + dampingFactor * sum;
+            nextRanks[nodeOffset] = rank;
+            diff += std::abs(rank - ranks[nodeOffset]);
+            auto numOutRels = graph.getNumNbrs(nodeOffset, RelDataDirection::FWD);
+            if (numOutRels == 0) {
+                nextContributions[nodeOffset] = 0;
+                danglingSum += rank;
+            } else {
+                nextContributions[nodeOffset] = rank / numOutRels;
+            }
+        }
+        auto morselIdx = startOffset / MORSEL_SIZE;
+        danglingRankSums[morselIdx] = danglingSum;
+        rankDiffs[morselIdx] = diff;
+    }
+
+    bool finalizeRound(const CSRGraph& /*graph*/) override {
+        std::swap(ranks, nextRanks);
+        std::swap(contributions, nextContributions);
+        danglingRankSum = 0;
+        auto diff = 0.0;
+        // Sums are added up in morsel order to keep them deterministic.
+        for (auto i = 0u; i < danglingRankSums.size(); i++) {
+            danglingRankSum += danglingRankSums[i];
+            diff += rankDiffs[i];
+        }
+        numIterations++;
+        return numIterations < maxIterations && diff > TOLERANCE;
+    }
+
+    void writeResult(offset_t nodeOffset, ValueVector& vector, sel_t pos) const override {
+        vector.setValue<double>(pos, ranks[nodeOffset]);
+    }
+
+private:
+    double dampingFactor;
+    uint64_t maxIterations;
+    uint64_t numIterations;
+    std::vector<double> ranks;
+    std::vector<double> nextRanks;
+    // Rank of each node divided by its number of outgoing rels.
+    std::vector<double> contributions;
+    std::vector<double> nextContributions;
+    // Sum of the ranks of nodes without outgoing rels.
+    double danglingRankSum;
+    std::vector<double> danglingRankSums;
+    std::vector<double> rankDiffs;
+};
+
+static constexpr double DEFAULT_DAMPING_FACTOR = 0.85;
+static constexpr int64_t DEFAULT_MAX_ITERATIONS = 20;
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto dampingFactor = DEFAULT_DAMPING_FACTOR;
+    auto maxIterations = DEFAULT_MAX_ITERATIONS;
+    if (input->inputs.size() > 1) {
+        dampingFactor = input->inputs[1].getValue<double>();
+        maxIterations = input->inputs[2].getValue<int64_t>();
+    }
+    if (!(dampingFactor >= 0 && dampingFactor < 1)) {
+        throw BinderException{stringFormat(
+            "Damping factor of {} must be in the range [0, 1).", PageRankFunction::name)};
+    }
+    if (maxIterations <= 0) {
+        throw BinderException{stringFormat("Maximum number of iterations of {} must be positive.",
+            PageRankFunction::name)};
+    }
+    return GraphAlgorithmFunction::bind(context, PageRankFunction::name,
+        input->inputs[0].getValue<std::string>(), "rank", *LogicalType::DOUBLE(),
+        [dampingFactor, maxIterations]() {
+            return std::make_unique<PageRank>(dampingFactor, maxIterations);
+        });
+}
+
+function_set PageRankFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::DOUBLE,
+            LogicalTypeID::INT64}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,158 @@
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/algorithm_functions.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct ProjectGraphBindData final : public CallTableFuncBindData {
+    ClientContext* context;
+    std::string graphName;
+    GraphProjection projection;
+
+    ProjectGraphBindData(std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames,
+        ClientContext* context, std::string graphName, GraphProjection projection)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames),
+              1 /* one row result */},
+          context{context}, graphName{std::move(graphName)}, projection{projection} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ProjectGraphBindData>(columnTypes, columnNames, context, graphName,
+            projection);
+    }
+};
+
+static offset_t projectGraphTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<ProjectGraphBindData>();
+    auto context = bindData->context;
+    auto cache = context->getStorageManager()->getCSRGraphCache();
+    cache->addProjection(bindData->graphName, bindData->projection);
+    std::shared_ptr<CSRGraph> graph;
+    try {
+        graph = cache->getGraph(context->getTx(), *context->getCatalog(), bindData->graphName);
+    } catch (...) {
+        cache->dropProjection(bindData->graphName);
+        throw;
+    }
+    auto& dataChunk = output.dataChunk;
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    dataChunk.getValueVector(0)->setValue<int64_t>(pos, graph->getNumActiveNodes());
+    dataChunk.getValueVector(1)->setValue<int64_t>(pos, graph->getNumRels());
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> projectGraphBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    // Snapshots only hold committed rels, which write transactions may not see as is.
+    if (!context->getTx()->isReadOnly()) {
+        throw BinderException{stringFormat("{} cannot run in a write transaction.",
+            ProjectGraphFunction::name)};
+    }
+    auto graphName = input->inputs[0].getValue<std::string>();
+    if (context->getStorageManager()->getCSRGraphCache()->containsProjection(graphName)) {
+        throw BinderException{stringFormat("Projected graph {} already exists.", graphName)};
+    }
+    auto relTableEntry = GraphAlgorithmFunction::bindRelTable(context, ProjectGraphFunction::name,
+        input->inputs[1].getValue<std::string>());
+    auto projection = GraphProjection{relTableEntry->getTableID(), relTableEntry->getSrcTableID()};
+    if (input->inputs.size() > 2) {
+        auto propertyName = input->inputs[2].getValue<std::string>();
+        if (!relTableEntry->containProperty(propertyName)) {
+            throw BinderException{stringFormat("Rel table {} does not have property {}.",
+                relTableEntry->getName(), propertyName)};
+        }
+        auto propertyID = relTableEntry->getPropertyID(propertyName);
+        auto dataType = relTableEntry->getProperty(propertyID)->getDataType();
+        if (!GraphProjection::isFilterableType(dataType->getLogicalTypeID())) {
+            throw BinderException{stringFormat("Cannot filter projected graph {} on property {} "
+                                               "of type {}. Expect a numeric property.",
+                graphName, propertyName, dataType->toString())};
+        }
+        projection = GraphProjection{relTableEntry->getTableID(), relTableEntry->getSrcTableID(),
+            propertyID, input->inputs[3].getValue<double>(), input->inputs[4].getValue<double>()};
+    }
+    std::vector<std::string> columnNames = {"num_nodes", "num_rels"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::INT64());
+    columnTypes.push_back(*LogicalType::INT64());
+    return std::make_unique<ProjectGraphBindData>(std::move(columnTypes), std::move(columnNames),
+        context, std::move(graphName), projection);
+}
+
+function_set ProjectGraphFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, projectGraphTableFunc,
+        projectGraphBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, projectGraphTableFunc,
+        projectGraphBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING, LogicalTypeID::DOUBLE, LogicalTypeID::DOUBLE}));
+    return functionSet;
+}
+
+struct DropProjectedGraphBindData final : public CallTableFuncBindData {
+    ClientContext* context;
+    std::string graphName;
+
+    DropProjectedGraphBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, ClientContext* context, std::string graphName)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames),
+              1 /* one row result */},
+          context{context}, graphName{std::move(graphName)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropProjectedGraphBindData>(columnTypes, columnNames, context,
+            graphName);
+    }
+};
+
+static offset_t dropProjectedGraphTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<DropProjectedGraphBindData>();
+    bindData->context->getStorageManager()->getCSRGraphCache()->dropProjection(
+        bindData->graphName);
+    auto& dataChunk = output.dataChunk;
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    dataChunk.getValueVector(0)->setValue(pos,
+        stringFormat("Projected graph {} has been dropped.", bindData->graphName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> dropProjectedGraphBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto graphName = input->inputs[0].getValue<std::string>();
+    if (!context->getStorageManager()->getCSRGraphCache()->containsProjection(graphName)) {
+        throw BinderException{stringFormat("Projected graph {} does not exist.", graphName)};
+    }
+    std::vector<std::string> columnNames = {"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::STRING());
+    return std::make_unique<DropProjectedGraphBindData>(std::move(columnTypes),
+        std::move(columnNames), context, std::move(graphName));
+}
+
+function_set DropProjectedGraphFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, dropProjectedGraphTableFunc,
+        dropProjectedGraphBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
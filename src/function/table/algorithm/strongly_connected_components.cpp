@@ -0,0 +1,173 @@
+#include <atomic>
+
+#include "function/table/algorithm_functions.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+/*
+ * Finds strongly connected components by forward-backward coloring. Each iteration first trims
+ * nodes without incoming or without outgoing rels to unassigned nodes, which are components on
+ * their own. Then the smallest offset of the unassigned nodes reaching each unassigned node is
+ * propagated as its color over outgoing rels. A node whose color is its own offset is the smallest
+ * node of its component, which consists of the nodes of the same color reaching it, so the
+ * component is found by propagating the root backwards among these nodes. Iterations repeat until
+ * all nodes are assigned to a component.
+ * Each phase runs in rounds until no node changes, and updates nodes in place, which is only done
+ * by the thread computing the node. The component ID of each node is the smallest offset of its
+ * component regardless of the order in which nodes are computed.
+ */
+class StronglyConnectedComponents final : public GraphAlgorithm {
+    enum class Phase : uint8_t { TRIM = 0, COLOR = 1, BACKWARD = 2 };
+
+public:
+    StronglyConnectedComponents() : phase{Phase::TRIM}, numAssignedNodes{0}, changed{false} {}
+
+    void init(const CSRGraph& graph) override {
+        auto numNodes = graph.getNumNodes();
+        componentIDs = std::make_unique<std::atomic<offset_t>[]>(numNodes);
+        colors = std::make_unique<std::atomic<offset_t>[]>(numNodes);
+        for (auto nodeOffset = 0u; nodeOffset < numNodes; nodeOffset++) {
+            // Deleted nodes are never assigned to a component nor reached over rels.
+            componentIDs[nodeOffset].store(
+                graph.isDeleted(nodeOffset) ? nodeOffset : INVALID_OFFSET,
+                std::memory_order_relaxed);
+        }
+    }
+
+    void compute(const CSRGraph& graph, offset_t startOffset, offset_t endOffset) override {
+        auto hasChanged = false;
+        for (auto nodeOffset = startOffset; nodeOffset < endOffset; nodeOffset++) {
+            if (isAssigned(nodeOffset)) {
+                continue;
+            }
+            switch (phase) {
+            case Phase::TRIM: {
+                if (!hasUnassignedNbr(graph, nodeOffset, RelDataDirection::FWD) ||
+                    !hasUnassignedNbr(graph, nodeOffset, RelDataDirection::BWD)) {
+                    assign(nodeOffset, nodeOffset);
+                    hasChanged = true;
+                }
+            } break;
+            case Phase::COLOR: {
+                auto color = getColor(nodeOffset);
+                auto newColor = color;
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, RelDataDirection::BWD)) {
+                    if (!isAssigned(nbrOffset)) {
+                        newColor = std::min(newColor, getColor(nbrOffset));
+                    }
+                }
+                if (newColor < color) {
+                    colors[nodeOffset].store(newColor, std::memory_order_relaxed);
+                    hasChanged = true;
+                }
+            } break;
+            case Phase::BACKWARD: {
+                auto color = getColor(nodeOffset);
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, RelDataDirection::FWD)) {
+                    if (getComponentID(nbrOffset) == color) {
+                        assign(nodeOffset, color);
+                        hasChanged = true;
+                        break;
+                    }
+                }
+            } break;
+            default:
+                KU_UNREACHABLE;
+            }
+        }
+        if (hasChanged) {
+            changed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool finalizeRound(const CSRGraph& graph) override {
+        if (changed.exchange(false, std::memory_order_relaxed)) {
+            return true;
+        }
+        if (numAssignedNodes.load(std::memory_order_relaxed) == graph.getNumActiveNodes()) {
+            return false;
+        }
+        switch (phase) {
+        case Phase::TRIM: {
+            for (auto nodeOffset = 0u; nodeOffset < graph.getNumNodes(); nodeOffset++) {
+                colors[nodeOffset].store(nodeOffset, std::memory_order_relaxed);
+            }
+            phase = Phase::COLOR;
+        } break;
+        case Phase::COLOR: {
+            for (auto nodeOffset = 0u; nodeOffset < graph.getNumNodes(); nodeOffset++) {
+                if (!isAssigned(nodeOffset) && getColor(nodeOffset) == nodeOffset) {
+                    assign(nodeOffset, nodeOffset);
+                }
+            }
+            phase = Phase::BACKWARD;
+        } break;
+        case Phase::BACKWARD: {
+            phase = Phase::TRIM;
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+        return true;
+    }
+
+    void writeResult(offset_t nodeOffset, ValueVector& vector, sel_t pos) const override {
+        vector.setValue<int64_t>(pos, getComponentID(nodeOffset));
+    }
+
+private:
+    inline offset_t getComponentID(offset_t nodeOffset) const {
+        return componentIDs[nodeOffset].load(std::memory_order_relaxed);
+    }
+    inline bool isAssigned(offset_t nodeOffset) const {
+        return getComponentID(nodeOffset) != INVALID_OFFSET;
+    }
+    inline void assign(offset_t nodeOffset, offset_t componentID) {
+        componentIDs[nodeOffset].store(componentID, std::memory_order_relaxed);
+        numAssignedNodes.fetch_add(1, std::memory_order_relaxed);
+    }
+    inline offset_t getColor(offset_t nodeOffset) const {
+        return colors[nodeOffset].load(std::memory_order_relaxed);
+    }
+
+    // Self loops are ignored.
+    bool hasUnassignedNbr(const CSRGraph& graph, offset_t nodeOffset,
+        RelDataDirection direction) const {
+        for (auto nbrOffset : graph.getNbrs(nodeOffset, direction)) {
+            if (nbrOffset != nodeOffset && !isAssigned(nbrOffset)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    Phase phase;
+    std::unique_ptr<std::atomic<offset_t>[]> componentIDs;
+    std::unique_ptr<std::atomic<offset_t>[]> colors;
+    std::atomic<uint64_t> numAssignedNodes;
+    std::atomic<bool> changed;
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    return GraphAlgorithmFunction::bind(context, StronglyConnectedComponentsFunction::name,
+        input->inputs[0].getValue<std::string>(), "component_id", *LogicalType::INT64(),
+        []() { return std::make_unique<StronglyConnectedComponents>(); });
+}
+
+function_set StronglyConnectedComponentsFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
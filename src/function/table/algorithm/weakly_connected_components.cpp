@@ -0,0 +1,86 @@
+#include <atomic>
+
+#include "function/table/algorithm_functions.h"
+#include "function/table/bind_input.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+/*
+ * Finds weakly connected components by propagating the smallest node offset of each component over
+ * rels in both directions, until no component ID changes. Component IDs are updated in place, so
+ * that changes propagate within a round, and each node additionally jumps to the component ID of
+ * the node its component ID refers to. The component ID of each node is only written by the thread
+ * computing it, and the result is the smallest node offset of each component regardless of the
+ * order in which nodes are computed.
+ */
+class WeaklyConnectedComponents final : public GraphAlgorithm {
+public:
+    WeaklyConnectedComponents() : changed{false} {}
+
+    void init(const CSRGraph& graph) override {
+        componentIDs = std::make_unique<std::atomic<offset_t>[]>(graph.getNumNodes());
+        for (auto nodeOffset = 0u; nodeOffset < graph.getNumNodes(); nodeOffset++) {
+            componentIDs[nodeOffset].store(nodeOffset, std::memory_order_relaxed);
+        }
+    }
+
+    void compute(const CSRGraph& graph, offset_t startOffset, offset_t endOffset) override {
+        auto hasChanged = false;
+        for (auto nodeOffset = startOffset; nodeOffset < endOffset; nodeOffset++) {
+            auto componentID = getComponentID(nodeOffset);
+            auto newComponentID = componentID;
+            for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+                for (auto nbrOffset : graph.getNbrs(nodeOffset, direction)) {
+                    newComponentID = std::min(newComponentID, getComponentID(nbrOffset));
+                }
+            }
+            newComponentID = std::min(newComponentID, getComponentID(newComponentID));
+            if (newComponentID < componentID) {
+                componentIDs[nodeOffset].store(newComponentID, std::memory_order_relaxed);
+                hasChanged = true;
+            }
+        }
+        if (hasChanged) {
+            changed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool finalizeRound(const CSRGraph& /*graph*/) override {
+        return changed.exchange(false, std::memory_order_relaxed);
+    }
+
+    void writeResult(offset_t nodeOffset, ValueVector& vector, sel_t pos) const override {
+        vector.setValue<int64_t>(pos, getComponentID(nodeOffset));
+    }
+
+private:
+    inline offset_t getComponentID(offset_t nodeOffset) const {
+        return componentIDs[nodeOffset].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<std::atomic<offset_t>[]> componentIDs;
+    std::atomic<bool> changed;
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    return GraphAlgorithmFunction::bind(context, WeaklyConnectedComponentsFunction::name,
+        input->inputs[0].getValue<std::string>(), "component_id", *LogicalType::INT64(),
+        []() { return std::make_unique<WeaklyConnectedComponents>(); });
+}
+
+function_set WeaklyConnectedComponentsFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
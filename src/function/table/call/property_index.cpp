@@ -0,0 +1,136 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/index/property_index.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct PropertyIndexBindData final : public CallTableFuncBindData {
+    ClientContext* context;
+    table_id_t tableID;
+    property_id_t propertyID;
+    // <table>.<property>
+    std::string indexName;
+
+    PropertyIndexBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, ClientContext* context, table_id_t tableID,
+        property_id_t propertyID, std::string indexName)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames),
+              1 /* one row result */},
+          context{context}, tableID{tableID}, propertyID{propertyID},
+          indexName{std::move(indexName)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PropertyIndexBindData>(columnTypes, columnNames, context, tableID,
+            propertyID, indexName);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindPropertyIndex(ClientContext* context,
+    TableFuncBindInput* input, const std::string& functionName, bool shouldExist) {
+    auto catalog = context->getCatalog();
+    auto tableName = input->inputs[0].getValue<std::string>();
+    auto propertyName = input->inputs[1].getValue<std::string>();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    auto tableID = catalog->getTableID(context->getTx(), tableName);
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{stringFormat("Cannot run {} on table {}. Expect a node table.",
+            functionName, tableName)};
+    }
+    if (!tableEntry->containProperty(propertyName)) {
+        throw BinderException{stringFormat("Node table {} does not have property {}.", tableName,
+            propertyName)};
+    }
+    auto propertyID = tableEntry->getPropertyID(propertyName);
+    auto indexName = tableName + "." + propertyName;
+    if (storage::PropertyIndexCache::containsIndex(context->getTx(), *catalog, tableID,
+            propertyID) != shouldExist) {
+        throw BinderException{stringFormat("Property index on {} {}.", indexName,
+            shouldExist ? "does not exist" : "already exists")};
+    }
+    std::vector<std::string> columnNames = {"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::STRING());
+    return std::make_unique<PropertyIndexBindData>(std::move(columnTypes), std::move(columnNames),
+        context, tableID, propertyID, std::move(indexName));
+}
+
+static offset_t createPropertyIndexTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<PropertyIndexBindData>();
+    // The snapshot of the index is loaded by the first read-only transaction using it.
+    bindData->context->getCatalog()->createPropertyIndex(bindData->tableID, bindData->propertyID);
+    auto& dataChunk = output.dataChunk;
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    dataChunk.getValueVector(0)->setValue(pos,
+        stringFormat("Property index on {} has been created.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> createPropertyIndexBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto bindData = bindPropertyIndex(context, input, CreatePropertyIndexFunction::name,
+        false /* shouldExist */);
+    auto propertyIndexBindData = bindData->constPtrCast<PropertyIndexBindData>();
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTx(),
+        propertyIndexBindData->tableID);
+    auto dataType = tableEntry->getProperty(propertyIndexBindData->propertyID)->getDataType();
+    if (!storage::PropertyIndex::isIndexableType(dataType->getLogicalTypeID())) {
+        throw BinderException{stringFormat("Cannot create a property index on {} of type {}.",
+            propertyIndexBindData->indexName, dataType->toString())};
+    }
+    return bindData;
+}
+
+function_set CreatePropertyIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, createPropertyIndexTableFunc,
+        createPropertyIndexBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+static offset_t dropPropertyIndexTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<PropertyIndexBindData>();
+    bindData->context->getCatalog()->dropPropertyIndex(bindData->tableID, bindData->propertyID);
+    auto& dataChunk = output.dataChunk;
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    dataChunk.getValueVector(0)->setValue(pos,
+        stringFormat("Property index on {} has been dropped.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> dropPropertyIndexBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    return bindPropertyIndex(context, input, DropPropertyIndexFunction::name,
+        true /* shouldExist */);
+}
+
+function_set DropPropertyIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, dropPropertyIndexTableFunc,
+        dropPropertyIndexBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
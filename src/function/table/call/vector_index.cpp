@@ -0,0 +1,341 @@
+#include <cmath>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/types/value/nested.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/index/vector_index.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct VectorIndexBindData : public CallTableFuncBindData {
+    ClientContext* context;
+    table_id_t tableID;
+    property_id_t propertyID;
+    // <table>.<property>
+    std::string indexName;
+
+    VectorIndexBindData(std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames,
+        offset_t maxOffset, ClientContext* context, table_id_t tableID, property_id_t propertyID,
+        std::string indexName)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), maxOffset},
+          context{context}, tableID{tableID}, propertyID{propertyID},
+          indexName{std::move(indexName)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<VectorIndexBindData>(columnTypes, columnNames, maxOffset, context,
+            tableID, propertyID, indexName);
+    }
+};
+
+struct CreateVectorIndexBindData final : public VectorIndexBindData {
+    VectorIndexConfig config;
+
+    CreateVectorIndexBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, ClientContext* context, table_id_t tableID,
+        property_id_t propertyID, std::string indexName, const VectorIndexConfig& config)
+        : VectorIndexBindData{std::move(columnTypes), std::move(columnNames),
+              1 /* one row result */, context, tableID, propertyID, std::move(indexName)},
+          config{config} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateVectorIndexBindData>(columnTypes, columnNames, context,
+            tableID, propertyID, indexName, config);
+    }
+};
+
+struct QueryVectorIndexBindData final : public VectorIndexBindData {
+    std::vector<double> query;
+    uint64_t k;
+    uint64_t efSearch;
+
+    QueryVectorIndexBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, ClientContext* context, table_id_t tableID,
+        property_id_t propertyID, std::string indexName, std::vector<double> query, uint64_t k,
+        uint64_t efSearch)
+        : VectorIndexBindData{std::move(columnTypes), std::move(columnNames), k, context, tableID,
+              propertyID, std::move(indexName)},
+          query{std::move(query)}, k{k}, efSearch{efSearch} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryVectorIndexBindData>(columnTypes, columnNames, context,
+            tableID, propertyID, indexName, query, k, efSearch);
+    }
+};
+
+struct QueryVectorIndexSharedState final : public CallFuncSharedState {
+    // Offsets of the nearest nodes and their distances to the query, sorted by distance.
+    std::vector<std::pair<offset_t, double>> result;
+
+    explicit QueryVectorIndexSharedState(std::vector<std::pair<offset_t, double>> result)
+        : CallFuncSharedState{result.size()}, result{std::move(result)} {}
+};
+
+struct VectorIndexInfo {
+    table_id_t tableID;
+    property_id_t propertyID;
+    std::string indexName;
+};
+
+static VectorIndexInfo bindVectorIndex(ClientContext* context, TableFuncBindInput* input,
+    const std::string& functionName, bool shouldExist) {
+    auto catalog = context->getCatalog();
+    auto tableName = input->inputs[0].getValue<std::string>();
+    auto propertyName = input->inputs[1].getValue<std::string>();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    auto tableID = catalog->getTableID(context->getTx(), tableName);
+    auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableID);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{stringFormat("Cannot run {} on table {}. Expect a node table.",
+            functionName, tableName)};
+    }
+    if (!tableEntry->containProperty(propertyName)) {
+        throw BinderException{stringFormat("Node table {} does not have property {}.", tableName,
+            propertyName)};
+    }
+    auto propertyID = tableEntry->getPropertyID(propertyName);
+    auto indexName = tableName + "." + propertyName;
+    if (VectorIndexCache::containsIndex(context->getTx(), *catalog, tableID, propertyID) !=
+        shouldExist) {
+        throw BinderException{stringFormat("Vector index on {} {}.", indexName,
+            shouldExist ? "does not exist" : "already exists")};
+    }
+    return VectorIndexInfo{tableID, propertyID, std::move(indexName)};
+}
+
+static void setResult(TableFuncOutput& output, const std::string& result) {
+    auto& dataChunk = output.dataChunk;
+    auto pos = dataChunk.state->selVector->selectedPositions[0];
+    dataChunk.getValueVector(0)->setValue(pos, result);
+}
+
+static uint64_t bindPositiveInt(const Value& value, const std::string& name) {
+    auto result = value.getValue<int64_t>();
+    if (result <= 0) {
+        throw BinderException{stringFormat("{} must be positive.", name)};
+    }
+    return result;
+}
+
+static offset_t createVectorIndexTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<CreateVectorIndexBindData>();
+    // The graph of the index is built by the first query using it.
+    bindData->context->getCatalog()->createVectorIndex(bindData->tableID, bindData->propertyID,
+        bindData->config);
+    setResult(output, stringFormat("Vector index on {} has been created.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> createVectorIndexBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto info =
+        bindVectorIndex(context, input, CreateVectorIndexFunction::name, false /* shouldExist */);
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTx(), info.tableID);
+    auto dataType = tableEntry->getProperty(info.propertyID)->getDataType();
+    if (!VectorIndex::isIndexableType(*dataType)) {
+        throw BinderException{stringFormat("Cannot create a vector index on {} of type {}. Expect "
+                                           "a FLOAT or DOUBLE array.",
+            info.indexName, dataType->toString())};
+    }
+    VectorIndexConfig config;
+    if (input->inputs.size() > 2) {
+        auto metricName = input->inputs[2].getValue<std::string>();
+        if (!VectorDistanceMetricUtils::fromString(metricName, config.metric)) {
+            throw BinderException{stringFormat(
+                "Unknown distance metric {}. Expect l2, cosine or ip.", metricName)};
+        }
+    }
+    if (input->inputs.size() > 3) {
+        config.maxDegree = bindPositiveInt(input->inputs[3], "Max degree");
+        config.efConstruction = bindPositiveInt(input->inputs[4], "efConstruction");
+    }
+    std::vector<std::string> columnNames = {"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::STRING());
+    return std::make_unique<CreateVectorIndexBindData>(std::move(columnTypes),
+        std::move(columnNames), context, info.tableID, info.propertyID, std::move(info.indexName),
+        config);
+}
+
+function_set CreateVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    // (table, property[, metric[, max degree, efConstruction]])
+    std::vector<std::vector<LogicalTypeID>> parameterTypeIDs = {
+        {LogicalTypeID::STRING, LogicalTypeID::STRING},
+        {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING},
+        {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::INT64,
+            LogicalTypeID::INT64}};
+    for (auto& typeIDs : parameterTypeIDs) {
+        functionSet.push_back(std::make_unique<TableFunction>(name, createVectorIndexTableFunc,
+            createVectorIndexBindFunc, initSharedState, initEmptyLocalState, typeIDs));
+    }
+    return functionSet;
+}
+
+static offset_t dropVectorIndexTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<VectorIndexBindData>();
+    bindData->context->getCatalog()->dropVectorIndex(bindData->tableID, bindData->propertyID);
+    setResult(output, stringFormat("Vector index on {} has been dropped.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> dropVectorIndexBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto info =
+        bindVectorIndex(context, input, DropVectorIndexFunction::name, true /* shouldExist */);
+    std::vector<std::string> columnNames = {"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::STRING());
+    return std::make_unique<VectorIndexBindData>(std::move(columnTypes), std::move(columnNames),
+        1 /* one row result */, context, info.tableID, info.propertyID, std::move(info.indexName));
+}
+
+function_set DropVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, dropVectorIndexTableFunc,
+        dropVectorIndexBindFunc, initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+static double getQueryElement(const Value& value) {
+    if (value.isNull()) {
+        throw BinderException{"Query vector cannot contain null elements."};
+    }
+    double result;
+    switch (value.getDataType()->getLogicalTypeID()) {
+    case LogicalTypeID::DOUBLE:
+        result = value.getValue<double>();
+        break;
+    case LogicalTypeID::FLOAT:
+        result = value.getValue<float>();
+        break;
+    case LogicalTypeID::INT64:
+        result = value.getValue<int64_t>();
+        break;
+    case LogicalTypeID::INT32:
+        result = value.getValue<int32_t>();
+        break;
+    case LogicalTypeID::INT16:
+        result = value.getValue<int16_t>();
+        break;
+    case LogicalTypeID::INT8:
+        result = value.getValue<int8_t>();
+        break;
+    default:
+        throw BinderException{stringFormat("Query vector must be a list of numbers, got {}.",
+            value.getDataType()->toString())};
+    }
+    if (std::isnan(result)) {
+        throw BinderException{"Query vector cannot contain NaN elements."};
+    }
+    return result;
+}
+
+static std::unique_ptr<TableFuncBindData> queryVectorIndexBindFunc(ClientContext* context,
+    TableFuncBindInput* input) {
+    auto info =
+        bindVectorIndex(context, input, QueryVectorIndexFunction::name, true /* shouldExist */);
+    // Graphs are built from committed values.
+    if (context->getTx()->getLocalStorage()->getLocalTable(info.tableID) != nullptr) {
+        throw BinderException{stringFormat("Cannot run {} on node table {}, which has uncommitted "
+                                           "changes in the current transaction.",
+            QueryVectorIndexFunction::name,
+            context->getCatalog()->getTableName(context->getTx(), info.tableID))};
+    }
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTx(), info.tableID);
+    auto dataType = tableEntry->getProperty(info.propertyID)->getDataType();
+    auto dimension = ArrayType::getNumElements(dataType);
+    auto& queryValue = input->inputs[2];
+    if (queryValue.isNull()) {
+        throw BinderException{"Query vector cannot be null."};
+    }
+    auto numElements = NestedVal::getChildrenSize(&queryValue);
+    if (numElements != dimension) {
+        throw BinderException{stringFormat("Query vector has {} elements, but vectors of {} have "
+                                           "{}.",
+            numElements, info.indexName, dimension)};
+    }
+    std::vector<double> query(numElements);
+    for (auto i = 0u; i < numElements; i++) {
+        query[i] = getQueryElement(*NestedVal::getChildVal(&queryValue, i));
+    }
+    auto k = bindPositiveInt(input->inputs[3], "k");
+    auto efSearch = input->inputs.size() > 4 ? bindPositiveInt(input->inputs[4], "efSearch") :
+                                               VectorIndexConfig::DEFAULT_EF_SEARCH;
+    std::vector<std::string> columnNames = {"node_id", "distance"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(*LogicalType::INTERNAL_ID());
+    columnTypes.push_back(*LogicalType::DOUBLE());
+    return std::make_unique<QueryVectorIndexBindData>(std::move(columnTypes),
+        std::move(columnNames), context, info.tableID, info.propertyID, std::move(info.indexName),
+        std::move(query), k, efSearch);
+}
+
+static std::unique_ptr<TableFuncSharedState> queryVectorIndexInitSharedState(
+    TableFunctionInitInput& input) {
+    auto bindData = input.bindData->constPtrCast<QueryVectorIndexBindData>();
+    auto context = bindData->context;
+    auto index = context->getStorageManager()->getVectorIndexCache()->getIndex(context->getTx(),
+        *context->getCatalog(), bindData->tableID, bindData->propertyID,
+        context->getClientConfig()->numThreads);
+    return std::make_unique<QueryVectorIndexSharedState>(
+        index->search(bindData->query, bindData->k, bindData->efSearch));
+}
+
+static offset_t queryVectorIndexTableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<QueryVectorIndexSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<QueryVectorIndexBindData>();
+    auto nodeIDVector = output.dataChunk.getValueVector(0).get();
+    auto distanceVector = output.dataChunk.getValueVector(1).get();
+    for (auto i = morsel.startOffset; i < morsel.endOffset; i++) {
+        auto& [nodeOffset, distance] = sharedState->result[i];
+        nodeIDVector->setValue<nodeID_t>(i - morsel.startOffset,
+            nodeID_t{nodeOffset, bindData->tableID});
+        distanceVector->setValue<double>(i - morsel.startOffset, distance);
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+function_set QueryVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    // (table, property, query, k[, efSearch])
+    std::vector<std::vector<LogicalTypeID>> parameterTypeIDs = {
+        {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::LIST, LogicalTypeID::INT64},
+        {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::LIST, LogicalTypeID::INT64,
+            LogicalTypeID::INT64}};
+    for (auto& typeIDs : parameterTypeIDs) {
+        functionSet.push_back(std::make_unique<TableFunction>(name, queryVectorIndexTableFunc,
+            queryVectorIndexBindFunc, queryVectorIndexInitSharedState, initEmptyLocalState,
+            typeIDs));
+    }
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -221,6 +221,8 @@ private:
         const std::vector<common::table_id_t>& tableIDs, std::shared_ptr<NodeExpression> srcNode,
         std::shared_ptr<NodeExpression> dstNode, RelDirectionType directionType);
     std::pair<uint64_t, uint64_t> bindVariableLengthRelBound(const parser::RelPattern& relPattern);
+    std::shared_ptr<Expression> bindWeightExpression(const RelExpression& rel,
+        const std::string& propertyName, const std::string& patternName);
     void bindQueryRelProperties(RelExpression& rel);
 
     std::shared_ptr<NodeExpression> bindQueryNode(const parser::NodePattern& nodePattern,
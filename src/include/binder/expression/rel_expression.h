@@ -40,6 +40,8 @@ struct RecursiveInfo {
     std::shared_ptr<Expression> nodePredicateExecFlag;
     std::shared_ptr<Expression> nodePredicate;
     std::shared_ptr<Expression> relPredicate;
+    // Rel property holding the weights of weighted shortest paths.
+    std::shared_ptr<Expression> weightExpression;
     // Projection list
     expression_vector nodeProjectionList;
     expression_vector relProjectionList;
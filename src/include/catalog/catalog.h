@@ -18,6 +18,7 @@ class NodeTableCatalogEntry;
 class RelTableCatalogEntry;
 class RelGroupCatalogEntry;
 class RDFGraphCatalogEntry;
+struct VectorIndexConfig;
 
 class Catalog {
 public:
@@ -58,6 +59,12 @@ public:
 
     void setTableComment(common::table_id_t tableID, const std::string& comment);
 
+    void createPropertyIndex(common::table_id_t tableID, common::property_id_t propertyID);
+    void dropPropertyIndex(common::table_id_t tableID, common::property_id_t propertyID);
+    void createVectorIndex(common::table_id_t tableID, common::property_id_t propertyID,
+        const VectorIndexConfig& config);
+    void dropVectorIndex(common::table_id_t tableID, common::property_id_t propertyID);
+
     // ----------------------------- Functions ----------------------------
     void addFunction(CatalogEntryType entryType, std::string name,
         function::function_set functionSet);
@@ -77,9 +84,12 @@ public:
     std::vector<std::string> getMacroNames(transaction::Transaction* tx) const;
 
     // ----------------------------- Tx ----------------------------
+    // Whether the catalog has been changed since the last checkpoint.
+    bool hasUpdates() const { return isUpdated; }
     void prepareCommitOrRollback(transaction::TransactionAction action,
         common::VirtualFileSystem* fs);
     void checkpointInMemory();
+    void rollbackInMemory();
 
     void initCatalogContentForWriteTrxIfNecessary() {
         if (!readWriteVersion) {
@@ -96,7 +106,6 @@ public:
 private:
     CatalogContent* getVersion(transaction::Transaction* tx) const;
 
-    bool hasUpdates() const { return isUpdated; }
     void setToUpdated() { isUpdated = true; }
     void resetToNotUpdated() { isUpdated = false; }
 
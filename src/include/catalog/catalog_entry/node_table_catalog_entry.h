@@ -1,5 +1,6 @@
 #pragma once
 
+#include "catalog/vector_index_config.h"
 #include "table_catalog_entry.h"
 
 namespace kuzu {
@@ -26,6 +27,29 @@ public:
     void addBWdRelTableID(common::table_id_t tableID) { bwdRelTableIDSet.insert(tableID); }
     const common::table_id_set_t& getFwdRelTableIDSet() const { return fwdRelTableIDSet; }
     const common::table_id_set_t& getBwdRelTableIDSet() const { return bwdRelTableIDSet; }
+    bool hasPropertyIndex(common::property_id_t propertyID) const {
+        return propertyIndexPIDs.contains(propertyID);
+    }
+    void addPropertyIndex(common::property_id_t propertyID) {
+        propertyIndexPIDs.insert(propertyID);
+    }
+    void dropPropertyIndex(common::property_id_t propertyID) {
+        propertyIndexPIDs.erase(propertyID);
+    }
+    bool hasVectorIndex(common::property_id_t propertyID) const {
+        return vectorIndexConfigs.contains(propertyID);
+    }
+    const VectorIndexConfig& getVectorIndexConfig(common::property_id_t propertyID) const {
+        return vectorIndexConfigs.at(propertyID);
+    }
+    void addVectorIndex(common::property_id_t propertyID, const VectorIndexConfig& config) {
+        vectorIndexConfigs.emplace(propertyID, config);
+    }
+    void dropVectorIndex(common::property_id_t propertyID) {
+        vectorIndexConfigs.erase(propertyID);
+    }
+    // Drops the indexes on a property which is dropped.
+    void dropIndexes(common::property_id_t propertyID);
 
     //===--------------------------------------------------------------------===//
     // serialization & deserialization
@@ -43,6 +67,12 @@ private:
     common::property_id_t primaryKeyPID;
     common::table_id_set_t fwdRelTableIDSet; // srcNode->rel
     common::table_id_set_t bwdRelTableIDSet; // dstNode->rel
+    // Properties with a property index. Only the definitions of the indexes are persisted, their
+    // snapshots are loaded in memory by storage::PropertyIndexCache.
+    std::unordered_set<common::property_id_t> propertyIndexPIDs;
+    // Definitions of the vector indexes on properties, whose graphs are built in memory by
+    // storage::VectorIndexCache.
+    std::unordered_map<common::property_id_t, VectorIndexConfig> vectorIndexConfigs;
 };
 
 } // namespace catalog
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+namespace catalog {
+
+enum class VectorDistanceMetric : uint8_t {
+    // Euclidean distance, as computed by ARRAY_DISTANCE.
+    L2 = 0,
+    // 1 - ARRAY_COSINE_SIMILARITY.
+    COSINE = 1,
+    // -ARRAY_INNER_PRODUCT.
+    INNER_PRODUCT = 2,
+};
+
+struct VectorDistanceMetricUtils {
+    // Returns false if the name is unknown.
+    static bool fromString(const std::string& name, VectorDistanceMetric& metric);
+    static std::string toString(VectorDistanceMetric metric);
+};
+
+// Definition of a vector index, whose graph is built by storage::VectorIndexCache.
+struct VectorIndexConfig {
+    static constexpr uint64_t DEFAULT_MAX_DEGREE = 16;
+    static constexpr uint64_t DEFAULT_EF_CONSTRUCTION = 128;
+    static constexpr uint64_t DEFAULT_EF_SEARCH = 64;
+
+    VectorDistanceMetric metric = VectorDistanceMetric::L2;
+    // Max number of neighbors of a node in the upper layers. Nodes of the bottom layer have up to
+    // twice as many.
+    uint64_t maxDegree = DEFAULT_MAX_DEGREE;
+    // Number of candidates considered when connecting a node.
+    uint64_t efConstruction = DEFAULT_EF_CONSTRUCTION;
+
+    void serialize(common::Serializer& serializer) const;
+    static VectorIndexConfig deserialize(common::Deserializer& deserializer);
+};
+
+} // namespace catalog
+} // namespace kuzu
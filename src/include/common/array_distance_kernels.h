@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace common {
+
+// Inner products and squared Euclidean distances of FLOAT and DOUBLE arrays, on which the array
+// distance functions and vector indexes are built. The widest kernel supported by the CPU
+// (AVX-512 or AVX2 with FMA) is chosen once at runtime, and a scalar loop is used otherwise.
+// Kernels sum products in a different order than the scalar loop, so their results may differ
+// from it in the last bits.
+struct ArrayDistanceKernels {
+    static float innerProduct(const float* left, const float* right, uint64_t size);
+    static double innerProduct(const double* left, const double* right, uint64_t size);
+    static float squaredDistance(const float* left, const float* right, uint64_t size);
+    static double squaredDistance(const double* left, const double* right, uint64_t size);
+};
+
+} // namespace common
+} // namespace kuzu
@@ -20,6 +20,12 @@ constexpr bool DEFAULT_ENABLE_SEMI_MASK = true;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS = 5000000;
+// Auto-commit write statements wait for the active write transaction up to this timeout.
+constexpr uint64_t DEFAULT_WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS = 5000000;
+// Commits defer checkpointing until the WAL grows beyond the threshold in bytes, or until the
+// database has been idle at the end of an interval.
+constexpr uint64_t DEFAULT_CHECKPOINT_THRESHOLD = 16 * 1024 * 1024;
+constexpr uint64_t DEFAULT_CHECKPOINT_INTERVAL_IN_MS = 5000;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -34,6 +40,7 @@ struct InternalKeyword {
     static constexpr char LENGTH[] = "_LENGTH";
     static constexpr char NODES[] = "_NODES";
     static constexpr char RELS[] = "_RELS";
+    static constexpr char WEIGHT[] = "_WEIGHT";
     static constexpr char STAR[] = "*";
     static constexpr char PLACE_HOLDER[] = "_PLACE_HOLDER";
     static constexpr char MAP_KEY[] = "KEY";
@@ -67,10 +74,15 @@ struct BufferPoolConstants {
     // If a user does not specify a max size for BM, we by default set the max size of BM to
     // maxPhyMemSize * DEFAULT_PHY_MEM_SIZE_RATIO_FOR_BM.
     static constexpr double DEFAULT_PHY_MEM_SIZE_RATIO_FOR_BM = 0.8;
-    // For each PURGE_EVICTION_QUEUE_INTERVAL candidates added to the eviction queue, we will call
-    // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
-    // `EvictionQueue::removeNonEvictableCandidates()` for more details.
+    // For each PURGE_EVICTION_QUEUE_INTERVAL candidates added to a shard of the eviction queue, we
+    // will call `removeNonEvictableCandidates` on the shard to remove candidates that are not
+    // evictable. See `EvictionQueue::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
+    // The number of independently locked shards of each tier of the eviction queue.
+    static constexpr uint64_t EVICTION_QUEUE_NUM_SHARDS = 16;
+    // Eviction takes pages from the probation tier of the eviction queue as long as it holds at
+    // least 1 / EVICTION_QUEUE_MIN_PROBATION_RATIO of the candidates.
+    static constexpr uint64_t EVICTION_QUEUE_MIN_PROBATION_RATIO = 4;
 // The default max size for a VMRegion.
 #ifdef __32BIT__
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = (uint64_t)1 << 30; // (1GB)
@@ -97,6 +109,9 @@ struct StorageConstants {
     static constexpr char DATA_FILE_NAME[] = "data.kz";
     static constexpr char METADATA_FILE_NAME[] = "metadata.kz";
     static constexpr char LOCK_FILE_NAME[] = ".lock";
+    // Temporary files of operators spilling to disk. Leftovers of a crashed process are removed
+    // when the database is opened.
+    static constexpr char SPILL_FILE_SUFFIX[] = ".spill";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -106,6 +121,10 @@ struct StorageConstants {
     static constexpr uint64_t NODE_GROUP_SIZE_LOG2 = 17; // 64 * 2048 nodes per group
     static constexpr uint64_t NODE_GROUP_SIZE = (uint64_t)1 << NODE_GROUP_SIZE_LOG2;
 
+    // The number of pages of a column chunk that sequential scans load into the buffer pool at
+    // one time.
+    static constexpr uint64_t SCAN_READ_AHEAD_NUM_PAGES = 32;
+
     static constexpr double PACKED_CSR_DENSITY = 0.8;
     static constexpr double LEAF_LOW_CSR_DENSITY = 0.1;
     static constexpr double LEAF_HIGH_CSR_DENSITY = 1.0;
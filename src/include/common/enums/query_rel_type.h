@@ -10,6 +10,8 @@ enum class QueryRelType : uint8_t {
     VARIABLE_LENGTH = 1,
     SHORTEST = 2,
     ALL_SHORTEST = 3,
+    // Shortest path by the sum of the weights of its rels.
+    WEIGHTED_SHORTEST = 4,
 };
 
 struct QueryRelTypeUtils {
@@ -22,6 +22,8 @@ struct KUZU_API FileInfo {
 
     int64_t readFile(void* buf, size_t nbyte);
 
+    void prefetch(uint64_t position, uint64_t numBytes);
+
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
 
     void syncFile() const;
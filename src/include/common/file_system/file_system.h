@@ -53,6 +53,11 @@ protected:
 
     virtual int64_t readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const = 0;
 
+    // Hints that the given range of the file will be read soon. File systems which cannot start
+    // reading it in the background ignore the hint.
+    virtual void prefetch(FileInfo& /*fileInfo*/, uint64_t /*position*/,
+        uint64_t /*numBytes*/) const {}
+
     virtual void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const;
 
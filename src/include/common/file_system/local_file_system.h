@@ -54,6 +54,8 @@ protected:
 
     int64_t readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const override;
 
+    void prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const override;
+
     void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const override;
 
@@ -20,12 +20,15 @@ public:
 
     void flush();
 
-    void resetOffsets() {
-        fileOffset = 0;
+    // Buffered bytes which have not been flushed yet are discarded.
+    void resetOffsets(uint64_t newFileOffset = 0) {
+        fileOffset = newFileOffset;
         bufferOffset = 0;
     }
 
     uint64_t getFileOffset() const { return fileOffset; }
+    // Size of the file once the buffered bytes are flushed.
+    uint64_t getFileSize() const { return fileOffset + bufferOffset; }
 
     FileInfo& getFileInfo() { return *fileInfo; }
 
@@ -44,6 +47,10 @@ public:
 
     bool finished() override;
 
+    // Offset in the file of the next byte to read.
+    inline uint64_t getReadOffset() const { return fileOffset - bufferSize + bufferOffset; }
+    void seek(uint64_t offset);
+
 private:
     static constexpr uint64_t BUFFER_SIZE = BufferPoolConstants::PAGE_4KB_SIZE;
 
@@ -2,6 +2,7 @@
 
 #include "math.h"
 
+#include "common/array_distance_kernels.h"
 #include "common/vector/value_vector.h"
 
 namespace kuzu {
@@ -14,18 +15,17 @@ struct ArrayCosineSimilarity {
         common::ValueVector& /*resultVector*/) {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
-        T distance = 0;
-        T normLeft = 0;
-        T normRight = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            auto x = leftElements[i];
-            auto y = rightElements[i];
-            distance += x * y;
-            normLeft += x * x;
-            normRight += y * y;
-        }
-        auto similarity = distance / (std::sqrt(normLeft) * std::sqrt(normRight));
-        result = std::max(static_cast<T>(-1), std::min(similarity, static_cast<T>(1)));
+        result = compute(leftElements, rightElements, left.size,
+            common::ArrayDistanceKernels::innerProduct(rightElements, rightElements, left.size));
+    }
+
+    // The squared norm of right is given, since it is computed once if right is constant.
+    template<typename T>
+    static inline T compute(const T* left, const T* right, uint64_t size, T rightSquaredNorm) {
+        auto product = common::ArrayDistanceKernels::innerProduct(left, right, size);
+        auto leftSquaredNorm = common::ArrayDistanceKernels::innerProduct(left, left, size);
+        auto similarity = product / (std::sqrt(leftSquaredNorm) * std::sqrt(rightSquaredNorm));
+        return std::max(static_cast<T>(-1), std::min(similarity, static_cast<T>(1)));
     }
 };
 
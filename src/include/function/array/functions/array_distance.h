@@ -2,6 +2,7 @@
 
 #include "math.h"
 
+#include "common/array_distance_kernels.h"
 #include "common/vector/value_vector.h"
 
 namespace kuzu {
@@ -14,12 +15,13 @@ struct ArrayDistance {
         common::ValueVector& /*resultVector*/) {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
-        result = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            auto diff = leftElements[i] - rightElements[i];
-            result += diff * diff;
-        }
-        result = std::sqrt(result);
+        result = compute(leftElements, rightElements, left.size, static_cast<T>(0));
+    }
+
+    template<typename T>
+    static inline T compute(const T* left, const T* right, uint64_t size,
+        T /*rightSquaredNorm*/) {
+        return std::sqrt(common::ArrayDistanceKernels::squaredDistance(left, right, size));
     }
 };
 
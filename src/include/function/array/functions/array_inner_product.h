@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/array_distance_kernels.h"
 #include "common/vector/value_vector.h"
 
 namespace kuzu {
@@ -12,10 +13,13 @@ struct ArrayInnerProduct {
         common::ValueVector& /*resultVector*/) {
         auto leftElements = (T*)common::ListVector::getListValues(&leftVector, left);
         auto rightElements = (T*)common::ListVector::getListValues(&rightVector, right);
-        result = 0;
-        for (auto i = 0u; i < left.size; i++) {
-            result += leftElements[i] * rightElements[i];
-        }
+        result = compute(leftElements, rightElements, left.size, static_cast<T>(0));
+    }
+
+    template<typename T>
+    static inline T compute(const T* left, const T* right, uint64_t size,
+        T /*rightSquaredNorm*/) {
+        return common::ArrayDistanceKernels::innerProduct(left, right, size);
     }
 };
 
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <condition_variable>
+
+#include "function/table/call_functions.h"
+#include "storage/store/csr_graph.h"
+
+namespace kuzu {
+namespace catalog {
+class RelTableCatalogEntry;
+} // namespace catalog
+
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace function {
+
+/*
+ * A vertex-centric graph algorithm which runs in rounds. Each round computes the nodes of the graph
+ * in ranges of MORSEL_SIZE nodes, which are computed concurrently by different threads, and is
+ * then finalized by a single thread.
+ */
+class GraphAlgorithm {
+public:
+    static constexpr common::offset_t MORSEL_SIZE = 2048;
+
+    virtual ~GraphAlgorithm() = default;
+
+    // Called once the graph has been loaded.
+    virtual void init(const storage::CSRGraph& graph) = 0;
+    // Computes the nodes in [startOffset, endOffset) for the current round.
+    virtual void compute(const storage::CSRGraph& graph, common::offset_t startOffset,
+        common::offset_t endOffset) = 0;
+    // Called once all nodes of the current round have been computed. Returns false once the
+    // algorithm has finished.
+    virtual bool finalizeRound(const storage::CSRGraph& graph) = 0;
+
+    virtual void writeResult(common::offset_t nodeOffset, common::ValueVector& vector,
+        common::sel_t pos) const = 0;
+};
+
+using graph_algorithm_create_t = std::function<std::unique_ptr<GraphAlgorithm>()>;
+
+/*
+ * GraphAlgorithmSharedState loads the graph and runs the algorithm with all threads of the
+ * pipeline, before the results are output in morsels of nodes. Threads take tasks of the current
+ * round, i.e., node groups to load or ranges of nodes to compute, and the thread which finishes the
+ * last task of a round starts the next one. Threads wait for the next round if all tasks of the
+ * current round have been handed out. Graphs of projections are cached once they have been loaded
+ * by a read-only transaction.
+ */
+struct GraphAlgorithmSharedState final : public CallFuncSharedState {
+    GraphAlgorithmSharedState(main::ClientContext* context, storage::RelTable* relTable,
+        std::shared_ptr<storage::CSRGraph> graph, bool isLoaded, std::string projectedGraphName,
+        std::unique_ptr<GraphAlgorithm> algorithm);
+
+    // Returns once the algorithm has finished. Returns false if it has been aborted because
+    // another thread failed.
+    bool compute();
+
+    std::shared_ptr<storage::CSRGraph> graph;
+    std::unique_ptr<GraphAlgorithm> algorithm;
+
+private:
+    void runTask(uint64_t taskIdx);
+    // Starts the next round, or finishes the algorithm.
+    void finishRound();
+    void startRound(uint64_t numTasks_);
+
+private:
+    main::ClientContext* context;
+    storage::RelTable* relTable;
+    // Empty if the graph is not the snapshot of a projection.
+    std::string projectedGraphName;
+    std::mutex roundMtx;
+    std::condition_variable cv;
+    bool isLoading;
+    uint64_t numTasks;
+    uint64_t nextTaskIdx;
+    uint64_t numTasksFinished;
+    bool finished;
+    bool aborted;
+};
+
+struct GraphAlgorithmBindData final : public CallTableFuncBindData {
+    main::ClientContext* context;
+    storage::RelTable* relTable;
+    storage::GraphProjection projection;
+    // Name of the projection whose snapshot is reused. Empty if there is none.
+    std::string projectedGraphName;
+    graph_algorithm_create_t createAlgorithm;
+
+    GraphAlgorithmBindData(std::vector<common::LogicalType> columnTypes,
+        std::vector<std::string> columnNames, main::ClientContext* context,
+        storage::RelTable* relTable, storage::GraphProjection projection,
+        std::string projectedGraphName, graph_algorithm_create_t createAlgorithm)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames),
+              0 /* maxOffset */},
+          context{context}, relTable{relTable}, projection{projection},
+          projectedGraphName{std::move(projectedGraphName)},
+          createAlgorithm{std::move(createAlgorithm)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<GraphAlgorithmBindData>(columnTypes, columnNames, context, relTable,
+            projection, projectedGraphName, createAlgorithm);
+    }
+};
+
+// Graph algorithms take the name of a projected graph or of a rel table as their first parameter,
+// and return the node ID of each node of the rel table's node table together with the value
+// computed for it. Algorithms over a rel table reuse a projection of all of its rels if there is
+// one.
+struct GraphAlgorithmFunction : public CallFunction {
+    // Returns the rel table, whose src and dst node tables must be the same.
+    static catalog::RelTableCatalogEntry* bindRelTable(main::ClientContext* context,
+        const std::string& functionName, const std::string& relTableName);
+    static std::unique_ptr<TableFuncBindData> bind(main::ClientContext* context,
+        const std::string& functionName, const std::string& graphName,
+        const std::string& valueColumnName, common::LogicalType valueColumnType,
+        graph_algorithm_create_t createAlgorithm);
+    static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitInput& input);
+    static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output);
+};
+
+struct PageRankFunction final : public GraphAlgorithmFunction {
+    static constexpr const char* name = "PAGE_RANK";
+
+    static function_set getFunctionSet();
+};
+
+struct WeaklyConnectedComponentsFunction final : public GraphAlgorithmFunction {
+    static constexpr const char* name = "WEAKLY_CONNECTED_COMPONENTS";
+
+    static function_set getFunctionSet();
+};
+
+struct StronglyConnectedComponentsFunction final : public GraphAlgorithmFunction {
+    static constexpr const char* name = "STRONGLY_CONNECTED_COMPONENTS";
+
+    static function_set getFunctionSet();
+};
+
+struct LabelPropagationFunction final : public GraphAlgorithmFunction {
+    static constexpr const char* name = "LABEL_PROPAGATION";
+
+    static function_set getFunctionSet();
+};
+
+struct KCoreDecompositionFunction final : public GraphAlgorithmFunction {
+    static constexpr const char* name = "K_CORE_DECOMPOSITION";
+
+    static function_set getFunctionSet();
+};
+
+// Projects the rels of a rel table, optionally only those whose value of a numeric property is
+// within a range, into a named in-memory graph, which is reused by graph algorithms and recursive
+// joins of read-only transactions. Returns the number of nodes and rels of the graph.
+struct ProjectGraphFunction final : public CallFunction {
+    static constexpr const char* name = "PROJECT_GRAPH";
+
+    static function_set getFunctionSet();
+};
+
+struct DropProjectedGraphFunction final : public CallFunction {
+    static constexpr const char* name = "DROP_PROJECTED_GRAPH";
+
+    static function_set getFunctionSet();
+};
+
+} // namespace function
+} // namespace kuzu
@@ -92,5 +92,35 @@ struct ShowAttachedDatabasesFunction final : public CallFunction {
     static function_set getFunctionSet();
 };
 
+struct CreatePropertyIndexFunction final : public CallFunction {
+    static constexpr const char* name = "CREATE_PROPERTY_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropPropertyIndexFunction final : public CallFunction {
+    static constexpr const char* name = "DROP_PROPERTY_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct CreateVectorIndexFunction final : public CallFunction {
+    static constexpr const char* name = "CREATE_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropVectorIndexFunction final : public CallFunction {
+    static constexpr const char* name = "DROP_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryVectorIndexFunction final : public CallFunction {
+    static constexpr const char* name = "QUERY_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -29,6 +29,12 @@ struct ClientConfig {
     common::PathSemantic recursivePatternSemantic;
     // Scale factor for recursive pattern cardinality estimation.
     uint32_t recursivePatternCardinalityScaleFactor;
+    // Fraction of the buffer pool a hash join build side can take before it is spilled to disk.
+    // 0 means spilling is disabled.
+    double hashJoinMemoryFraction;
+    // If results of read-only queries are produced on demand while being read instead of being
+    // materialized before the query returns.
+    bool enableStreamingResults;
 };
 
 struct ClientConfigDefault {
@@ -40,6 +46,8 @@ struct ClientConfigDefault {
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr common::PathSemantic RECURSIVE_PATTERN_SEMANTIC = common::PathSemantic::WALK;
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 1;
+    static constexpr double HASH_JOIN_MEMORY_FRACTION = 0.5;
+    static constexpr bool ENABLE_STREAMING_RESULTS = false;
 };
 
 } // namespace main
@@ -32,6 +32,7 @@ struct ExtensionOptions;
 namespace main {
 class Database;
 class DatabaseManager;
+class StreamingQuery;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -52,6 +53,7 @@ class ClientContext {
 
 public:
     explicit ClientContext(Database* database);
+    ~ClientContext();
 
     // Client config
     const ClientConfig* getClientConfig() const { return &config; }
@@ -142,7 +144,15 @@ private:
         const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams);
 
     std::unique_ptr<QueryResult> executeAndAutoCommitIfNecessaryNoLock(
-        PreparedStatement* preparedStatement, uint32_t planIdx = 0u, bool requiredNexTx = true);
+        PreparedStatement* preparedStatement, uint32_t planIdx = 0u, bool requiredNexTx = true,
+        bool canStreamResults = false);
+
+    bool shouldStreamResultsNoLock(PreparedStatement* preparedStatement) const;
+    std::unique_ptr<QueryResult> executeStreamingNoLock(PreparedStatement* preparedStatement,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan);
+    // Finishes the streaming query of the connection, if any, before the transaction context is
+    // used by another query.
+    void finishStreamingQueryNoLock();
 
     void addScalarFunction(std::string name, function::function_set definitions);
 
@@ -166,6 +176,8 @@ private:
     Database* database;
     // Progress bar for queries
     std::unique_ptr<common::ProgressBar> progressBar;
+    // Query whose results are being streamed.
+    std::shared_ptr<StreamingQuery> streamingQuery;
     std::mutex mtx;
 };
 
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "common/api.h"
 #include "common/case_insensitive_map.h"
+#include "common/constants.h"
 #include "kuzu_fwd.h"
 
 namespace kuzu {
@@ -34,6 +38,7 @@ class StorageExtension;
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
+class ClientContext;
 
 /**
  * @brief Stores runtime configuration for creating or opening a Database
@@ -55,15 +60,24 @@ struct KUZU_API SystemConfig {
      * environment. This will be removed once we implemente a better solution later. The value is
      * default to 1 << 43 (8TB) under 64-bit environment and 1GB under 32-bit one (see
      * `DEFAULT_VM_REGION_MAX_SIZE`).
+     * @param checkpointThreshold The size of the WAL in bytes up to which commits of write
+     * transactions that only update data defer checkpointing, i.e., writing their pages back to the
+     * database files. 0 checkpoints on every commit.
+     * @param checkpointIntervalInMs The interval at which deferred checkpoints run in the
+     * background if no transaction is active. 0 disables background checkpoints.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
-        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u);
+        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
+        uint64_t checkpointThreshold = common::DEFAULT_CHECKPOINT_THRESHOLD,
+        uint64_t checkpointIntervalInMs = common::DEFAULT_CHECKPOINT_INTERVAL_IN_MS);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    uint64_t checkpointThreshold;
+    uint64_t checkpointIntervalInMs;
 };
 
 /**
@@ -122,18 +136,23 @@ public:
 private:
     void openLockFile();
     void initDBDirAndCoreFilesIfNecessary();
+    void removeSpillFiles(ClientContext* context);
     static void initLoggers();
     static void dropLoggers();
 
     // Commits and checkpoints a write transaction or rolls that transaction back. This involves
-    // either replaying the WAL and either redoing or undoing and in either case at the end WAL is
-    // cleared.
+    // either replaying the WAL and either redoing or undoing the records of the transaction. The
+    // WAL is cleared unless the checkpoint of the committed transaction is deferred.
     // skipCheckpointForTestingRecovery is used to simulate a failure before checkpointing in tests.
     void commit(transaction::Transaction* transaction, bool skipCheckpointForTestingRecovery);
     void rollback(transaction::Transaction* transaction, bool skipCheckpointForTestingRecovery);
     void checkpointAndClearWAL(storage::WALReplayMode walReplayMode);
     void rollbackAndClearWAL();
     void recoverIfNecessary();
+    // Writes the pages of the committed transactions whose checkpoint has been deferred back to
+    // the database files and clears the WAL. No transaction can be active.
+    void checkpointDeferredCommits();
+    void checkpointPeriodically();
 
 private:
     std::string databasePath;
@@ -151,6 +170,10 @@ private:
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
+    std::thread checkpointThread;
+    std::mutex checkpointMtx;
+    std::condition_variable checkpointCV;
+    bool isClosing = false;
 };
 
 } // namespace main
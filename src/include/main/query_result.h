@@ -12,6 +12,8 @@
 namespace kuzu {
 namespace main {
 
+class StreamingQuery;
+
 /**
  * @brief QueryResult stores the result of a query execution.
  */
@@ -72,7 +74,7 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. Not available if the results are streamed.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,7 +106,7 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. Not available if the results are streamed.
      */
     KUZU_API void resetIterator();
 
@@ -135,6 +137,9 @@ public:
 private:
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_,
         const std::vector<std::shared_ptr<binder::Expression>>& columns);
+    void initIterator() const;
+    // Fetches the next table of streamed results. Returns false once all results have been read.
+    bool fetchNextTable() const;
     void validateQuerySucceed() const;
 
 private:
@@ -145,10 +150,11 @@ private:
     // header information
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnDataTypes;
-    // data
-    std::shared_ptr<processor::FactorizedTable> factorizedTable;
-    std::unique_ptr<processor::FlatTupleIterator> iterator;
+    // data, which is replaced table by table if results are streamed
+    mutable std::shared_ptr<processor::FactorizedTable> factorizedTable;
+    mutable std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    std::shared_ptr<StreamingQuery> streamingQuery;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
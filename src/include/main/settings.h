@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/exception/runtime.h"
 #include "common/types/value/value.h"
 #include "main/client_context.h"
 
@@ -134,5 +135,35 @@ struct RecursivePatternFactorSetting {
     }
 };
 
+struct HashJoinMemoryFractionSetting {
+    static constexpr const char* name = "hash_join_memory_fraction";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto fraction = parameter.getValue<double>();
+        if (fraction < 0 || fraction > 1) {
+            throw common::RuntimeException(
+                "hash_join_memory_fraction must be between 0 and 1, but got " +
+                std::to_string(fraction) + ".");
+        }
+        context->getClientConfigUnsafe()->hashJoinMemoryFraction = fraction;
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->hashJoinMemoryFraction);
+    }
+};
+
+struct EnableStreamingResultsSetting {
+    static constexpr const char* name = "stream_results";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableStreamingResults = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableStreamingResults);
+    }
+};
+
 } // namespace main
 } // namespace kuzu
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "common/profiler.h"
+#include "processor/physical_plan.h"
+#include "processor/result_stream.h"
+
+namespace kuzu {
+namespace main {
+
+class ClientContext;
+
+/*
+ * StreamingQuery owns the execution of a read-only query whose results are streamed, i.e., produced
+ * on demand while its QueryResult is being read. The transaction of the query stays active until
+ * all results have been read, the QueryResult is destroyed, or the next query runs over the same
+ * connection, whichever comes first. Then the query finishes and its auto-commit transaction is
+ * committed.
+ */
+class StreamingQuery {
+public:
+    StreamingQuery(ClientContext* clientContext, std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        std::unique_ptr<processor::ResultStream> resultStream);
+
+    // Returns the next table of results, or nullptr once all results have been read. Errors of the
+    // query roll back its transaction and are rethrown.
+    std::shared_ptr<processor::FactorizedTable> getNextTable();
+    // Stops executing the query. Does nothing if the query has already finished.
+    void finish();
+
+private:
+    void finishNoLock(bool success);
+
+private:
+    std::mutex mtx;
+    ClientContext* clientContext;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    std::unique_ptr<processor::ResultStream> resultStream;
+    bool finished;
+    bool exhausted;
+};
+
+} // namespace main
+} // namespace kuzu
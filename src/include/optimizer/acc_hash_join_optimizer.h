@@ -19,6 +19,8 @@ private:
 
     bool tryProbeToBuildHJSIP(planner::LogicalOperator* op);
     bool tryBuildToProbeHJSIP(planner::LogicalOperator* op);
+    // Pushes a filter on build side keys into the probe side scan of a non-ID key.
+    void tryBuildToProbeKeyFilter(planner::LogicalOperator* op);
 
     void visitIntersect(planner::LogicalOperator* op) override;
 
@@ -36,6 +38,11 @@ private:
     // most one match because rel table is scanned exactly once.
     std::vector<planner::LogicalOperator*> resolveShortestPathExtendToApplySemiMask(
         const binder::Expression& nodeID, planner::LogicalOperator* root);
+    // Find the ScanNodeProperty which scans parameter key, and whose output reaches root within
+    // the same pipeline through operators that preserve or drop (but not add) tuples. Returns
+    // nullptr if there is no such scan.
+    planner::LogicalOperator* resolveScanNodePropertyToApplyKeyFilter(
+        const binder::Expression& key, planner::LogicalOperator* root);
 
     std::shared_ptr<planner::LogicalOperator> appendNodeSemiMasker(
         std::vector<planner::LogicalOperator*> opsToApplySemiMask,
@@ -3,6 +3,10 @@
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
 namespace optimizer {
 
 struct PredicateSet {
@@ -31,9 +35,11 @@ private:
 
 class FilterPushDownOptimizer {
 public:
-    FilterPushDownOptimizer() { predicateSet = PredicateSet(); }
-    explicit FilterPushDownOptimizer(PredicateSet predicateSet)
-        : predicateSet{std::move(predicateSet)} {}
+    explicit FilterPushDownOptimizer(main::ClientContext* context) : context{context} {
+        predicateSet = PredicateSet();
+    }
+    FilterPushDownOptimizer(main::ClientContext* context, PredicateSet predicateSet)
+        : context{context}, predicateSet{std::move(predicateSet)} {}
 
     void rewrite(planner::LogicalPlan* plan);
 
@@ -57,13 +63,25 @@ private:
     std::shared_ptr<planner::LogicalOperator> visitScanNodePropertyReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
 
+    // Rewrite SCAN_NODE_ID as PROPERTY_INDEX_SCAN if there are comparisons between an indexed
+    // property of the node and a literal or parameter. Equality is preferred over ranges. The
+    // comparisons are kept and still evaluated on top of the scan. Returns nullptr if no index
+    // can be used.
+    std::shared_ptr<planner::LogicalOperator> getPropertyIndexScan(
+        std::shared_ptr<binder::Expression> nodeID, common::table_id_t tableID);
+
     // Rewrite SCAN_NODE_ID->SCAN_NODE_PROPERTY->FILTER as
     // SCAN_NODE_ID->(SCAN_NODE_PROPERTY->FILTER)*->SCAN_NODE_PROPERTY
     // so that filter with higher selectivity is applied before scanning.
     std::shared_ptr<planner::LogicalOperator> pushDownToScanNode(
         std::shared_ptr<binder::Expression> nodeID, std::vector<common::table_id_t> tableIDs,
         std::shared_ptr<binder::Expression> predicate,
-        std::shared_ptr<planner::LogicalOperator> child);
+        std::shared_ptr<planner::LogicalOperator> child,
+        binder::expression_vector& zoneMapPredicates);
+
+    // Collect comparisons between a property of the node and a literal of the same type, which
+    // can be checked against zone maps.
+    binder::expression_vector getZoneMapPredicates(const binder::Expression& nodeID);
 
     // Finish the current push down optimization by apply remaining predicates as a single filter.
     // And heuristically reorder equality predicates first in the filter.
@@ -73,14 +91,17 @@ private:
         const binder::expression_vector& predicates,
         std::shared_ptr<planner::LogicalOperator> child);
 
+    // Zone map predicates are moved into the scan if one is appended.
     std::shared_ptr<planner::LogicalOperator> appendScanNodeProperty(
         std::shared_ptr<binder::Expression> nodeID, std::vector<common::table_id_t> nodeTableIDs,
-        binder::expression_vector properties, std::shared_ptr<planner::LogicalOperator> child);
+        binder::expression_vector properties, std::shared_ptr<planner::LogicalOperator> child,
+        binder::expression_vector& zoneMapPredicates);
     std::shared_ptr<planner::LogicalOperator> appendFilter(
         std::shared_ptr<binder::Expression> predicate,
         std::shared_ptr<planner::LogicalOperator> child);
 
 private:
+    main::ClientContext* context;
     PredicateSet predicateSet;
 };
 
@@ -20,6 +20,9 @@ private:
     inline void visitCreateMacro(const Statement& /*statement*/) override { readOnly = false; }
     inline void visitCommentOn(const Statement& /*statement*/) override { readOnly = false; }
 
+    // Creating and dropping indexes changes the catalog.
+    void visitInQueryCall(const ReadingClause* readingClause) override;
+
     inline void visitUpdatingClause(const UpdatingClause* /*updatingClause*/) override {
         readOnly = false;
     }
@@ -26,7 +26,8 @@ public:
         : LogicalOperator{LogicalOperatorType::HASH_JOIN, std::move(probeSideChild),
               std::move(buildSideChild)},
           joinConditions(std::move(joinConditions)), joinType{joinType}, mark{std::move(mark)},
-          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY} {}
+          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY},
+          scanToApplyKeyFilter{nullptr} {}
 
     f_group_pos_set getGroupsPosToFlattenOnProbeSide();
     f_group_pos_set getGroupsPosToFlattenOnBuildSide();
@@ -53,6 +54,11 @@ public:
     inline void setJoinSubPlanSolveOrder(JoinSubPlanSolveOrder order_) { order = order_; }
     inline JoinSubPlanSolveOrder getJoinSubPlanSolveOrder() const { return order; }
 
+    // A ScanNodeProperty on the probe side that scans the (single) probe key. A filter on build
+    // side keys is pushed into it, see HashJoinSIPOptimizer::tryBuildToProbeKeyFilter.
+    inline void setScanToApplyKeyFilter(LogicalOperator* op) { scanToApplyKeyFilter = op; }
+    inline LogicalOperator* getScanToApplyKeyFilter() const { return scanToApplyKeyFilter; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalHashJoin>(joinConditions, joinType, mark, children[0]->copy(),
             children[1]->copy());
@@ -77,6 +83,7 @@ private:
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SidewaysInfoPassing sip;
     JoinSubPlanSolveOrder order; // sip introduce join dependency
+    LogicalOperator* scanToApplyKeyFilter;
 };
 
 } // namespace planner
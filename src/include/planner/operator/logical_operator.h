@@ -43,6 +43,7 @@ enum class LogicalOperatorType : uint8_t {
     PARTITIONER,
     PATH_PROPERTY_PROBE,
     PROJECTION,
+    PROPERTY_INDEX_SCAN,
     RECURSIVE_EXTEND,
     SCAN_FILE,
     SCAN_FRONTIER,
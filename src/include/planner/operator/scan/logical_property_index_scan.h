@@ -0,0 +1,57 @@
+#pragma once
+
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// One side of the range of a property index scan. The value is evaluated once per input tuple.
+struct PropertyIndexBound {
+    std::shared_ptr<binder::Expression> value;
+    bool inclusive;
+
+    PropertyIndexBound() : value{nullptr}, inclusive{false} {}
+    PropertyIndexBound(std::shared_ptr<binder::Expression> value, bool inclusive)
+        : value{std::move(value)}, inclusive{inclusive} {}
+
+    inline bool isUnbounded() const { return value == nullptr; }
+};
+
+// Scans the nodes of a single node table whose value of an indexed property lies within a range.
+// Node IDs are produced into a new data chunk as the range may match any number of nodes.
+class LogicalPropertyIndexScan : public LogicalOperator {
+public:
+    LogicalPropertyIndexScan(std::shared_ptr<binder::Expression> nodeID,
+        common::table_id_t tableID, std::shared_ptr<binder::Expression> property,
+        PropertyIndexBound lowerBound, PropertyIndexBound upperBound,
+        std::shared_ptr<LogicalOperator> child)
+        : LogicalOperator{LogicalOperatorType::PROPERTY_INDEX_SCAN, std::move(child)},
+          nodeID{std::move(nodeID)}, tableID{tableID}, property{std::move(property)},
+          lowerBound{std::move(lowerBound)}, upperBound{std::move(upperBound)} {}
+
+    void computeFactorizedSchema() override;
+    void computeFlatSchema() override;
+
+    std::string getExpressionsForPrinting() const override;
+
+    inline std::shared_ptr<binder::Expression> getNodeID() const { return nodeID; }
+    inline common::table_id_t getTableID() const { return tableID; }
+    inline std::shared_ptr<binder::Expression> getProperty() const { return property; }
+    inline const PropertyIndexBound& getLowerBound() const { return lowerBound; }
+    inline const PropertyIndexBound& getUpperBound() const { return upperBound; }
+
+    inline std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalPropertyIndexScan>(nodeID, tableID, property, lowerBound,
+            upperBound, children[0]->copy());
+    }
+
+private:
+    std::shared_ptr<binder::Expression> nodeID;
+    common::table_id_t tableID;
+    std::shared_ptr<binder::Expression> property;
+    PropertyIndexBound lowerBound;
+    PropertyIndexBound upperBound;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -26,15 +26,25 @@ public:
     inline std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
     inline binder::expression_vector getProperties() const { return properties; }
 
+    // Comparisons between a property and a literal, which are checked against zone maps to skip
+    // node groups without any match. The comparisons are still evaluated by a filter on top.
+    inline void setZoneMapPredicates(binder::expression_vector predicates) {
+        zoneMapPredicates = std::move(predicates);
+    }
+    inline binder::expression_vector getZoneMapPredicates() const { return zoneMapPredicates; }
+
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalScanNodeProperty>(nodeID, nodeTableIDs, properties,
+        auto op = make_unique<LogicalScanNodeProperty>(nodeID, nodeTableIDs, properties,
             children[0]->copy());
+        op->zoneMapPredicates = zoneMapPredicates;
+        return op;
     }
 
 private:
     std::shared_ptr<binder::Expression> nodeID;
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
+    binder::expression_vector zoneMapPredicates;
 };
 
 } // namespace planner
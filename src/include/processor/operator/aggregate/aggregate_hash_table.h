@@ -61,6 +61,16 @@ public:
 
     uint64_t getNumEntries() const { return factorizedTable->getNumTuples(); }
 
+    //! memory held by entries and hash slots
+    uint64_t getMemoryUsage() const {
+        return getNumEntries() * factorizedTable->getTableSchema()->getNumBytesPerTuple() +
+               hashSlotsBlocks.size() * HASH_BLOCK_SIZE;
+    }
+
+    //! entries can be written out and read back as raw bytes only if they hold no pointers, i.e.
+    //! all keys are fixed-sized and no aggregate state refers to memory outside of the entry
+    bool isSpillable() const;
+
     void append(const std::vector<common::ValueVector*>& flatKeyVectors,
         const std::vector<common::ValueVector*>& unFlatKeyVectors,
         common::DataChunkState* leadingState, const std::vector<AggregateInput>& aggregateInputs,
@@ -82,6 +92,20 @@ public:
 
     //! merge aggregate hash table by combining aggregate states under the same key
     void merge(AggregateHashTable& other);
+    //! merge only the entries of other that belong to the given hash partition
+    void merge(AggregateHashTable& other, uint64_t partitionIdx, uint64_t numPartitionsLog2);
+    //! merge entries stored in a factorizedTable with the same layout, e.g. spilled entries
+    void merge(const FactorizedTable& table);
+
+    //! create an empty hash table with the same layout and aggregate functions
+    virtual std::unique_ptr<AggregateHashTable> createEmptyCopy(
+        uint64_t numEntriesToAllocate) const;
+
+    //! partitions are decided by the highest bits of the hash, which are independent of the
+    //! lowest bits used for slot indexes
+    static inline uint64_t getPartitionIdx(common::hash_t hash, uint64_t numPartitionsLog2) {
+        return hash >> (64 - numPartitionsLog2);
+    }
 
     void finalizeAggregateStates();
 
@@ -104,6 +128,9 @@ protected:
         uint64_t& numNoMatches, uint32_t colIdx);
 
 private:
+    template<typename FILTER_FUNC>
+    void mergeIf(const FactorizedTable& table, FILTER_FUNC filter);
+
     void initializeFT(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
         std::unique_ptr<FactorizedTableSchema> tableSchema);
@@ -214,8 +241,10 @@ protected:
     std::unique_ptr<uint64_t[]> entryIdxesToInitialize;
     std::unique_ptr<HashSlot*[]> hashSlotsToUpdateAggState;
 
-private:
     std::vector<common::LogicalType> payloadTypes;
+
+private:
+    std::vector<common::LogicalType> distinctAggKeyTypes;
     std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions;
 
     //! special handling of distinct aggregate
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include "common/constants.h"
+#include "common/file_system/virtual_file_system.h"
+#include "processor/operator/aggregate/aggregate_hash_table.h"
+
+namespace kuzu {
+namespace processor {
+
+/**
+ * AggregateSpiller writes entries of aggregate hash tables to a temporary file when they no longer
+ * fit in memory, and merges them back one hash partition at a time.
+ *
+ * Entries are written as raw bytes in runs of at most SPILL_RUN_SIZE bytes. All entries of a run
+ * belong to the same partition, which is decided by the highest bits of their hash (see
+ * AggregateHashTable::getPartitionIdx), so merging a partition only reads the runs of that
+ * partition. Only spillable hash tables (see AggregateHashTable::isSpillable) can be spilled.
+ * The temporary file is removed when the spiller is destroyed.
+ */
+class AggregateSpiller {
+public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 4;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    static constexpr uint64_t SPILL_RUN_SIZE = common::BufferPoolConstants::PAGE_256KB_SIZE;
+
+    AggregateSpiller(common::VirtualFileSystem* vfs, std::string filePath)
+        : vfs{vfs}, filePath{std::move(filePath)}, fileSize{0}, numSpilledTuples{0} {}
+    ~AggregateSpiller();
+
+    // Writes all entries of hashTable to the spill file. Can be called by multiple threads.
+    void spill(AggregateHashTable& hashTable);
+
+    // Merges all spilled entries of the given partition into hashTable.
+    void mergePartition(uint64_t partitionIdx, AggregateHashTable& hashTable,
+        storage::MemoryManager& memoryManager);
+
+    uint64_t getNumSpilledTuples() const { return numSpilledTuples.load(); }
+    uint64_t getNumSpilledBytes() const { return fileSize.load(); }
+
+private:
+    struct SpilledRun {
+        uint64_t offset;
+        uint64_t numTuples;
+    };
+
+    void writeRun(uint64_t partitionIdx, const uint8_t* data, uint64_t numTuples,
+        uint64_t numBytesPerTuple);
+
+private:
+    common::VirtualFileSystem* vfs;
+    std::string filePath;
+    std::mutex mtx;
+    std::unique_ptr<common::FileInfo> fileInfo;
+    std::atomic<uint64_t> fileSize;
+    std::atomic<uint64_t> numSpilledTuples;
+    std::array<std::vector<SpilledRun>, NUM_PARTITIONS> spilledRuns;
+};
+
+} // namespace processor
+} // namespace kuzu
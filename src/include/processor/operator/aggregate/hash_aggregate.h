@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+
 #include "aggregate_hash_table.h"
+#include "aggregate_spiller.h"
 #include "processor/operator/aggregate/base_aggregate.h"
 
 namespace kuzu {
@@ -8,29 +11,68 @@ namespace processor {
 
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): This is a final class.
 class HashAggregateSharedState final : public BaseAggregateSharedState {
+    // Local hash tables with fewer entries in total are merged by a single thread.
+    static constexpr uint64_t MIN_NUM_ENTRIES_PER_PARTITION = 1 << 16;
+    static constexpr uint64_t MAX_NUM_PARTITIONS_LOG2 = 6;
 
 public:
     explicit HashAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
+        : BaseAggregateSharedState{aggregateFunctions}, numPartitionsLog2{0},
+          nextPartitionIdxToMerge{0}, numMergedPartitions{0}, nextMorselIdxToRead{0},
+          numMorselsToRead{0}, numSpilledTuples{0}, numSpilledBytes{0} {}
 
     void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
 
+    // Writes all entries of a local hash table to a temporary file under the database directory.
+    // Spilled entries are merged back partition by partition in mergePartitions().
+    void spillAggregateHashTable(AggregateHashTable& aggregateHashTable,
+        main::ClientContext* context);
+
+    // Decides how local hash tables are combined. If there are few entries, local hash tables are
+    // merged and finalized right away. Otherwise, the merge is split into hash partitions, which
+    // are merged lazily through mergePartitions().
     void combineAggregateHashTable(storage::MemoryManager& memoryManager);
 
-    void finalizeAggregateHashTable();
+    // Merges and finalizes partitions until no partition is left, then waits for other threads to
+    // finish theirs. Can be called by any number of threads.
+    void mergePartitions();
+
+    // Returns the next range of entries to read as (partition, startOffset, endOffset).
+    std::tuple<AggregateHashTable*, uint64_t, uint64_t> getNextRangeToRead();
 
-    std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    uint64_t getNumTuples();
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
+    double getProgress() const;
 
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+    uint64_t getNumSpilledTuples() const { return numSpilledTuples; }
+    uint64_t getNumSpilledBytes() const { return numSpilledBytes; }
 
-    uint64_t getCurrentOffset() const { return currentOffset; }
+private:
+    void mergePartition(uint64_t partitionIdx);
+    void initMorselsToRead();
 
 private:
     std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
-    std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+    // Each partition holds the global aggregation result of the keys whose hash falls into it.
+    std::vector<std::unique_ptr<AggregateHashTable>> globalPartitions;
+    uint64_t numPartitionsLog2;
+    std::atomic<uint64_t> nextPartitionIdxToMerge;
+    std::atomic<uint64_t> numMergedPartitions;
+    // Scanning is split into morsels of at most DEFAULT_VECTOR_CAPACITY entries within a
+    // partition. morselEndIdxes[i] is the (exclusive) end morsel index of partition i.
+    std::once_flag initMorselsFlag;
+    std::vector<uint64_t> morselEndIdxes;
+    std::atomic<uint64_t> nextMorselIdxToRead;
+    // Published once morselEndIdxes is complete, so that progress can be reported while other
+    // threads are still merging.
+    std::atomic<uint64_t> numMorselsToRead;
+    // Created on the first spill, and destroyed (removing the spill file) once all partitions are
+    // merged.
+    std::unique_ptr<AggregateSpiller> spiller;
+    storage::MemoryManager* memoryManager = nullptr;
+    uint64_t numSpilledTuples;
+    uint64_t numSpilledBytes;
 };
 
 struct HashAggregateInfo {
@@ -52,6 +94,8 @@ struct HashAggregateLocalState {
     std::vector<common::ValueVector*> dependentKeyVectors;
     common::DataChunkState* leadingState;
     std::unique_ptr<AggregateHashTable> aggregateHashTable;
+    // The local hash table is spilled once it holds more memory than this.
+    uint64_t spillThreshold;
 
     void init(ResultSet& resultSet, main::ClientContext* context, HashAggregateInfo& info,
         std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
@@ -60,6 +104,9 @@ struct HashAggregateLocalState {
 };
 
 class HashAggregate : public BaseAggregate {
+    // Fraction of the buffer pool that local hash tables of all threads may hold before spilling.
+    static constexpr double SPILL_MEMORY_FRACTION = 0.25;
+
 public:
     HashAggregate(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::shared_ptr<HashAggregateSharedState> sharedState, HashAggregateInfo hashInfo,
@@ -76,6 +123,9 @@ public:
 
     void finalize(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashAggregate>(resultSetDescriptor->copy(), sharedState, hashInfo,
             cloneAggFunctions(), copyVector(aggInfos), children[0]->clone(), id, paramsString);
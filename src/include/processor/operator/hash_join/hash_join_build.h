@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
@@ -15,22 +18,96 @@ class HashJoinBuild;
 // Each clone of these two operators will share the same state.
 // Inside the state, we keep the materialized tuples in factorizedTable, which are merged by each
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
-// a global htDirectory, which will be updated by the last thread in the hash join build side
-// task/pipeline, and probed by the HashJoinProbe operators.
+// a global htDirectory, which is allocated by the last thread in the hash join build side
+// task/pipeline. Filling the htDirectory is deferred to the threads of the pipeline consuming the
+// hash table (e.g. HashJoinProbe), which grab tuple blocks as morsels and insert them in parallel.
+//
+// If spilling is enabled and the build side outgrows spillMemoryThreshold, all build side tuples
+// are spilled to disk partitioned by their hashes, and the global hash table stays empty. Spilled
+// partitions are then grouped such that each group fits in memory. HashJoinProbe threads spill the
+// probe side with the same partitioning, and then join it with one partition group at a time
+// (grace hash join). Only one partition group is held in memory: all probers work on its probe
+// runs, and the group is only replaced by the next one once all of them are probed.
 class HashJoinSharedState {
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+        : hashTable{std::move(hashTable)}, nextBlockIdxToBuild{0}, numBuiltBlocks{0},
+          spillMemoryThreshold{UINT64_MAX}, numBytesInMemory{0}, spilling{false} {};
 
     virtual ~HashJoinSharedState() = default;
 
     void mergeLocalHashTable(JoinHashTable& localHashTable);
 
+    // Should only be enabled if both sides of the join consist of flat and fixed-sized values.
+    inline void enableSpilling(uint64_t memoryThreshold) { spillMemoryThreshold = memoryThreshold; }
+    inline bool canSpill() const { return spillMemoryThreshold != UINT64_MAX; }
+    inline bool isSpilling() const { return spilling.load(); }
+    // Keeps track of memory held by build side tuples, and starts spilling once it exceeds
+    // spillMemoryThreshold.
+    void updateMemoryUsage(int64_t numBytes);
+    HashJoinSpiller* getSpiller(main::ClientContext* context);
+    void appendSpilledRuns(PartitionedRowWriter& writer);
+    // Spills tuples merged before spilling started and groups spilled partitions.
+    void finalizeSpilling(main::ClientContext* context);
+
+    // Should be called by each HashJoinProbe thread before it spills probe side tuples.
+    void registerSpillingProber();
+    // Takes over the spilled probe runs of a thread once its probe side is exhausted. The writer is
+    // null if the thread stopped before that.
+    void finishProbeSpilling(PartitionedRowWriter* writer);
+    // Waits until all probers have spilled their probe side, and returns the next probe run to join
+    // together with the hash table of its partition group. Partition groups are loaded one at a
+    // time, and only once every run of the previous group is handed back through
+    // finishSpilledProbeRun(). Returns false once all runs are taken.
+    bool getNextSpilledProbeRun(SpilledRun& run, JoinHashTable*& groupHashTable);
+    void finishSpilledProbeRun();
+    uint64_t getNumSpilledBytes();
+
+    // Creates a filter on build side keys, which is filled while hash slots are built. Should only
+    // be used by inner joins with a single key.
+    inline JoinKeyFilter* enableKeyFilter() {
+        keyFilter = std::make_unique<JoinKeyFilter>();
+        return keyFilter.get();
+    }
+
+    // Allocates the htDirectory. Should be called once after all tuples are merged.
+    void initHashSlots();
+    // Inserts tuple blocks into the htDirectory until no block is left, then waits for other
+    // threads to finish their blocks. Can be called by any number of threads.
+    void buildHashSlots();
+
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+private:
+    std::unique_ptr<JoinHashTable> loadPartitionGroup(uint64_t groupIdx);
+    // Replaces the partition group in memory by the next one that has probe runs. Loading happens
+    // outside the lock, while other probers wait.
+    void advancePartitionGroup(std::unique_lock<std::mutex>& lck);
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    std::atomic<uint64_t> nextBlockIdxToBuild;
+    std::atomic<uint64_t> numBuiltBlocks;
+    std::unique_ptr<JoinKeyFilter> keyFilter;
+
+    uint64_t spillMemoryThreshold;
+    std::atomic<uint64_t> numBytesInMemory;
+    std::atomic<bool> spilling;
+    std::unique_ptr<HashJoinSpiller> spiller;
+    std::array<std::vector<SpilledRun>, HashJoinSpiller::NUM_PARTITIONS> spilledRuns;
+    // partitionGroupEndIdxes[i] is the (exclusive) end partition index of group i.
+    std::vector<uint64_t> partitionGroupEndIdxes;
+    // Probe side runs, which are only complete once numSpillingProbers drops to zero.
+    std::array<std::vector<SpilledRun>, HashJoinSpiller::NUM_PARTITIONS> spilledProbeRuns;
+    uint64_t numSpillingProbers = 0;
+    // The partition group currently in memory, and its probe runs that are not handed out yet.
+    uint64_t nextGroupIdx = 0;
+    bool isLoadingGroup = false;
+    std::unique_ptr<JoinHashTable> groupHashTable;
+    std::vector<SpilledRun> groupProbeRuns;
+    uint64_t nextGroupProbeRunIdx = 0;
+    uint64_t numGroupProbeRunsInProgress = 0;
 };
 
 class HashJoinBuildInfo {
@@ -61,6 +138,8 @@ private:
 };
 
 class HashJoinBuild : public Sink {
+    static constexpr uint64_t MEMORY_REPORT_STEP = common::BufferPoolConstants::PAGE_256KB_SIZE;
+
 public:
     HashJoinBuild(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::shared_ptr<HashJoinSharedState> sharedState, std::unique_ptr<HashJoinBuildInfo> info,
@@ -93,6 +172,8 @@ protected:
 
 private:
     void setKeyState(common::DataChunkState* state);
+    void spillIfNecessary(ExecutionContext* context);
+    void spillLocalHashTable(ExecutionContext* context);
 
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
@@ -104,6 +185,8 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+    uint64_t numReportedBytes = 0;
+    std::unique_ptr<PartitionedRowWriter> spillWriter;
 };
 
 } // namespace processor
@@ -36,6 +36,7 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        spillDataPos = other.spillDataPos;
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -44,6 +45,25 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Probe side vectors that make up a probe tuple. Only set if spilling is enabled.
+    std::vector<DataPos> spillDataPos;
+};
+
+// Probe tuples are spilled if the build side is spilled. Once the probe side is exhausted, spilled
+// probe runs of all threads are read back and joined with one partition group of the build side at
+// a time.
+struct ProbeSpillState {
+    HashJoinSpiller* spiller = nullptr;
+    std::unique_ptr<PartitionedRowWriter> writer;
+    std::vector<common::ValueVector*> vectors;
+    std::vector<common::DataChunkState*> states;
+    std::shared_ptr<common::SelectionVector> selVector;
+    bool isReadingSpilledTuples = false;
+    // Whether the run being read was taken from the shared state and not handed back yet.
+    bool hasRunInProgress = false;
+    std::unique_ptr<uint8_t[]> runBuffer;
+    uint64_t numTuplesInRun = 0;
+    uint64_t nextTupleIdx = 0;
 };
 
 // Probe side on left, i.e. children[0] and build side on right, i.e. children[1]
@@ -67,16 +87,29 @@ public:
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
           probeDataInfo{probeDataInfo} {}
 
+    // Hands back spilled work this thread still holds if it stopped early (e.g. once a LIMIT is
+    // reached or on an exception), so that other probers waiting on it can finish.
+    ~HashJoinProbe() override;
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashJoinProbe>(sharedState, joinType, flatProbe, probeDataInfo,
             children[0]->clone(), id, paramsString);
     }
 
 private:
+    bool getNextProbeTuple(ExecutionContext* context);
+    // Returns false if the tuple is not spilled, i.e. any of its keys is null.
+    bool spillProbeTuple();
+    bool readSpilledProbeTuple();
+    bool readNextSpilledRun();
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -101,6 +134,9 @@ private:
     bool flatProbe;
 
     ProbeDataInfo probeDataInfo;
+    // Either the global hash table, or the partition group being probed if it is spilled.
+    JoinHashTable* hashTable;
+    std::unique_ptr<ProbeSpillState> spillState;
     std::vector<common::ValueVector*> vectorsToReadInto;
     std::vector<uint32_t> columnIdxsToReadFrom;
     std::vector<common::ValueVector*> keyVectors;
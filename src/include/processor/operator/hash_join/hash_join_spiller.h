@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+struct SpilledRun {
+    uint64_t offset;
+    uint64_t numRows;
+};
+
+/**
+ * HashJoinSpiller holds the temporary file that both sides of a hash join are spilled to once the
+ * build side no longer fits in memory.
+ *
+ * Rows are partitioned by the highest bits of their hash, and written in runs of at most
+ * SPILL_RUN_SIZE bytes, each holding rows of a single partition. Runs of the build side and the
+ * probe side share the same file; their owners keep track of where the runs are.
+ * The temporary file is removed when the spiller is destroyed.
+ */
+class HashJoinSpiller {
+public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 5;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    static constexpr uint64_t SPILL_RUN_SIZE = 64 * 1024;
+
+    HashJoinSpiller(common::VirtualFileSystem* vfs, std::string filePath)
+        : vfs{vfs}, filePath{std::move(filePath)}, fileSize{0} {}
+    ~HashJoinSpiller();
+
+    static inline uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - NUM_PARTITIONS_LOG2);
+    }
+
+    // Appends data at the end of the file and returns its offset. Can be called by multiple
+    // threads.
+    uint64_t write(const uint8_t* data, uint64_t numBytes);
+    void read(uint8_t* buffer, uint64_t numBytes, uint64_t offset);
+
+    uint64_t getNumSpilledBytes() const { return fileSize.load(); }
+
+private:
+    common::VirtualFileSystem* vfs;
+    std::string filePath;
+    std::mutex mtx;
+    std::unique_ptr<common::FileInfo> fileInfo;
+    std::atomic<uint64_t> fileSize;
+};
+
+// Buffers fixed-size rows per partition and writes them to the spiller in runs. Not thread-safe;
+// each thread uses its own writer.
+class PartitionedRowWriter {
+public:
+    PartitionedRowWriter(HashJoinSpiller* spiller, uint64_t numBytesPerRow);
+
+    // Returns the buffer to write the next row of the given partition into.
+    uint8_t* appendRow(uint64_t partitionIdx);
+    void flush();
+
+    inline uint64_t getNumBytesPerRow() const { return numBytesPerRow; }
+    inline std::vector<SpilledRun>& getRuns(uint64_t partitionIdx) { return runs[partitionIdx]; }
+
+private:
+    void flushPartition(uint64_t partitionIdx);
+
+private:
+    HashJoinSpiller* spiller;
+    uint64_t numBytesPerRow;
+    uint64_t maxNumRowsPerRun;
+    std::array<std::unique_ptr<uint8_t[]>, HashJoinSpiller::NUM_PARTITIONS> buffers;
+    std::array<uint64_t, HashJoinSpiller::NUM_PARTITIONS> numRowsInBuffers;
+    std::array<std::vector<SpilledRun>, HashJoinSpiller::NUM_PARTITIONS> runs;
+};
+
+} // namespace processor
+} // namespace kuzu
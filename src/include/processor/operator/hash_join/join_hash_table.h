@@ -1,5 +1,7 @@
 #pragma once
 
+#include "processor/operator/hash_join/hash_join_spiller.h"
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/result/base_hash_table.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -21,10 +23,15 @@ public:
         std::vector<common::ValueVector*> payloadVectors);
 
     void allocateHashSlots(uint64_t numTuples);
-    void buildHashSlots();
+    // Inserts all tuples of the given tuple block into hash slots, and their hashes into keyFilter
+    // if given. Different blocks can be inserted concurrently.
+    void buildHashSlots(uint64_t tupleBlockIdx, JoinKeyFilter* keyFilter = nullptr);
 
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector* hashVector,
         common::ValueVector* tmpHashVector, uint8_t** probedTuples);
+    // Computes the same hashes of (non-null) keys as the ones stored in the hash table.
+    static void computeKeyHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector* hashVector, common::ValueVector* tmpHashVector);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
     // given key tuple.
     common::sel_t matchFlatKeys(const std::vector<common::ValueVector*>& keyVectors,
@@ -39,6 +46,16 @@ public:
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
     uint64_t getNumTuples() { return factorizedTable->getNumTuples(); }
+    uint64_t getNumTupleBlocks() { return factorizedTable->getTupleDataBlocks().size(); }
+    uint64_t getMemoryUsage() { return getNumTuples() * tableSchema->getNumBytesPerTuple(); }
+
+    // Spilling requires all columns to be flat and fixed-sized, so that tuples can be written out
+    // as raw bytes. spill() writes all tuples partitioned by their hashes and clears the table.
+    void spill(PartitionedRowWriter& writer);
+    void appendSpilledTuples(const uint8_t* tuples, uint64_t numTuples);
+    // Creates an empty hash table with the same layout, which can hold tuples spilled from any
+    // hash table with this layout.
+    std::unique_ptr<JoinHashTable> createEmptyCopy() const;
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
@@ -52,8 +69,9 @@ public:
 
 private:
     uint8_t** findHashSlot(const uint8_t* tuple) const;
-    // This function returns the pointer that previously stored in the same slot.
-    uint8_t* insertEntry(uint8_t* tuple) const;
+    // Atomically replaces the slot with the given tuple and chains the previous slot entry to the
+    // prev pointer of the tuple.
+    void insertEntry(uint8_t* tuple) const;
 
     bool compareFlatKeys(const std::vector<common::ValueVector*>& keyVectors, const uint8_t* tuple);
 
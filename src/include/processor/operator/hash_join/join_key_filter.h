@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "common/data_chunk/sel_vector.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class ValueVector;
+}
+namespace processor {
+
+/**
+ * JoinKeyFilter is a Bloom filter on the hashes of the build side keys of a hash join. It is
+ * pushed into probe side scans (see ScanNodeTable), which drop tuples whose keys cannot have a
+ * match before reading any other column.
+ *
+ * The filter is blocked: each key sets NUM_BITS_PER_HASH bits within a single 64-bit word, so a
+ * lookup touches one word only. Keys are inserted while the hash slots are built, which can
+ * happen concurrently. The filter is disabled, i.e. should not be checked, until init() is called,
+ * and stays disabled if the build side is too large for the filter to be selective.
+ */
+class JoinKeyFilter {
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    static constexpr uint64_t MIN_NUM_BITS_PER_KEY = 8;
+    static constexpr uint64_t NUM_BITS_PER_HASH = 3;
+    static constexpr uint64_t MAX_NUM_WORDS = (uint64_t)1 << 21; // 16MB.
+
+public:
+    JoinKeyFilter() : enabled{false}, numWords{0} {}
+
+    // Should be called before any key is inserted, and before probing starts.
+    void init(uint64_t numKeys);
+    inline void disable() { enabled = false; }
+    inline bool isEnabled() const { return enabled; }
+
+    inline void insert(common::hash_t hash) {
+        words[hash & (numWords - 1)].fetch_or(getMask(hash), std::memory_order_relaxed);
+    }
+    inline bool mayContain(common::hash_t hash) const {
+        auto mask = getMask(hash);
+        return (words[hash & (numWords - 1)].load(std::memory_order_relaxed) & mask) == mask;
+    }
+
+    // Removes positions whose keys are null or cannot be found in the filter from selVector.
+    // hashVector is used to hold hashes of keys. Returns the number of remaining positions.
+    common::sel_t select(common::ValueVector& keyVector, common::ValueVector& hashVector,
+        common::SelectionVector& selVector) const;
+
+private:
+    static inline uint64_t getMask(common::hash_t hash) {
+        // The lowest bits of hash decide the word, so the bits to set are taken from the highest.
+        uint64_t mask = 0;
+        for (auto i = 1u; i <= NUM_BITS_PER_HASH; i++) {
+            mask |= (uint64_t)1 << ((hash >> (64 - 6 * i)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    bool enabled;
+    uint64_t numWords;
+    std::unique_ptr<std::atomic<uint64_t>[]> words;
+};
+
+} // namespace processor
+} // namespace kuzu
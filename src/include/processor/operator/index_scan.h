@@ -35,6 +35,8 @@ private:
 
     common::ValueVector* indexVector;
     common::ValueVector* outVector;
+    // Offsets of the nodes of the selected keys of indexVector.
+    std::array<common::offset_t, common::DEFAULT_VECTOR_CAPACITY> nodeOffsets;
 };
 
 } // namespace processor
@@ -40,9 +40,12 @@ public:
 private:
     // For each build side, probe its HT and return a vector of matched flat tuples.
     void probeHTs();
-    // Left is always the one with less num of values.
-    static void twoWayIntersect(common::nodeID_t* leftNodeIDs, common::SelectionVector& lSelVector,
-        common::nodeID_t* rightNodeIDs, common::SelectionVector& rSelVector);
+    // Left is always the one with less num of values. Matching left offsets are moved to the front
+    // of leftOffsets.
+    static void twoWayIntersect(common::offset_t* leftOffsets,
+        common::SelectionVector& lSelVector, bool isLeftDistinct,
+        const common::offset_t* rightOffsets, common::SelectionVector& rSelVector,
+        bool isRightDistinct);
     void intersectLists(const std::vector<common::overflow_value_t>& listsToIntersect);
     void populatePayloads(const std::vector<uint8_t*>& tuples,
         const std::vector<uint32_t>& listIdxes);
@@ -62,6 +65,9 @@ private:
     std::vector<std::shared_ptr<HashJoinSharedState>> sharedHTs;
     std::vector<bool> isIntersectListAFlatValue;
     std::vector<std::vector<uint8_t*>> probedFlatTuples;
+    // Offsets of the intersected lists, packed from their node IDs.
+    std::vector<common::offset_t> leftOffsets;
+    std::vector<common::offset_t> rightOffsets;
     // Keep track of the tuple to intersect for each build side.
     std::vector<uint32_t> tupleIdxPerBuildSide;
     // This is used to indicate which build side to increment the tuple idx for.
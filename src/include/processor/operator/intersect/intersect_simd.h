@@ -0,0 +1,28 @@
+#pragma once
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+// Intersection of two ascending lists of node offsets. Lists whose sizes differ by a large factor
+// are intersected by galloping through the larger one. Otherwise, blocks of both lists are
+// compared all-to-all with AVX2 if the CPU supports it, which is checked once at runtime. The
+// kernel requires lists without duplicates, so a scalar merge is used if either list may contain
+// duplicates, or if the CPU lacks AVX2. Wider AVX-512 blocks need twice as many shuffles per
+// block and are not faster.
+struct IntersectSIMD {
+    // Lists whose sizes differ by at least this factor are intersected by galloping.
+    static constexpr uint64_t GALLOPING_RATIO = 32;
+
+    // Writes the positions of the matching values in left and right to leftPositions and
+    // rightPositions, which must have room for min(leftSize, rightSize) positions, and returns
+    // the number of matches. As in a merge, each value of a list matches at most one value of the
+    // other.
+    static uint64_t intersect(const common::offset_t* left, uint64_t leftSize,
+        const common::offset_t* right, uint64_t rightSize, bool isDistinct,
+        common::sel_t* leftPositions, common::sel_t* rightPositions);
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -81,6 +81,9 @@ private:
         common::offset_t startOffset);
     static void setOffsetFromCSROffsets(storage::ColumnChunk& nodeOffsetChunk,
         storage::ColumnChunk& csrOffsetChunk);
+    static void sortCSRListsByNbrOffset(const storage::ChunkedNodeGroupCollection& partition,
+        const RelBatchInsertInfo& relInfo, const storage::ChunkedCSRHeader& csrHeader,
+        common::offset_t csrChunkCapacity);
 
     static std::optional<common::offset_t> checkRelMultiplicityConstraint(
         const storage::ChunkedCSRHeader& csrHeader, const RelBatchInsertInfo& relInfo);
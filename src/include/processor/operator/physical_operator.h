@@ -45,6 +45,7 @@ enum class PhysicalOperatorType : uint8_t {
     PATH_PROPERTY_PROBE,
     PROJECTION,
     PROFILE,
+    PROPERTY_INDEX_SCAN,
     READER,
     RECURSIVE_JOIN,
     RENAME_PROPERTY,
@@ -131,7 +132,7 @@ public:
 
     bool getNextTuple(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
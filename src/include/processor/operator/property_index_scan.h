@@ -0,0 +1,75 @@
+#pragma once
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/physical_operator.h"
+#include "storage/index/property_index.h"
+
+namespace kuzu {
+namespace processor {
+
+struct PropertyIndexScanInfo {
+    common::table_id_t tableID;
+    common::property_id_t propertyID;
+    // Evaluators of the bounds of the range, nullptr if the range is unbounded on that side.
+    std::unique_ptr<evaluator::ExpressionEvaluator> lowerBound;
+    bool lowerInclusive;
+    std::unique_ptr<evaluator::ExpressionEvaluator> upperBound;
+    bool upperInclusive;
+    DataPos outDataPos;
+
+    PropertyIndexScanInfo(common::table_id_t tableID, common::property_id_t propertyID,
+        std::unique_ptr<evaluator::ExpressionEvaluator> lowerBound, bool lowerInclusive,
+        std::unique_ptr<evaluator::ExpressionEvaluator> upperBound, bool upperInclusive,
+        const DataPos& outDataPos)
+        : tableID{tableID}, propertyID{propertyID}, lowerBound{std::move(lowerBound)},
+          lowerInclusive{lowerInclusive}, upperBound{std::move(upperBound)},
+          upperInclusive{upperInclusive}, outDataPos{outDataPos} {}
+    PropertyIndexScanInfo(const PropertyIndexScanInfo& other)
+        : tableID{other.tableID}, propertyID{other.propertyID},
+          lowerBound{other.lowerBound == nullptr ? nullptr : other.lowerBound->clone()},
+          lowerInclusive{other.lowerInclusive},
+          upperBound{other.upperBound == nullptr ? nullptr : other.upperBound->clone()},
+          upperInclusive{other.upperInclusive}, outDataPos{other.outDataPos} {}
+
+    inline std::unique_ptr<PropertyIndexScanInfo> copy() const {
+        return std::make_unique<PropertyIndexScanInfo>(*this);
+    }
+};
+
+// Looks up the nodes whose value of an indexed property lies within the range of each input
+// tuple in the snapshot of the index. Matching nodes are sorted by offset and produced in batches
+// of nodes from the same node group. Property index scan does not run in parallel.
+class PropertyIndexScan : public PhysicalOperator {
+public:
+    PropertyIndexScan(std::unique_ptr<PropertyIndexScanInfo> info,
+        storage::PropertyIndexCache* cache, std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        const std::string& paramsString)
+        : PhysicalOperator{PhysicalOperatorType::PROPERTY_INDEX_SCAN, std::move(child), id,
+              paramsString},
+          info{std::move(info)}, cache{cache}, nextIdx{0} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    inline std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<PropertyIndexScan>(info->copy(), cache, children[0]->clone(), id,
+            paramsString);
+    }
+
+private:
+    void lookup(ExecutionContext* context);
+
+private:
+    std::unique_ptr<PropertyIndexScanInfo> info;
+    storage::PropertyIndexCache* cache;
+
+    common::ValueVector* outVector;
+    // Offsets of the nodes matching the current input tuple, and the position of the next one to
+    // output.
+    std::vector<common::offset_t> nodeOffsets;
+    uint64_t nextIdx;
+};
+
+} // namespace processor
+} // namespace kuzu
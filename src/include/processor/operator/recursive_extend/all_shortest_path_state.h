@@ -24,7 +24,7 @@ public:
     }
 
     inline void markSrc(common::nodeID_t nodeID) override {
-        visitedNodeToDistance.insert({nodeID, -1});
+        visitedNodeToDistance.insert(nodeID, -1);
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
@@ -33,8 +33,8 @@ public:
 
     void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) final {
-        if (!visitedNodeToDistance.contains(nbrNodeID)) {
-            visitedNodeToDistance.insert({nbrNodeID, (int64_t)currentLevel});
+        auto [distance, inserted] = visitedNodeToDistance.insert(nbrNodeID, currentLevel);
+        if (inserted) {
             if (targetDstNodes->contains(nbrNodeID)) {
                 minDistance = currentLevel;
                 numVisitedDstNodes++;
@@ -44,7 +44,7 @@ public:
             } else {
                 nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity);
             }
-        } else if (currentLevel <= visitedNodeToDistance.at(nbrNodeID)) {
+        } else if (currentLevel <= *distance) {
             if constexpr (TRACK_PATH) {
                 nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
             } else {
@@ -53,6 +53,11 @@ public:
         }
     }
 
+    inline bool isVisited(common::nodeID_t nodeID) const final {
+        return visitedNodeToDistance.contains(nodeID);
+    }
+    inline uint64_t getNumVisitedNodes() const final { return visitedNodeToDistance.size(); }
+
 private:
     inline bool isAllDstReachedWithMinDistance() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes() && currentLevel > minDistance;
@@ -61,7 +66,7 @@ private:
 private:
     uint32_t minDistance; // Min distance to add dst nodes that have been reached.
     uint64_t numVisitedDstNodes;
-    frontier::node_id_map_t<int64_t> visitedNodeToDistance;
+    frontier::NodeIDMap<int64_t> visitedNodeToDistance;
 };
 
 } // namespace processor
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <span>
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+// An edge found by extending a node of the current frontier.
+struct FrontierEdge {
+    common::nodeID_t boundNodeID;
+    common::nodeID_t nbrNodeID;
+    common::relID_t relID;
+    uint64_t boundNodeMultiplicity;
+    // Only set for weighted BFSs.
+    double weight = 0;
+};
+
+// A range of nodes of the current frontier, which is extended by a single thread. Morsels of bottom
+// up steps hold unvisited nodes instead, which are extended over their rels in the opposite
+// direction.
+struct BFSMorsel {
+    uint64_t morselIdx = 0;
+    uint8_t level = 0;
+    bool isBottomUp = false;
+    std::span<const common::nodeID_t> nodeIDs;
+};
+
+// The node tables whose unvisited nodes are extended by bottom up steps, and their number of
+// nodes.
+struct BottomUpInfo {
+    std::vector<std::pair<common::table_id_t, uint64_t>> tableIDAndNumNodes;
+    uint64_t numNodes = 0;
+};
+
+/*
+ * BFSSharedState drives the BFS from a single source, so that the frontier of each level can be
+ * extended in parallel by the thread owning the source and by threads which have run out of
+ * sources (see RecursiveJoinSharedState). Threads take morsels of the current frontier, extend them
+ * through their own recursive plan, and hand back the edges they found. The edges of each morsel
+ * are applied to the BFS state in morsel order, i.e., in the same order as a single thread would
+ * extend the frontier, so the result does not depend on the number of threads.
+ * Once all morsels of a level have been applied, the level is finalized by the thread which
+ * applied the last morsel, and the morsels of the next level are handed out. Levels of weighted
+ * BFSs are rounds of a Bellman-Ford search instead, see WeightedShortestPathState.
+ *
+ * Shortest path BFSs switch between top down and bottom up levels if bottom up info is given. A
+ * top down level extends the nodes of the frontier, while a bottom up level extends the unvisited
+ * nodes over their rels in the opposite direction and keeps the rels to nodes of the frontier.
+ * Recursive plans have to be exhausted for each node, so a bottom up level cannot stop at the first
+ * parent it finds. Both kinds of levels then scan the rels of the nodes they extend, and a level is
+ * extended bottom up if there are fewer unvisited nodes than frontier nodes.
+ */
+class BFSSharedState {
+    // Small frontiers are split into morsels of fewer nodes, so that they can still be extended by
+    // several threads.
+    static constexpr uint64_t MAX_MORSEL_SIZE = 64;
+    static constexpr uint64_t MIN_NUM_MORSELS_PER_LEVEL = 32;
+
+public:
+    BFSSharedState(BaseBFSState* bfsState, const BottomUpInfo* bottomUpInfo);
+
+    // Returns false if no morsel can be handed out right now, either because the BFS is finished,
+    // or because the current level has been handed out but not been applied completely yet.
+    // The functions below return (or set hasNewMorsels to) true if they started a new level or
+    // finished the BFS while it is published, in which case threads waiting for the BFS should be
+    // notified. Whether the BFS is published is read under the lock, because the thread owning the
+    // BFS may destroy it as soon as the last morsel has been handed back.
+    bool getMorsel(BFSMorsel& morsel, bool& hasNewMorsels);
+    // Hands back the edges found by extending the morsel.
+    bool finishMorsel(const BFSMorsel& morsel, std::vector<FrontierEdge> edges);
+    // Stops the BFS once the morsels which are being extended are handed back, e.g., because
+    // extending a morsel failed.
+    bool abortMorsel(const BFSMorsel& morsel);
+
+    // The current frontier is not modified while its morsels are extended, so it can be read
+    // without holding the lock.
+    inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
+        return bfsState->getMultiplicity(nodeID);
+    }
+    // Only valid during bottom up levels.
+    inline bool isFrontierNode(common::nodeID_t nodeID) const {
+        return frontierNodeIDs.contains(nodeID);
+    }
+
+    bool hasMorsel();
+    bool hasMorselOrIsFinished();
+    bool isFinished();
+    bool isAborted();
+    // Whether the BFS can be helped by other threads through RecursiveJoinSharedState.
+    bool isPublished();
+    void setPublished(bool isPublished);
+
+private:
+    // Applies the edges of the consecutive finished morsels, then starts the next level or finishes
+    // the BFS if all morsels of the current level have been applied.
+    bool applyFinishedMorsels();
+    bool tryFinishLevel();
+    bool hasMorselNoLock() const;
+    void startLevel();
+    bool shouldExtendBottomUp() const;
+    bool hasNextMorsel() const;
+    std::span<const common::nodeID_t> getNextMorsel();
+
+private:
+    std::mutex mtx;
+    BaseBFSState* bfsState;
+    const BottomUpInfo* bottomUpInfo;
+    bool isBottomUp;
+    // Unvisited nodes to extend and nodes of the frontier, during bottom up levels.
+    std::vector<common::nodeID_t> unvisitedNodeIDs;
+    uint64_t nextUnvisitedNodeIdx;
+    frontier::NodeIDSet frontierNodeIDs;
+    uint64_t morselSize;
+    uint64_t numMorselsHandedOut;
+    uint64_t numMorselsApplied;
+    // Stop handing out morsels of the current level, because the BFS is complete.
+    bool stopHandingOutMorsels;
+    bool finished;
+    bool aborted;
+    bool published;
+    // Edges of the finished morsels of the current level, which cannot be applied yet because
+    // preceding morsels are still being extended.
+    std::vector<std::optional<std::vector<FrontierEdge>>> finishedMorsels;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 
 #include "frontier.h"
 
@@ -30,6 +31,8 @@ public:
     }
 
     inline uint64_t getNumNodes() const { return numNodes; }
+    // Empty if no semi mask is available.
+    inline const frontier::node_id_set_t& getNodeIDs() const { return nodeIDs; }
 
 private:
     uint64_t numNodes;
@@ -44,13 +47,24 @@ public:
           targetDstNodes{targetDstNodes} {}
     virtual ~BaseBFSState() = default;
 
-    // Get next node offset to extend from current level.
-    common::nodeID_t getNextNodeID() {
-        if (nextNodeIdxToExtend == currentFrontier->nodeIDs.size()) {
-            return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
-        }
-        return currentFrontier->nodeIDs[nextNodeIdxToExtend++];
+    // Get next range of at most maxNumNodes nodes to extend from current level. The range is empty
+    // once all nodes of the current level have been handed out.
+    std::span<const common::nodeID_t> getNextMorsel(uint64_t maxNumNodes) {
+        auto numNodes =
+            std::min<uint64_t>(maxNumNodes, currentFrontier->nodeIDs.size() - nextNodeIdxToExtend);
+        auto morsel = std::span<const common::nodeID_t>(
+            currentFrontier->nodeIDs.data() + nextNodeIdxToExtend, numNodes);
+        nextNodeIdxToExtend += numNodes;
+        return morsel;
+    }
+    inline bool hasNextMorsel() const {
+        return nextNodeIdxToExtend < currentFrontier->nodeIDs.size();
     }
+    inline uint64_t getCurrentFrontierSize() const { return currentFrontier->nodeIDs.size(); }
+    inline std::span<const common::nodeID_t> getCurrentFrontierNodeIDs() const {
+        return currentFrontier->nodeIDs;
+    }
+    inline uint8_t getCurrentLevel() const { return currentLevel; }
 
     virtual void resetState() {
         currentLevel = 0;
@@ -67,8 +81,18 @@ public:
     inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
         return currentFrontier->getMultiplicity(nodeID);
     }
+    // Only BFSs which visit each node once can be extended bottom up, see BFSSharedState.
+    virtual bool isVisited(common::nodeID_t /*nodeID*/) const { KU_UNREACHABLE; }
+    virtual uint64_t getNumVisitedNodes() const { KU_UNREACHABLE; }
+    // Weighted BFSs relax rels by their weights instead of marking nbrs as visited, see
+    // WeightedShortestPathState.
+    virtual bool isWeighted() const { return false; }
+    virtual void relax(common::nodeID_t /*boundNodeID*/, common::nodeID_t /*nbrNodeID*/,
+        common::relID_t /*relID*/, double /*weight*/) {
+        KU_UNREACHABLE;
+    }
 
-    inline void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
+    virtual void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
     inline size_t getNumFrontiers() const { return frontiers.size(); }
     inline Frontier* getFrontier(common::vector_idx_t idx) const { return frontiers[idx].get(); }
 
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <span>
+
+#include "node_id_map.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * BidirectionalBFSState tracks a shortest path BFS between a src node and a single dst node which
+ * extends from both of them. The forward search is the BFS state of the recursive join, so results
+ * are scanned from its frontiers as usual, while the backward search extends from the dst node
+ * over rels in the opposite direction. Each step extends a whole level of the side with the smaller
+ * frontier, until a node is visited by both sides. At that point the length of the shortest paths
+ * is the sum of the levels of both sides.
+ * The forward BFS then continues, but only marks nbrs whose distance to the dst node puts them on a
+ * shortest path. The parents of such nodes are on shortest paths as well, so the frontiers hold
+ * the same paths to the dst node, in the same order, as a forward only BFS.
+ */
+class BidirectionalBFSState {
+public:
+    BidirectionalBFSState() : fwdLevel{0}, bwdLevel{0}, distance{0} {}
+
+    inline void resetState(common::nodeID_t srcNodeID, common::nodeID_t dstNodeID) {
+        fwdLevel = 0;
+        bwdLevel = 0;
+        distance = 0;
+        fwdVisited.clear();
+        bwdNodeToLevel.clear();
+        bwdFrontier.clear();
+        nextBwdFrontier.clear();
+        fwdVisited.insert(srcNodeID);
+        bwdNodeToLevel.insert(dstNodeID, 0);
+        bwdFrontier.push_back(dstNodeID);
+    }
+
+    inline uint8_t getNumLevels() const { return fwdLevel + bwdLevel; }
+    inline uint8_t getBwdLevel() const { return bwdLevel; }
+    inline std::span<const common::nodeID_t> getBwdFrontier() const { return bwdFrontier; }
+
+    // Marks the new forward frontier after the forward search extended a level. Returns true if
+    // both searches have met.
+    bool finalizeFwdLevel(std::span<const common::nodeID_t> nodeIDs) {
+        fwdLevel++;
+        auto hasMet = false;
+        for (auto nodeID : nodeIDs) {
+            fwdVisited.insert(nodeID);
+            hasMet |= bwdNodeToLevel.contains(nodeID);
+        }
+        return hasMet;
+    }
+
+    inline void markBwdVisited(common::nodeID_t nbrNodeID) {
+        if (bwdNodeToLevel.insert(nbrNodeID, bwdLevel + 1).second) {
+            nextBwdFrontier.push_back(nbrNodeID);
+        }
+    }
+    // Returns true if both searches have met.
+    bool finalizeBwdLevel() {
+        bwdLevel++;
+        std::swap(bwdFrontier, nextBwdFrontier);
+        nextBwdFrontier.clear();
+        for (auto nodeID : bwdFrontier) {
+            if (fwdVisited.contains(nodeID)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Fixes the length of the shortest paths once both searches have met.
+    inline void meet() { distance = fwdLevel + bwdLevel; }
+    // Whether a node reached by the forward search at the given level is on a shortest path.
+    inline bool isOnShortestPath(common::nodeID_t nodeID, uint8_t level) const {
+        auto bwdLevel_ = bwdNodeToLevel.find(nodeID);
+        return bwdLevel_ != nullptr && level + *bwdLevel_ == distance;
+    }
+
+private:
+    uint8_t fwdLevel;
+    uint8_t bwdLevel;
+    uint8_t distance;
+    frontier::NodeIDSet fwdVisited;
+    frontier::NodeIDMap<uint8_t> bwdNodeToLevel;
+    std::vector<common::nodeID_t> bwdFrontier;
+    std::vector<common::nodeID_t> nextBwdFrontier;
+};
+
+} // namespace processor
+} // namespace kuzu
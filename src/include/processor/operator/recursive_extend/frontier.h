@@ -3,6 +3,7 @@
 #include <unordered_map>
 
 #include "function/hash/hash_functions.h"
+#include "node_id_map.h"
 
 namespace kuzu {
 namespace processor {
@@ -27,10 +28,24 @@ using node_id_map_t = std::unordered_map<common::nodeID_t, T, function::Internal
  * Var length NOT track path     |  nodeIDs & nodeIDToMultiplicity
  */
 class Frontier {
+    // Bwd edges are stored in a single vector, in which the bwd edges of each node form a linked
+    // list, instead of a vector per node.
+    struct BwdEdge {
+        frontier::node_rel_id_t nodeAndRelID;
+        uint64_t nextEdgeIdx;
+    };
+    struct BwdEdgeList {
+        uint64_t firstEdgeIdx;
+        uint64_t lastEdgeIdx;
+    };
+
 public:
+    static constexpr uint64_t INVALID_EDGE_IDX = UINT64_MAX;
+
     inline void resetState() {
         nodeIDs.clear();
         bwdEdges.clear();
+        bwdEdgeLists.clear();
         nodeIDToMultiplicity.clear();
     }
 
@@ -42,10 +57,22 @@ public:
         return nodeIDToMultiplicity.empty() ? 1 : nodeIDToMultiplicity.at(nodeID);
     }
 
+    inline uint64_t getFirstBwdEdgeIdx(common::nodeID_t nodeID) const {
+        return bwdEdgeLists.at(nodeID).firstEdgeIdx;
+    }
+    // Returns INVALID_EDGE_IDX after the last bwd edge of a node.
+    inline uint64_t getNextBwdEdgeIdx(uint64_t edgeIdx) const {
+        return bwdEdges[edgeIdx].nextEdgeIdx;
+    }
+    inline const frontier::node_rel_id_t& getBwdEdge(uint64_t edgeIdx) const {
+        return bwdEdges[edgeIdx].nodeAndRelID;
+    }
+
 public:
     std::vector<common::nodeID_t> nodeIDs;
-    frontier::node_id_map_t<std::vector<frontier::node_rel_id_t>> bwdEdges;
-    frontier::node_id_map_t<uint64_t> nodeIDToMultiplicity;
+    std::vector<BwdEdge> bwdEdges;
+    frontier::NodeIDMap<BwdEdgeList> bwdEdgeLists;
+    frontier::NodeIDMap<uint64_t> nodeIDToMultiplicity;
 };
 
 } // namespace processor
@@ -58,7 +58,13 @@ using path_semantic_check_t =
     std::function<bool(const std::vector<common::nodeID_t>&, const std::vector<common::relID_t>&)>;
 
 class PathScanner : public BaseFrontierScanner {
-    using nbrs_t = std::vector<frontier::node_rel_id_t>*;
+    // Cursor over the bwd edges of a node in a frontier. The cursor is positioned before the first
+    // edge if edgeIdx is INVALID_EDGE_IDX.
+    struct BwdEdgeCursor {
+        const Frontier* frontier;
+        uint64_t firstEdgeIdx;
+        uint64_t edgeIdx;
+    };
 
 public:
     PathScanner(TargetDstNodes* targetDstNodes, size_t k,
@@ -94,8 +100,7 @@ private:
     // DFS states
     std::vector<common::nodeID_t> nodeIDs;
     std::vector<common::relID_t> relIDs;
-    std::stack<nbrs_t> nbrsStack;
-    std::stack<int64_t> cursorStack;
+    std::stack<BwdEdgeCursor> cursorStack;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
     // Path semantic
     path_semantic_check_t semanticCheckFunc;
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "common/assert.h"
+#include "function/hash/hash_functions.h"
+
+namespace kuzu {
+namespace processor {
+namespace frontier {
+
+/*
+ * NodeIDMap maps the node IDs reached by a BFS to values, e.g., visited flags, distances or
+ * multiplicities. A map starts as a hash map, which is cheap to create and to clear for BFSs which
+ * reach few nodes. Once it holds a large share of the offsets of its node tables, it switches to
+ * dense arrays indexed by node offset (one per table), together with a bitmap of the offsets
+ * which are present, so that lookups and inserts no longer hash or allocate. Clearing a map
+ * switches it back to a hash map.
+ * Values are not stable: pointers returned by find() and insert() are invalidated by inserts.
+ */
+template<typename T>
+class NodeIDMap {
+    static constexpr bool IS_SET = std::is_empty_v<T>;
+    // The density is checked whenever the number of entries doubles, starting at this size.
+    static constexpr uint64_t MIN_NUM_ENTRIES_TO_BE_DENSE = 256;
+    // A map switches to dense arrays once they have at most this many slots per entry. A bitmap
+    // slot costs a bit, while a hash map entry costs tens of bytes.
+    static constexpr uint64_t MAX_NUM_SLOTS_PER_ENTRY = IS_SET ? 256 : 8;
+
+    struct DenseTable {
+        common::table_id_t tableID;
+        std::vector<uint64_t> presence;
+        // Empty for sets.
+        std::vector<T> values;
+
+        inline uint64_t getCapacity() const { return presence.size() * 64; }
+        inline bool contains(common::offset_t offset) const {
+            return offset < getCapacity() && (presence[offset >> 6] >> (offset & 63)) & 1;
+        }
+        inline void resize(common::offset_t maxOffset) {
+            auto capacity = std::bit_ceil(std::max<uint64_t>(maxOffset + 1, 64));
+            presence.resize(capacity / 64, 0);
+            if constexpr (!IS_SET) {
+                values.resize(capacity);
+            }
+        }
+    };
+
+public:
+    NodeIDMap()
+        : isDense{false}, numEntries{0}, numEntriesToCheckDensity{MIN_NUM_ENTRIES_TO_BE_DENSE} {}
+
+    inline uint64_t size() const { return numEntries; }
+    inline bool empty() const { return numEntries == 0; }
+
+    inline bool contains(common::nodeID_t nodeID) const {
+        if (!isDense) {
+            return sparseMap.contains(nodeID);
+        }
+        auto denseTable = getDenseTable(nodeID.tableID);
+        return denseTable != nullptr && denseTable->contains(nodeID.offset);
+    }
+
+    inline T* find(common::nodeID_t nodeID) {
+        if (!isDense) {
+            auto it = sparseMap.find(nodeID);
+            return it == sparseMap.end() ? nullptr : &it->second;
+        }
+        auto denseTable = getDenseTable(nodeID.tableID);
+        if (denseTable == nullptr || !denseTable->contains(nodeID.offset)) {
+            return nullptr;
+        }
+        return getDenseValue(*denseTable, nodeID.offset);
+    }
+    inline const T* find(common::nodeID_t nodeID) const {
+        return const_cast<NodeIDMap*>(this)->find(nodeID);
+    }
+
+    inline T& at(common::nodeID_t nodeID) {
+        auto value = find(nodeID);
+        KU_ASSERT(value != nullptr);
+        return *value;
+    }
+    inline const T& at(common::nodeID_t nodeID) const {
+        return const_cast<NodeIDMap*>(this)->at(nodeID);
+    }
+
+    // Inserts the value if the node ID is not present yet. Returns the value of the node ID and
+    // whether it has been inserted.
+    std::pair<T*, bool> insert(common::nodeID_t nodeID, T value = T{}) {
+        if (!isDense) {
+            auto [it, inserted] = sparseMap.emplace(nodeID, std::move(value));
+            if (inserted && ++numEntries >= numEntriesToCheckDensity) {
+                if (tryConvertToDense()) {
+                    return {find(nodeID), true};
+                }
+            }
+            return {&it->second, inserted};
+        }
+        auto& denseTable = getOrCreateDenseTable(nodeID.tableID);
+        if (denseTable.contains(nodeID.offset)) {
+            return {getDenseValue(denseTable, nodeID.offset), false};
+        }
+        insertDense(denseTable, nodeID.offset, std::move(value));
+        numEntries++;
+        return {getDenseValue(denseTable, nodeID.offset), true};
+    }
+
+    inline void clear() {
+        isDense = false;
+        numEntries = 0;
+        numEntriesToCheckDensity = MIN_NUM_ENTRIES_TO_BE_DENSE;
+        sparseMap.clear();
+        denseTables.clear();
+    }
+
+private:
+    inline T* getDenseValue(DenseTable& denseTable, common::offset_t offset) {
+        if constexpr (IS_SET) {
+            return &emptyValue;
+        } else {
+            return &denseTable.values[offset];
+        }
+    }
+
+    inline DenseTable* getDenseTable(common::table_id_t tableID) const {
+        // BFSs reach nodes of few tables, so a linear search beats hashing.
+        for (auto& denseTable : denseTables) {
+            if (denseTable.tableID == tableID) {
+                return const_cast<DenseTable*>(&denseTable);
+            }
+        }
+        return nullptr;
+    }
+
+    inline DenseTable& getOrCreateDenseTable(common::table_id_t tableID) {
+        auto denseTable = getDenseTable(tableID);
+        if (denseTable != nullptr) {
+            return *denseTable;
+        }
+        denseTables.push_back(DenseTable{tableID, {}, {}});
+        return denseTables.back();
+    }
+
+    inline void insertDense(DenseTable& denseTable, common::offset_t offset, T value) {
+        if (offset >= denseTable.getCapacity()) {
+            denseTable.resize(offset);
+        }
+        denseTable.presence[offset >> 6] |= (uint64_t)1 << (offset & 63);
+        if constexpr (!IS_SET) {
+            denseTable.values[offset] = std::move(value);
+        }
+    }
+
+    bool tryConvertToDense() {
+        numEntriesToCheckDensity = numEntries * 2;
+        std::vector<std::pair<common::table_id_t, common::offset_t>> maxOffsets;
+        for (auto& [nodeID, _] : sparseMap) {
+            auto it = std::find_if(maxOffsets.begin(), maxOffsets.end(),
+                [&](auto& maxOffset) { return maxOffset.first == nodeID.tableID; });
+            if (it == maxOffsets.end()) {
+                maxOffsets.emplace_back(nodeID.tableID, nodeID.offset);
+            } else {
+                it->second = std::max(it->second, nodeID.offset);
+            }
+        }
+        uint64_t numSlots = 0;
+        for (auto& [_, maxOffset] : maxOffsets) {
+            numSlots += maxOffset + 1;
+        }
+        if (numSlots > numEntries * MAX_NUM_SLOTS_PER_ENTRY) {
+            return false;
+        }
+        for (auto& [tableID, maxOffset] : maxOffsets) {
+            denseTables.push_back(DenseTable{tableID, {}, {}});
+            denseTables.back().resize(maxOffset);
+        }
+        for (auto& [nodeID, value] : sparseMap) {
+            insertDense(*getDenseTable(nodeID.tableID), nodeID.offset, std::move(value));
+        }
+        sparseMap.clear();
+        isDense = true;
+        return true;
+    }
+
+private:
+    bool isDense;
+    uint64_t numEntries;
+    uint64_t numEntriesToCheckDensity;
+    std::unordered_map<common::nodeID_t, T, function::InternalIDHasher> sparseMap;
+    std::vector<DenseTable> denseTables;
+    // Sets have no values, so find() and insert() return this one.
+    static inline T emptyValue{};
+};
+
+using NodeIDSet = NodeIDMap<std::monostate>;
+
+} // namespace frontier
+} // namespace processor
+} // namespace kuzu
@@ -1,23 +1,61 @@
 #pragma once
 
-#include "bfs_state.h"
+#include <condition_variable>
+
+#include "bfs_shared_state.h"
+#include "bidirectional_bfs_state.h"
 #include "common/enums/query_rel_type.h"
 #include "frontier_scanner.h"
 #include "planner/operator/extend/extend_direction.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/mask.h"
 #include "processor/operator/physical_operator.h"
+#include "storage/store/csr_graph.h"
 
 namespace kuzu {
 namespace processor {
 
 class ScanFrontier;
 
+// Besides the semi masks, the shared state lets threads which have run out of sources help the
+// other threads with their BFSs. A thread which computes a BFS publishes it once there are idle
+// threads, and idle threads extend morsels of the published BFSs until all threads have run out of
+// sources and no BFS is published any more. See BFSSharedState for how a BFS is parallelized.
+// A BFS lives on the stack of the thread owning it, so helping threads pin it while taking and
+// extending a morsel, and unpublishing waits until it is no longer pinned. Morsels are taken
+// without holding the lock, because taking a morsel may finalize a level.
 struct RecursiveJoinSharedState {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
 
     explicit RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks)
-        : semiMasks{std::move(semiMasks)} {}
+        : semiMasks{std::move(semiMasks)}, numSourceScanners{0}, numIdleThreads{0} {}
+
+    void registerSourceScanner();
+    void finishScanningSources();
+
+    inline bool hasIdleThreads() const { return numIdleThreads.load() > 0; }
+    void publishBFS(BFSSharedState& bfs);
+    // Waits until no thread helps the BFS any more, then unpublishes it.
+    void unpublishBFS(BFSSharedState& bfs);
+    // Blocks until a morsel of a published BFS can be extended and returns its BFS, which stays
+    // pinned until it is released. Returns nullptr once all threads have run out of sources and no
+    // BFS is published.
+    BFSSharedState* getBFSToHelp(BFSMorsel& morsel);
+    void releaseBFS(BFSSharedState& bfs);
+    // Blocks until a morsel of the BFS can be handed out or the BFS is finished.
+    void waitForMorsel(BFSSharedState& bfs);
+    void notifyWaitingThreads();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numSourceScanners;
+    std::atomic<uint64_t> numIdleThreads;
+    struct PublishedBFS {
+        BFSSharedState* bfs;
+        uint64_t numHelpers;
+    };
+    std::vector<PublishedBFS> publishedBFSs;
 };
 
 struct RecursiveJoinDataInfo {
@@ -32,6 +70,13 @@ struct RecursiveJoinDataInfo {
     DataPos recursiveDstNodeIDPos;
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
+    // Weights of the rels of weighted shortest paths. Invalid for unweighted paths.
+    DataPos recursiveEdgeWeightPos;
+    // Recursive plan extending in the opposite direction for bidirectional BFS. The descriptor is
+    // null if there is no such plan.
+    std::unique_ptr<ResultSetDescriptor> bwdLocalResultSetDescriptor;
+    DataPos bwdRecursiveDstNodeIDPos;
+    DataPos bwdRecursiveEdgeIDPos;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
@@ -49,6 +94,12 @@ private:
         recursiveDstNodeIDPos = other.recursiveDstNodeIDPos;
         recursiveDstNodeTableIDs = other.recursiveDstNodeTableIDs;
         recursiveEdgeIDPos = other.recursiveEdgeIDPos;
+        recursiveEdgeWeightPos = other.recursiveEdgeWeightPos;
+        if (other.bwdLocalResultSetDescriptor != nullptr) {
+            bwdLocalResultSetDescriptor = other.bwdLocalResultSetDescriptor->copy();
+        }
+        bwdRecursiveDstNodeIDPos = other.bwdRecursiveDstNodeIDPos;
+        bwdRecursiveEdgeIDPos = other.bwdRecursiveEdgeIDPos;
         pathPos = other.pathPos;
         tableIDToName = other.tableIDToName;
     }
@@ -70,6 +121,9 @@ struct RecursiveJoinVectors {
 
     common::ValueVector* recursiveEdgeIDVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
+    common::ValueVector* recursiveEdgeWeightVector = nullptr;
+    common::ValueVector* bwdRecursiveEdgeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveDstNodeIDVector = nullptr;
 };
 
 struct RecursiveJoinInfo {
@@ -79,6 +133,10 @@ struct RecursiveJoinInfo {
     common::QueryRelType queryRelType;
     planner::RecursiveJoinType joinType;
     planner::ExtendDirection direction;
+    // Rel table of the recursive plans if they only extend over its rels, without any predicates,
+    // so that they can be replaced by reading a projected graph of the rel table if there is one.
+    // INVALID_TABLE_ID otherwise.
+    common::table_id_t graphRelTableID = common::INVALID_TABLE_ID;
 
     RecursiveJoinInfo() = default;
     EXPLICIT_COPY_DEFAULT_MOVE(RecursiveJoinInfo);
@@ -91,6 +149,7 @@ private:
         queryRelType = other.queryRelType;
         joinType = other.joinType;
         direction = other.direction;
+        graphRelTableID = other.graphRelTableID;
     }
 };
 
@@ -98,11 +157,14 @@ class RecursiveJoin : public PhysicalOperator {
 public:
     RecursiveJoin(RecursiveJoinInfo info, std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString,
-        std::unique_ptr<PhysicalOperator> recursiveRoot)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> bwdRecursiveRoot = nullptr)
         : PhysicalOperator{PhysicalOperatorType::RECURSIVE_JOIN, std::move(child), id,
               paramsString},
           info{std::move(info)}, sharedState{std::move(sharedState)},
-          recursiveRoot{std::move(recursiveRoot)} {}
+          recursiveRoot{std::move(recursiveRoot)}, bwdRecursiveRoot{std::move(bwdRecursiveRoot)},
+          isScanningSources{false} {}
+    ~RecursiveJoin() override;
 
     RecursiveJoinSharedState* getSharedState() const { return sharedState.get(); }
 
@@ -112,11 +174,14 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() final {
         return std::make_unique<RecursiveJoin>(info.copy(), sharedState, children[0]->clone(), id,
-            paramsString, recursiveRoot->clone());
+            paramsString, recursiveRoot->clone(),
+            bwdRecursiveRoot == nullptr ? nullptr : bwdRecursiveRoot->clone());
     }
 
 private:
     void initLocalRecursivePlan(ExecutionContext* context);
+    // Looks up a projected graph to extend nodes over instead of running the recursive plans.
+    void initGraph(ExecutionContext* context);
 
     void populateTargetDstNodes(ExecutionContext* context);
 
@@ -124,8 +189,24 @@ private:
 
     // Compute BFS for a given src node.
     void computeBFS(ExecutionContext* context);
-
-    void updateVisitedNodes(common::nodeID_t boundNodeID);
+    // Extend morsels of the BFSs of other threads until all threads have run out of sources.
+    void helpOtherBFSs(ExecutionContext* context);
+
+    void extendMorsel(ExecutionContext* context, BFSSharedState& bfs, const BFSMorsel& morsel);
+
+    // Compute shortest paths from a given src node to the single target dst node by extending
+    // from both of them. See BidirectionalBFSState.
+    void computeBidirectionalBFS(ExecutionContext* context, common::nodeID_t srcNodeID,
+        common::nodeID_t dstNodeID);
+    // Extends all nodes of the current forward frontier. Only nbrs accepted by the bidirectional
+    // BFS state are marked as visited if isRestricted is set.
+    void extendFwdLevel(ExecutionContext* context, bool isRestricted);
+    void extendBwdLevel(ExecutionContext* context);
+    // Calls func with each nbr of the node, the rel to it and their position in the vectors of the
+    // recursive plan.
+    template<typename FUNC>
+    void extendNode(ExecutionContext* context, common::nodeID_t nodeID, bool isSrc, bool isBwd,
+        FUNC func);
 
 private:
     RecursiveJoinInfo info;
@@ -135,11 +216,22 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     ScanFrontier* scanFrontier;
+    std::unique_ptr<ResultSet> bwdLocalResultSet;
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    ScanFrontier* bwdScanFrontier;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
+    std::unique_ptr<BidirectionalBFSState> bidirectionalBFSState;
+    std::unique_ptr<BottomUpInfo> bottomUpInfo;
+    // Snapshot of a projected graph replacing the recursive plans. Null if there is none.
+    std::shared_ptr<storage::CSRGraph> graph;
+    // Directions in which the recursive plans extend over the rels of the graph.
+    std::vector<common::RelDataDirection> graphDirections;
+    std::vector<common::RelDataDirection> bwdGraphDirections;
+    bool isScanningSources;
 };
 
 } // namespace processor
@@ -31,10 +31,9 @@ public:
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
-        if (visited.contains(nbrNodeID)) {
+        if (!visited.insert(nbrNodeID).second) {
             return;
         }
-        visited.insert(nbrNodeID);
         if (targetDstNodes->contains(nbrNodeID)) {
             numVisitedDstNodes++;
         }
@@ -45,6 +44,9 @@ public:
         }
     }
 
+    inline bool isVisited(common::nodeID_t nodeID) const final { return visited.contains(nodeID); }
+    inline uint64_t getNumVisitedNodes() const final { return visited.size(); }
+
 private:
     inline bool isAllDstReached() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes();
@@ -52,7 +54,7 @@ private:
 
 private:
     uint64_t numVisitedDstNodes;
-    frontier::node_id_set_t visited;
+    frontier::NodeIDSet visited;
 };
 
 } // namespace processor
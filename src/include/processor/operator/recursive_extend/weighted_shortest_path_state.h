@@ -0,0 +1,163 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * WeightedShortestPathState computes the paths with the smallest sum of rel weights from a src node
+ * among the paths with at most upperBound rels, with a Bellman-Ford search limited to upperBound
+ * rounds. Round i extends the nodes whose shortest path with at most i rels is shorter than their
+ * shortest path with fewer rels. Each round is a level of BFSSharedState, so its nodes are extended
+ * in parallel and its rels are relaxed in the same order as by a single thread. The search stops
+ * early once a round improves no node.
+ *
+ * Searching by distance alone is not enough, because the path with the smallest distance may have
+ * more rels than the upper bound while a longer path with fewer rels does not. So each improvement
+ * of a node is kept as a path entry with its number of hops, which points to the entry of its
+ * parent in the previous round. Only the last rel of each entry is kept instead of the paths
+ * themselves. Once the search is complete, the last entry of each node is scanned as its shortest
+ * path, in the frontier of its number of hops, so that paths are scanned in the same way as the
+ * paths of an unweighted shortest path BFS.
+ */
+template<bool TRACK_PATH>
+class WeightedShortestPathState : public BaseBFSState {
+    struct PathEntry {
+        common::nodeID_t nodeID;
+        uint8_t numHops;
+        double distance;
+        uint64_t parentEntryIdx;
+        common::relID_t relID;
+    };
+
+public:
+    WeightedShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
+        : BaseBFSState{upperBound, targetDstNodes}, complete{false} {}
+    ~WeightedShortestPathState() override = default;
+
+    inline bool isComplete() final { return complete; }
+    void resetState() final {
+        BaseBFSState::resetState();
+        roundFrontier.resetState();
+        currentFrontier = &roundFrontier;
+        complete = false;
+        entries.clear();
+        lastEntryIdxs.clear();
+        roundEntryIdxs.clear();
+        reachedNodeIDs.clear();
+        nextRoundNodeIDs.clear();
+    }
+
+    void markSrc(common::nodeID_t nodeID) final {
+        srcNodeID = nodeID;
+        entries.push_back(PathEntry{nodeID, 0, 0, UINT64_MAX, common::relID_t{}});
+        lastEntryIdxs.insert(nodeID, 0);
+        roundEntryIdxs.insert(nodeID, 0);
+        roundFrontier.nodeIDs.push_back(nodeID);
+    }
+    void markVisited(common::nodeID_t /*boundNodeID*/, common::nodeID_t /*nbrNodeID*/,
+        common::relID_t /*relID*/, uint64_t /*multiplicity*/) final {
+        KU_UNREACHABLE;
+    }
+
+    inline bool isWeighted() const final { return true; }
+    void relax(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::relID_t relID,
+        double weight) final {
+        auto boundEntryIdx = roundEntryIdxs.at(boundNodeID);
+        auto entry = PathEntry{nbrNodeID, (uint8_t)(currentLevel + 1),
+            entries[boundEntryIdx].distance + weight, boundEntryIdx, relID};
+        auto [lastEntryIdx, inserted] = lastEntryIdxs.insert(nbrNodeID, entries.size());
+        if (inserted) {
+            reachedNodeIDs.push_back(nbrNodeID);
+        } else {
+            auto& lastEntry = entries[*lastEntryIdx];
+            if (!(entry.distance < lastEntry.distance)) {
+                return;
+            }
+            // The node has already been improved by this round.
+            if (lastEntry.numHops == entry.numHops) {
+                lastEntry = entry;
+                return;
+            }
+            *lastEntryIdx = entries.size();
+        }
+        entries.push_back(entry);
+        nextRoundNodeIDs.push_back(nbrNodeID);
+    }
+
+    // Picks the nodes improved by the last round for the next round.
+    void finalizeCurrentLevel() final {
+        currentLevel++;
+        roundFrontier.resetState();
+        nextNodeIdxToExtend = 0;
+        roundEntryIdxs.clear();
+        if (nextRoundNodeIDs.empty() || isUpperBoundReached()) {
+            complete = true;
+            nextRoundNodeIDs.clear();
+            populateFrontiers();
+            return;
+        }
+        std::sort(nextRoundNodeIDs.begin(), nextRoundNodeIDs.end());
+        for (auto nodeID : nextRoundNodeIDs) {
+            roundEntryIdxs.insert(nodeID, lastEntryIdxs.at(nodeID));
+        }
+        roundFrontier.nodeIDs = std::move(nextRoundNodeIDs);
+        nextRoundNodeIDs.clear();
+    }
+
+private:
+    // The entries on the path of a node are added as bwd edges to the frontiers of their number of
+    // hops. These may differ from the number of hops of the last entries of their own nodes, so
+    // each frontier only scans the nodes whose last entry it holds.
+    void populateFrontiers() {
+        frontiers.clear();
+        for (auto i = 0u; i <= upperBound; ++i) {
+            frontiers.push_back(std::make_unique<Frontier>());
+        }
+        frontiers[0]->addNodeWithMultiplicity(srcNodeID, 1);
+        std::sort(reachedNodeIDs.begin(), reachedNodeIDs.end());
+        if constexpr (TRACK_PATH) {
+            std::vector<std::vector<common::nodeID_t>> dstNodeIDs(upperBound + 1);
+            std::vector<bool> isEntryAdded(entries.size(), false);
+            for (auto nodeID : reachedNodeIDs) {
+                auto entryIdx = lastEntryIdxs.at(nodeID);
+                dstNodeIDs[entries[entryIdx].numHops].push_back(nodeID);
+                // The src entry has no rel, and entries shared with other paths are added once.
+                while (entryIdx != 0 && !isEntryAdded[entryIdx]) {
+                    isEntryAdded[entryIdx] = true;
+                    auto& entry = entries[entryIdx];
+                    frontiers[entry.numHops]->addEdge(entries[entry.parentEntryIdx].nodeID,
+                        entry.nodeID, entry.relID);
+                    entryIdx = entry.parentEntryIdx;
+                }
+            }
+            for (auto i = 1u; i <= upperBound; ++i) {
+                frontiers[i]->nodeIDs = std::move(dstNodeIDs[i]);
+            }
+        } else {
+            for (auto nodeID : reachedNodeIDs) {
+                auto& entry = entries[lastEntryIdxs.at(nodeID)];
+                frontiers[entry.numHops]->addNodeWithMultiplicity(nodeID, 1);
+            }
+        }
+    }
+
+private:
+    common::nodeID_t srcNodeID;
+    bool complete;
+    // Entry 0 is the src node.
+    std::vector<PathEntry> entries;
+    // The entry of the shortest path found so far of each reached node.
+    frontier::NodeIDMap<uint64_t> lastEntryIdxs;
+    // The entries of the nodes extended by the current round.
+    frontier::NodeIDMap<uint64_t> roundEntryIdxs;
+    std::vector<common::nodeID_t> reachedNodeIDs;
+    // Nodes which have been improved by the current round.
+    std::vector<common::nodeID_t> nextRoundNodeIDs;
+    // Nodes extended by the current round, which are not part of the frontiers to scan.
+    Frontier roundFrontier;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -60,6 +60,12 @@ public:
         return sharedState->getTable();
     }
 
+    // Executes the pipeline in the calling thread until at least numFlatTuples flat tuples have
+    // been collected into the returned table, instead of executing it at once with execute().
+    // hasMoreTuples is set to false once the pipeline is exhausted.
+    std::unique_ptr<FactorizedTable> collectNextTable(ExecutionContext* context,
+        uint64_t numFlatTuples, bool& hasMoreTuples);
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info->copy(), sharedState,
             children[0]->clone(), id, paramsString);
@@ -73,6 +79,7 @@ private:
     std::shared_ptr<ResultCollectorSharedState> sharedState;
     std::vector<common::ValueVector*> payloadVectors;
     std::vector<common::ValueVector*> payloadAndMarkVectors;
+    std::unordered_set<uint32_t> payloadDataChunkPoses;
 
     std::unique_ptr<common::ValueVector> markVector;
     std::unique_ptr<FactorizedTable> localTable;
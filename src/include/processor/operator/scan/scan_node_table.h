@@ -2,27 +2,43 @@
 
 #include <utility>
 
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/operator/scan/scan_table.h"
 #include "storage/store/node_table.h"
 
 namespace kuzu {
 namespace processor {
 
+// A filter on the build side keys of a hash join, pushed into the scan of the probe side key.
+struct ScanKeyFilter {
+    // Position of the key in the columns to scan.
+    uint32_t columnIdx;
+    JoinKeyFilter* filter;
+};
+
 struct ScanNodeTableInfo {
     storage::NodeTable* table;
     std::vector<common::column_id_t> columnIDs;
+    std::vector<ScanKeyFilter> keyFilters;
+    std::vector<storage::ZoneMapFilter> zoneMapFilters;
 
     ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs)
         : table{table}, columnIDs{std::move(columnIDs)} {}
     ScanNodeTableInfo(const ScanNodeTableInfo& other)
-        : table{other.table}, columnIDs{other.columnIDs} {}
+        : table{other.table}, columnIDs{other.columnIDs}, keyFilters{other.keyFilters},
+          zoneMapFilters{other.zoneMapFilters} {}
 
     inline std::unique_ptr<ScanNodeTableInfo> copy() const {
         return std::make_unique<ScanNodeTableInfo>(*this);
     }
 };
 
-class ScanNodeTable final : public ScanTable {
+// If zone map filters are pushed into the scan, node groups which cannot pass the filters are
+// skipped before any column is read, and the filters are evaluated on the compressed values of the
+// remaining node groups. If key filters are pushed into the scan, key columns are read and filtered
+// next, and the remaining columns are only read for tuples that pass all filters.
+class ScanNodeTable final : public ScanTable, public SelVectorOverWriter {
 public:
     ScanNodeTable(std::unique_ptr<ScanNodeTableInfo> info, const DataPos& inVectorPos,
         std::vector<DataPos> outVectorsPos, std::unique_ptr<PhysicalOperator> child, uint32_t id,
@@ -34,6 +50,10 @@ public:
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    inline void addKeyFilter(uint32_t columnIdx, JoinKeyFilter* filter) {
+        info->keyFilters.push_back(ScanKeyFilter{columnIdx, filter});
+    }
+
     std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<ScanNodeTable>(info->copy(), nodeIDPos, outVectorsPos,
             children[0]->clone(), id, paramsString);
@@ -45,11 +65,33 @@ protected:
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : ScanTable{operatorType, inVectorPos, std::move(outVectorsPos), std::move(child), id,
               paramsString},
-          info{std::move(info)} {}
+          info{std::move(info)}, zoneMapNodeGroupIdx{common::INVALID_NODE_GROUP_IDX},
+          skipNodeGroup{false} {}
+
+private:
+    // Returns true if zone maps show that no tuple of the current node group passes the filters.
+    bool canSkipByZoneMaps(transaction::Transaction* transaction);
+    // Returns false if no tuple passes the filters.
+    bool filterByCompressedValues(transaction::Transaction* transaction);
+    // Returns false if no tuple passes the filters.
+    bool readAndFilterKeys(transaction::Transaction* transaction);
+
+    inline bool filtersSelVector() const {
+        return filterReadState != nullptr || !keyFilters.empty();
+    }
 
 private:
     std::unique_ptr<ScanNodeTableInfo> info;
+    // Zone maps are checked once per node group.
+    common::node_group_idx_t zoneMapNodeGroupIdx;
+    bool skipNodeGroup;
     std::unique_ptr<storage::NodeTableReadState> readState;
+    // Only set if any zone map filter is pushed into the scan.
+    std::unique_ptr<storage::NodeTableReadState> filterReadState;
+    // Only set if any key filter is enabled.
+    std::vector<JoinKeyFilter*> keyFilters;
+    std::unique_ptr<storage::NodeTableReadState> keyReadState;
+    std::unique_ptr<common::ValueVector> hashVector;
 };
 
 } // namespace processor
@@ -3,6 +3,7 @@
 #include "common/task_system/task_scheduler.h"
 #include "processor/physical_plan.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result_stream.h"
 
 namespace kuzu {
 namespace processor {
@@ -13,6 +14,10 @@ public:
     explicit QueryProcessor(uint64_t numThreads);
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
+    // Executes all pipelines of the plan except the root one, whose results are produced on demand
+    // by the returned stream in the thread of its consumer.
+    std::unique_ptr<ResultStream> executeStreaming(PhysicalPlan* physicalPlan,
+        ExecutionContext* context);
 
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
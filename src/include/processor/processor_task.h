@@ -8,6 +8,7 @@ namespace processor {
 
 class ProcessorTask : public common::Task {
     friend class QueryProcessor;
+    friend class ResultStream;
 
 public:
     ProcessorTask(Sink* sink, ExecutionContext* executionContext);
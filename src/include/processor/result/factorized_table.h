@@ -221,7 +221,7 @@ public:
     uint64_t getTotalNumFlatTuples() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
 
-    inline const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
+    inline const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() const {
         return flatTupleBlockCollection->getBlocks();
     }
     inline const FactorizedTableSchema* getTableSchema() const { return tableSchema.get(); }
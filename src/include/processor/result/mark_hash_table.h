@@ -11,6 +11,9 @@ public:
         std::vector<common::LogicalType> payloadTypes, uint64_t numEntriesToAllocate,
         std::unique_ptr<FactorizedTableSchema> tableSchema);
 
+    std::unique_ptr<AggregateHashTable> createEmptyCopy(
+        uint64_t numEntriesToAllocate) const override;
+
     uint64_t matchFTEntries(const std::vector<common::ValueVector*>& flatKeyVectors,
         const std::vector<common::ValueVector*>& unFlatKeyVectors, uint64_t numMayMatches,
         uint64_t numNoMatches) override;
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "processor/operator/result_collector.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * ResultStream produces the results of the root pipeline of a plan on demand, once all other
+ * pipelines of the plan have been executed. Each call to getNextTable() executes the root pipeline
+ * in the calling thread until about a vector's worth of flat tuples is collected. So results are
+ * neither materialized at once nor produced ahead of their consumer, and the execution stops as
+ * soon as the consumer stops reading.
+ */
+class ResultStream {
+public:
+    ResultStream(ResultCollector* resultCollector, ExecutionContext* context);
+
+    inline bool hasMoreTables() const { return hasMoreTuples; }
+    // Returns the next table of results, which is empty only if it is the last one.
+    std::unique_ptr<FactorizedTable> getNextTable();
+
+private:
+    ResultCollector* resultCollector;
+    ExecutionContext* context;
+    std::unique_ptr<ResultSet> resultSet;
+    bool hasMoreTuples;
+};
+
+} // namespace processor
+} // namespace kuzu
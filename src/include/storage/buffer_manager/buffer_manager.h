@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <vector>
 
+#include "common/constants.h"
 #include "storage/buffer_manager/bm_file_handle.h"
-#include "storage/buffer_manager/locked_queue.h"
 
 namespace kuzu {
 namespace storage {
@@ -38,31 +41,60 @@ struct EvictionCandidate {
     }
 };
 
+// The eviction queue keeps candidates in two tiers to make eviction resistant to sequential scans,
+// similar to 2Q. Pages enter the PROBATION tier when they are read into a frame, and move to the
+// PROTECTED tier once they are accessed again while cached. Eviction takes candidates from the
+// PROBATION tier first, so pages that are read once by a large scan are evicted before the hot
+// pages of the PROTECTED tier, and only falls back to the PROTECTED tier when the PROBATION tier
+// gets too small (see `dequeue`).
+// Each tier is split into shards with their own locks, so that concurrent unpins mostly enqueue
+// into different shards. Candidates are distributed over the shards by page, and eviction visits
+// the shards round-robin, so each tier is only approximately FIFO.
+enum class EvictionTier : uint8_t { PROBATION = 0, PROTECTED = 1 };
+
 class EvictionQueue {
+    static constexpr uint64_t NUM_TIERS = 2;
+    static constexpr uint64_t NUM_SHARDS = common::BufferPoolConstants::EVICTION_QUEUE_NUM_SHARDS;
+
+    struct Shard {
+        std::mutex mtx;
+        std::deque<EvictionCandidate> candidates;
+        uint64_t numInsertions = 0;
+    };
+
 public:
-    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
+    EvictionQueue();
 
-    inline void enqueue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(candidate);
+    inline void enqueue(EvictionCandidate& candidate, EvictionTier tier) {
+        enqueue(candidate, tier, getShard(tier, candidate.fileHandle, candidate.pageIdx));
     }
     inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
-        uint64_t pageVersion) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
+        uint64_t pageVersion, EvictionTier tier) {
+        EvictionCandidate candidate{fileHandle, pageIdx, pageState, pageVersion};
+        enqueue(candidate, tier);
     }
-    inline bool dequeue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        return queue->try_dequeue(candidate);
-    }
-
-    void removeNonEvictableCandidates();
+    bool dequeue(EvictionCandidate& candidate);
 
     void removeCandidatesForFile(BMFileHandle& fileHandle);
 
 private:
-    std::shared_mutex mtx;
-    std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
+    inline Shard& getShard(EvictionTier tier, BMFileHandle* fileHandle,
+        common::page_idx_t pageIdx) {
+        auto hash =
+            std::hash<BMFileHandle*>{}(fileHandle) ^ std::hash<common::page_idx_t>{}(pageIdx);
+        return shards[(uint8_t)tier][hash % NUM_SHARDS];
+    }
+
+    void enqueue(EvictionCandidate& candidate, EvictionTier tier, Shard& shard);
+    bool dequeue(EvictionTier tier, EvictionCandidate& candidate);
+    // Removes the non evictable candidates at the front of the shard, and returns the candidates of
+    // pages that were accessed again, which have to be moved to the PROTECTED tier.
+    std::vector<EvictionCandidate> removeNonEvictableCandidates(EvictionTier tier, Shard& shard);
+
+private:
+    std::array<std::array<Shard, NUM_SHARDS>, NUM_TIERS> shards;
+    std::array<std::atomic<uint64_t>, NUM_TIERS> numCandidates;
+    std::atomic<uint64_t> nextShardToDequeue;
 };
 
 /**
@@ -111,8 +143,9 @@ private:
  * of `maxSize` for it. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that
  * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
- * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
- * comments above `claimAFrame()` for more details.
+ * scan resistant, two tier queue based replacement policy (see `EvictionQueue`) and the
+ * MADV_DONTNEED hint to explicitly control evictions. See comments above `claimAFrame()` for more
+ * details.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -163,6 +196,9 @@ private:
 class BufferManager {
 public:
     enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
+    // Pages accessed with LOW priority, e.g., by sequential scans, are not moved to the PROTECTED
+    // tier of the eviction queue by the access.
+    enum class PagePriority : uint8_t { NORMAL = 0, LOW = 1 };
 
     BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize);
     ~BufferManager() = default;
@@ -170,15 +206,24 @@ public:
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PagePriority pagePriority = PagePriority::NORMAL);
     // The function assumes that the requested page is already pinned.
-    void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
+        PagePriority pagePriority = PagePriority::NORMAL);
+    // Loads the evicted pages among [startPageIdx, startPageIdx + numPages) into their frames ahead
+    // of a sequential scan, reading each run of consecutive pages with a single read. The pages are
+    // left unpinned and added to the PROBATION tier of the eviction queue. Loading stops at the
+    // first page for which no frame can be claimed. Returns the number of pages read from the file.
+    common::page_idx_t prefetchPages(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
 
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
     void flushAllDirtyPagesInFrames(BMFileHandle& fileHandle);
     void updateFrameIfPageIsInFrameWithoutLock(BMFileHandle& fileHandle, uint8_t* newPage,
         common::page_idx_t pageIdx);
+    // Writes the page back to its file if it is dirty.
     void removePageFromFrameIfNecessary(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
 
     // For files that are managed by BM, their FileHandles should be created through this function.
@@ -193,6 +238,8 @@ public:
     }
     inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
 
+    inline uint64_t getBufferPoolSize() const { return bufferPoolSize.load(); }
+
 private:
     static void verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize);
 
@@ -203,12 +250,16 @@ private:
 
     void cachePageIntoFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    // Reads pages, which are locked and have claimed consecutive frames, into their frames and
+    // unpins them.
+    void cachePagesIntoFrames(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     void flushIfDirtyWithoutLock(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
     void removePageFromFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         bool shouldFlush);
 
     void addToEvictionQueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx,
-        PageState* pageState);
+        PageState* pageState, EvictionTier tier);
 
     inline uint64_t reserveUsedMemory(uint64_t size) { return usedMemory.fetch_add(size); }
     inline uint64_t freeUsedMemory(uint64_t size) {
@@ -226,7 +277,6 @@ private:
 private:
     std::atomic<uint64_t> usedMemory;
     std::atomic<uint64_t> bufferPoolSize;
-    std::atomic<uint64_t> numEvictionQueueInsertions;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// Vectorized unpacking of the 32-value chunks written by FastPForLib::fastpack, whose values are
+// laid out as a contiguous little-endian bit stream. The widest kernel supported by the CPU
+// (AVX-512 or AVX2) is chosen once at runtime. The functions return false without writing
+// anything if no kernel is available for the CPU or the bit width, in which case callers fall
+// back to the scalar FastPForLib::fastunpack.
+struct BitpackingSIMD {
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+    // Only bit widths below 32 are vectorized.
+    static bool unpack(const uint8_t* in, uint32_t* out, uint8_t bitWidth);
+    static bool unpack(const uint8_t* in, uint64_t* out, uint8_t bitWidth);
+};
+
+} // namespace storage
+} // namespace kuzu
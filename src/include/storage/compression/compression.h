@@ -5,6 +5,7 @@
 #include <cstring>
 #include <optional>
 
+#include "common/enums/expression_type.h"
 #include "common/types/types.h"
 
 namespace kuzu {
@@ -17,6 +18,7 @@ namespace storage {
 class ColumnChunk;
 
 struct PageCursor;
+struct ZoneMapFilter;
 
 // Returns the size of the data type in bytes
 uint32_t getDataTypeSizeInChunk(const common::LogicalType& dataType);
@@ -29,10 +31,13 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    ALP = 4,
 };
 
+// Stored raw as part of ColumnChunkMetadata, so changing its size or layout requires bumping the
+// storage version.
 struct CompressionMetadata {
-    static constexpr uint8_t DATA_SIZE = 9;
+    static constexpr uint8_t DATA_SIZE = 10;
     CompressionType compression;
     // Extra data to be used to store codec-specific information
     std::array<uint8_t, DATA_SIZE> data;
@@ -265,6 +270,13 @@ public:
 
     static bool canUpdateInPlace(T value, const BitpackHeader& header);
 
+    // Evaluates `value <comparison> literal` on numValues values starting at srcOffset, writing one
+    // result per value. Unless values are sign extended, the literal is moved into the frame of
+    // reference instead, so values are compared right after being unpacked.
+    void filterFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* result,
+        uint64_t numValues, const CompressionMetadata& metadata, common::ExpressionType comparison,
+        T literal) const;
+
 protected:
     // Read multiple values from within a chunk. Cannot span multiple chunks.
     void getValues(const uint8_t* chunkStart, uint8_t pos, uint8_t* dst, uint8_t numValuesToRead,
@@ -277,6 +289,61 @@ protected:
     }
 };
 
+// Adaptive lossless floating point compression (ALP) for decimal values, e.g. prices or sensor
+// readings. Values are multiplied by 10^exponent and stored as integers with IntegerBitpacking
+// (including its frame of reference encoding), where the exponent is the smallest one with which
+// all values in the chunk can be restored exactly. Chunks with any value which cannot be restored,
+// such as NaN, -0.0 or values with too many significant digits, are stored uncompressed.
+//
+// Serialized as ten bytes: the BitpackHeader of the encoded integers, followed by the exponent.
+template<typename T>
+class FloatCompression : public CompressionAlg {
+    static_assert(std::is_floating_point_v<T>);
+    static constexpr uint8_t MAX_EXPONENT = std::is_same_v<T, float> ? 10 : 18;
+    static constexpr uint8_t EXPONENT_POS = 9;
+    // Values are encoded and decoded in batches of this size.
+    static constexpr uint64_t BATCH_SIZE = 1024;
+
+public:
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    static inline uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+        return IntegerBitpacking<int64_t>::numValues(dataSize,
+            BitpackHeader::readHeader(metadata.data));
+    }
+
+    CompressionMetadata getCompressionMetadata(const uint8_t* srcBuffer,
+        uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    static bool canUpdateInPlace(T value, const CompressionMetadata& metadata);
+
+    static inline uint8_t getExponent(const CompressionMetadata& metadata) {
+        return metadata.data[EXPONENT_POS];
+    }
+
+private:
+    // Returns std::nullopt if the value cannot be restored exactly from its encoding.
+    static std::optional<int64_t> encode(T value, uint8_t exponent);
+    static T decode(int64_t value, uint8_t exponent);
+
+    static inline CompressionMetadata getBitpackingMetadata(const CompressionMetadata& metadata) {
+        return CompressionMetadata(CompressionType::INTEGER_BITPACKING, metadata.data);
+    }
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
@@ -337,6 +404,25 @@ public:
         uint32_t startPosInResult, uint64_t numValuesToRead, const CompressionMetadata& metadata);
 };
 
+// Evaluates a filter on compressed values, without decompressing them into a vector. Writes
+// whether each value satisfies the filter to result, one byte per value.
+class FilterCompressedValuesFromPage : public CompressedFunctor {
+public:
+    explicit FilterCompressedValuesFromPage(const common::LogicalType& logicalType)
+        : CompressedFunctor(logicalType) {}
+    FilterCompressedValuesFromPage(const FilterCompressedValuesFromPage&) = default;
+
+    void operator()(const uint8_t* frame, PageCursor& pageCursor, uint8_t* result,
+        uint32_t startPosInResult, uint64_t numValuesToFilter, const CompressionMetadata& metadata,
+        const ZoneMapFilter& filter);
+
+private:
+    template<typename T>
+    void filter(const uint8_t* frame, PageCursor& pageCursor, uint8_t* result,
+        uint64_t numValuesToFilter, const CompressionMetadata& metadata,
+        const ZoneMapFilter& filter);
+};
+
 class WriteCompressedValuesToPage : public CompressedFunctor {
 public:
     explicit WriteCompressedValuesToPage(const common::LogicalType& logicalType)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string_view>
 
 #include "common/cast.h"
@@ -77,6 +78,11 @@ public:
     using Key =
         typename std::conditional<std::same_as<T, common::ku_string_t>, std::string_view, T>::type;
     bool lookupInternal(transaction::Transaction* transaction, Key key, common::offset_t& result);
+    // Looks up a batch of keys given their hashes. Persistent lookups are done in the order of
+    // the keys' primary slots, so that each slot is read once for all keys falling into it, and
+    // slot pages are visited in order. Keys which are not found get INVALID_OFFSET.
+    void lookupInternal(transaction::Transaction* transaction, std::span<const Key> keys,
+        std::span<const common::hash_t> hashes, common::offset_t* results);
     void deleteInternal(Key key) const;
     bool insertInternal(Key key, common::offset_t value);
 
@@ -269,6 +275,11 @@ public:
 
     bool lookup(transaction::Transaction* trx, common::ValueVector* keyVector, uint64_t vectorPos,
         common::offset_t& result);
+    // Looks up all selected keys of the vector at once. Keys are hashed once and grouped by hash
+    // index, instead of being looked up one by one. The result of the i-th selected key is written
+    // to results[i], which is INVALID_OFFSET if the key is null or not found.
+    void lookup(transaction::Transaction* trx, common::ValueVector* keyVector,
+        common::offset_t* results);
 
     inline bool insert(common::ku_string_t key, common::offset_t value) {
         return insert(key.getAsStringView(), value);
@@ -320,6 +331,11 @@ public:
     static void createEmptyHashIndexFiles(common::PhysicalTypeID typeID, const std::string& fName,
         common::VirtualFileSystem* vfs);
 
+private:
+    template<common::IndexHashable T>
+    void lookupBatch(transaction::Transaction* trx, common::ValueVector* keyVector,
+        common::offset_t* results);
+
 private:
     // When doing batch inserts, prepareCommit needs to be run before the COPY TABLE record is
     // logged to the WAL file, since the index is reloaded when that record is replayed. However
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <functional>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+class Column;
+class ColumnChunk;
+class StorageManager;
+
+// Appends the values of a chunk, the i-th of which belongs to the node at startNodeOffset + i, to
+// an in-memory index. deleted is indexed by node offset.
+using index_append_func_t = std::function<void(const ColumnChunk& chunk,
+    common::offset_t startNodeOffset, const std::vector<bool>& deleted)>;
+
+struct NodePropertyIndexUtils {
+    // Returns the column of an indexed node property.
+    static Column* getColumn(transaction::Transaction* transaction, const catalog::Catalog& catalog,
+        StorageManager& storageManager, common::table_id_t tableID,
+        common::property_id_t propertyID);
+    // Scans the values of the column which are visible to the transaction one node group at a
+    // time, to build an in-memory index on its property.
+    static void scanColumn(transaction::Transaction* transaction, StorageManager& storageManager,
+        common::table_id_t tableID, Column& column, const index_append_func_t& appendFunc);
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <span>
+#include <unordered_set>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace common {
+class ValueVector;
+} // namespace common
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+class ColumnChunk;
+class StorageManager;
+
+/*
+ * PropertyIndex is an in-memory snapshot of the committed values of a node property, sorted by
+ * value, so that the nodes whose value equals a key or lies within a range are found by binary
+ * search instead of scanning the node table. Nodes whose value is null or NaN and nodes which have
+ * been deleted are not indexed.
+ */
+class PropertyIndex {
+public:
+    virtual ~PropertyIndex() = default;
+
+    // Only properties of fixed size numeric, temporal and string types can be indexed.
+    static bool isIndexableType(common::LogicalTypeID typeID);
+    static std::unique_ptr<PropertyIndex> create(common::PhysicalTypeID physicalType);
+
+    // Indexes the non-null values of the chunk, the i-th of which belongs to the node at
+    // startNodeOffset + i. Entries are only searchable after finalize().
+    virtual void append(const ColumnChunk& chunk, common::offset_t startNodeOffset,
+        const std::vector<bool>& deleted) = 0;
+    // Indexes the value at position pos of the chunk, if it is not null, for the given node.
+    virtual void insert(const ColumnChunk& chunk, common::offset_t pos,
+        common::offset_t nodeOffset) = 0;
+    // Merges the entries appended or inserted since the last finalize() into the sorted entries.
+    virtual void finalize() = 0;
+    // Removes the entries of the given nodes.
+    virtual void remove(const std::unordered_set<common::offset_t>& nodeOffsetsToRemove) = 0;
+
+    // Positions [begin, end) of the entries whose value lies between the bounds, which are read
+    // at the first selected position of their vectors. A bound vector is nullptr if the range is
+    // unbounded on that side. The range is empty if any bound is null.
+    virtual std::pair<uint64_t, uint64_t> lookup(const common::ValueVector* lowerBound,
+        bool lowerInclusive, const common::ValueVector* upperBound, bool upperInclusive) const = 0;
+
+    inline uint64_t getNumEntries() const { return nodeOffsets.size(); }
+    // Node offsets of the entries in [begin, end). Offsets of equal values are in ascending order.
+    inline std::span<const common::offset_t> getNodeOffsets(uint64_t begin, uint64_t end) const {
+        return std::span<const common::offset_t>(nodeOffsets.data() + begin, end - begin);
+    }
+
+protected:
+    std::vector<common::offset_t> nodeOffsets;
+};
+
+/*
+ * PropertyIndexCache keeps the snapshots of the property indexes of the database, whose
+ * definitions are part of the catalog (see catalog::NodeTableCatalogEntry).
+ *
+ * Snapshots are loaded lazily and only hold committed values, so only read-only transactions use
+ * or cache them. When a write transaction commits, the inserts, updates and deletions in its local
+ * storage are applied to the snapshots of the tables it updated. Snapshots of tables which have
+ * been changed otherwise, e.g., by COPY, or of any table if the catalog changed, are dropped.
+ */
+class PropertyIndexCache {
+    using index_key_t = std::pair<common::table_id_t, common::property_id_t>;
+
+    struct Entry {
+        // Serializes loading and updating the snapshot.
+        std::mutex mtx;
+        std::shared_ptr<PropertyIndex> index;
+    };
+
+public:
+    explicit PropertyIndexCache(StorageManager& storageManager) : storageManager{storageManager} {}
+
+    static bool containsIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID);
+
+    // Returns the snapshot of the index, which is loaded by the calling thread if necessary.
+    std::shared_ptr<PropertyIndex> getIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID);
+
+    // Applies the changes of a committed write transaction to the snapshots of the tables it
+    // updated. No read-only transaction may be active meanwhile.
+    void applyCommittedChanges(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, const std::unordered_set<common::table_id_t>& tableIDs);
+
+    // Drops the snapshots of the indexes on the given tables.
+    void invalidate(const std::unordered_set<common::table_id_t>& tableIDs);
+    void invalidate();
+
+private:
+    std::unique_ptr<PropertyIndex> loadIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID) const;
+
+private:
+    StorageManager& storageManager;
+    mutable std::mutex mtx;
+    std::map<index_key_t, std::shared_ptr<Entry>> entries;
+};
+
+} // namespace storage
+} // namespace kuzu
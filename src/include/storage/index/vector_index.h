@@ -0,0 +1,134 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <unordered_set>
+
+#include "catalog/vector_index_config.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+class ColumnChunk;
+class StorageManager;
+
+/*
+ * VectorIndex is an in-memory HNSW graph (hierarchical navigable small world) over the committed
+ * values of a node property of type FLOAT[n] or DOUBLE[n], which answers approximate k nearest
+ * neighbor queries. Each layer is a proximity graph over a subset of the nodes of the layer
+ * below, whose size drops exponentially. A search descends greedily from the single node of the
+ * top layer, and explores the closest candidates of the bottom layer with a bounded beam.
+ * Nodes whose vector is null or contains a null or NaN element, nodes with a zero vector under
+ * the cosine metric and deleted nodes are not indexed.
+ *
+ * Vectors are inserted into the graph by several threads at once, which lock the neighbor lists
+ * they read or write. Removed vectors are only hidden from search results, as searches still
+ * pass through them.
+ */
+class VectorIndex {
+public:
+    virtual ~VectorIndex() = default;
+
+    static bool isIndexableType(const common::LogicalType& type);
+    static std::unique_ptr<VectorIndex> create(const common::LogicalType& type,
+        const catalog::VectorIndexConfig& config);
+
+    // Collects the vectors of the chunk, the i-th of which belongs to the node at
+    // startNodeOffset + i. Vectors are only searchable after finalize().
+    virtual void append(const ColumnChunk& chunk, common::offset_t startNodeOffset,
+        const std::vector<bool>& deleted) = 0;
+    // Collects the vector at position pos of the chunk, if it is indexable, for the given node.
+    virtual void insert(const ColumnChunk& chunk, common::offset_t pos,
+        common::offset_t nodeOffset) = 0;
+    // Inserts the vectors collected since the last finalize() into the graph, using up to
+    // numThreads threads.
+    virtual void finalize(uint64_t numThreads) = 0;
+    // Removes the vectors of the given nodes from search results.
+    virtual void remove(const std::unordered_set<common::offset_t>& nodeOffsetsToRemove) = 0;
+
+    // Returns the offsets of up to k nodes closest to the query vector, sorted by distance.
+    // Larger efSearch makes results more accurate and searches slower. Returns no nodes if the
+    // query vector is zero under the cosine metric.
+    virtual std::vector<std::pair<common::offset_t, double>> search(
+        const std::vector<double>& query, uint64_t k, uint64_t efSearch) const = 0;
+
+    inline uint64_t getDimension() const { return dimension; }
+    // Number of vectors in the graph, including removed ones.
+    inline uint64_t getNumVectors() const { return nodeOffsets.size(); }
+    inline uint64_t getNumRemovedVectors() const { return numRemovedVectors; }
+
+protected:
+    VectorIndex(uint64_t dimension, const catalog::VectorIndexConfig& config)
+        : dimension{dimension}, config{config}, numRemovedVectors{0} {}
+
+protected:
+    uint64_t dimension;
+    catalog::VectorIndexConfig config;
+    // Node offset of each vector.
+    std::vector<common::offset_t> nodeOffsets;
+    uint64_t numRemovedVectors;
+};
+
+/*
+ * VectorIndexCache keeps the graphs of the vector indexes of the database, whose definitions are
+ * part of the catalog (see catalog::NodeTableCatalogEntry).
+ *
+ * Graphs are built lazily from committed values. Write transactions share them with read-only
+ * transactions, as long as they have neither changed the table nor the catalog. When a write
+ * transaction commits, the vectors it inserted or updated are inserted into the graphs of the
+ * tables it updated, and the vectors it deleted or updated are removed. Graphs of tables which
+ * have been changed otherwise, e.g., by COPY, or of any table if the catalog changed, are
+ * dropped, and so are graphs which mostly hold removed vectors.
+ */
+class VectorIndexCache {
+    using index_key_t = std::pair<common::table_id_t, common::property_id_t>;
+
+    struct Entry {
+        // Serializes building and updating the graph.
+        std::mutex mtx;
+        std::shared_ptr<VectorIndex> index;
+    };
+
+public:
+    explicit VectorIndexCache(StorageManager& storageManager) : storageManager{storageManager} {}
+
+    static bool containsIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID);
+
+    // Returns the graph of the index, which is built with up to numThreads threads if necessary.
+    std::shared_ptr<VectorIndex> getIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID, uint64_t numThreads);
+
+    // Applies the changes of a committed write transaction to the graphs of the tables it
+    // updated. No read-only transaction may be active meanwhile.
+    void applyCommittedChanges(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, const std::unordered_set<common::table_id_t>& tableIDs,
+        uint64_t numThreads);
+
+    // Drops the graphs of all indexes.
+    void invalidate();
+
+private:
+    std::unique_ptr<VectorIndex> loadIndex(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t tableID,
+        common::property_id_t propertyID, uint64_t numThreads) const;
+
+private:
+    StorageManager& storageManager;
+    mutable std::mutex mtx;
+    std::map<index_key_t, std::shared_ptr<Entry>> entries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -116,6 +116,7 @@ public:
                srcNodeOffsetToRelOffsetVec.at(srcOffset).empty();
     }
     bool containsOffset(common::offset_t offset) { return deletedOffsets.contains(offset); }
+    const offset_set_t& getDeletedOffsets() const { return deletedOffsets; }
     bool deleteOffset(common::offset_t offset) {
         if (deletedOffsets.contains(offset)) {
             return false;
@@ -167,6 +168,7 @@ public:
         return updateChunks[columnID];
     }
     LocalChunkedGroupCollection& getInsertChunks() { return insertChunks; }
+    const LocalDeletionInfo& getDeleteInfo() const { return deleteInfo; }
 
     bool hasUpdatesOrDeletions() const;
 
@@ -187,6 +189,10 @@ public:
     virtual ~LocalTableData() = default;
 
     inline void clear() { nodeGroups.clear(); }
+    inline const std::unordered_map<common::node_group_idx_t, std::unique_ptr<LocalNodeGroup>>&
+    getNodeGroups() const {
+        return nodeGroups;
+    }
 
     bool insert(std::vector<common::ValueVector*> nodeIDVectors,
         std::vector<common::ValueVector*> propertyVectors);
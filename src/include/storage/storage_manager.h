@@ -2,8 +2,11 @@
 
 #include "catalog/catalog.h"
 #include "storage/index/hash_index.h"
+#include "storage/index/property_index.h"
+#include "storage/index/vector_index.h"
 #include "storage/stats/nodes_store_statistics.h"
 #include "storage/stats/rels_store_statistics.h"
+#include "storage/store/csr_graph.h"
 #include "storage/store/rel_table.h"
 #include "storage/wal/wal.h"
 
@@ -23,6 +26,8 @@ public:
     void prepareRollback(transaction::Transaction* transaction);
     void checkpointInMemory();
     void rollbackInMemory();
+    // Writes the dirty pages of the database files back and syncs the files.
+    void flushAllDirtyPages();
 
     PrimaryKeyIndex* getPKIndex(common::table_id_t tableID);
 
@@ -43,6 +48,9 @@ public:
     }
     inline RelsStoreStats* getRelsStatistics() { return relsStatistics.get(); }
     inline bool compressionEnabled() const { return enableCompression; }
+    inline CSRGraphCache* getCSRGraphCache() { return csrGraphCache.get(); }
+    inline PropertyIndexCache* getPropertyIndexCache() { return propertyIndexCache.get(); }
+    inline VectorIndexCache* getVectorIndexCache() { return vectorIndexCache.get(); }
 
 private:
     void loadTables(bool readOnly, const catalog::Catalog& catalog);
@@ -60,6 +68,9 @@ private:
     std::unique_ptr<NodesStoreStatsAndDeletedIDs> nodesStatisticsAndDeletedIDs;
     std::unique_ptr<RelsStoreStats> relsStatistics;
     std::unordered_map<common::table_id_t, std::unique_ptr<Table>> tables;
+    std::unique_ptr<CSRGraphCache> csrGraphCache;
+    std::unique_ptr<PropertyIndexCache> propertyIndexCache;
+    std::unique_ptr<VectorIndexCache> vectorIndexCache;
     MemoryManager& memoryManager;
     WAL* wal;
     bool enableCompression;
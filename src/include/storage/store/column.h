@@ -26,6 +26,9 @@ using read_values_to_page_func_t =
         uint32_t posInResult, uint64_t numValues, const CompressionMetadata& metadata)>;
 // This is a special usage for the `batchLookup` interface.
 using batch_lookup_func_t = read_values_to_page_func_t;
+using filter_values_func_t = std::function<void(const uint8_t* frame, PageCursor& pageCursor,
+    uint8_t* result, uint32_t posInResult, uint64_t numValues, const CompressionMetadata& metadata,
+    const ZoneMapFilter& filter)>;
 
 class NullColumn;
 class StructColumn;
@@ -46,6 +49,8 @@ public:
         ColumnChunkMetadata metadata;
         uint64_t numValuesPerPage = UINT64_MAX;
         common::node_group_idx_t nodeGroupIdx = common::INVALID_NODE_GROUP_IDX;
+        // End of the pages of the chunk which have been read ahead by scans.
+        common::page_idx_t readAheadEndPageIdx = 0;
         std::unique_ptr<ChunkState> nullState = nullptr;
         // Used for struct/list/string columns.
         std::vector<ChunkState> childrenStates;
@@ -126,6 +131,13 @@ public:
     virtual void scan(transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t startOffsetInGroup, common::offset_t endOffsetInGroup, uint8_t* result);
 
+    // Evaluates filter on the compressed values of the node IDs in nodeIDVector, which must be
+    // sequential, and removes node IDs whose values do not satisfy it from the selection vector.
+    // Nulls are not checked, so node IDs with null values may be kept. Only supported for the
+    // physical types of zone maps. Returns the number of node IDs left.
+    common::sel_t filter(transaction::Transaction* transaction, const ChunkState& state,
+        const common::ValueVector* nodeIDVector, const ZoneMapFilter& filter);
+
     // Write a single value from the vectorToWriteFrom.
     virtual void write(ChunkState& state, common::offset_t offsetInChunk,
         common::ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom);
@@ -155,8 +167,15 @@ protected:
     virtual void lookupValue(transaction::Transaction* transaction, ChunkState& state,
         common::offset_t nodeOffset, common::ValueVector* resultVector, uint32_t posInVector);
 
+    // Sequential scans read with LOW priority, so that the pages they read once don't push other
+    // pages out of the buffer pool.
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        BufferManager::PagePriority pagePriority = BufferManager::PagePriority::NORMAL);
+    // Loads the pages of the chunk from pageIdx on into the buffer pool in one batch, if they
+    // have not been read ahead yet, before a sequential scan pins them one by one.
+    void readAhead(transaction::Transaction* transaction, ChunkState& state,
+        common::page_idx_t pageIdx);
 
     virtual void writeValue(ChunkState& state, common::offset_t offsetInChunk,
         common::ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom);
@@ -239,6 +258,7 @@ protected:
     write_values_func_t writeFunc;
     read_values_to_page_func_t readToPageFunc;
     batch_lookup_func_t batchLookupFunc;
+    filter_values_func_t filterFunc;
     RWPropertyStats propertyStatistics;
     bool enableCompression;
 };
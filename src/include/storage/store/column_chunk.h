@@ -10,6 +10,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/compression/compression.h"
+#include "storage/store/zone_map.h"
 
 namespace kuzu {
 namespace storage {
@@ -22,6 +23,7 @@ struct ColumnChunkMetadata {
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    ZoneMap zoneMap;
 
     // TODO: Delete copy.
     ColumnChunkMetadata() : pageIdx{common::INVALID_PAGE_IDX}, numPages{0}, numValues{0} {}
@@ -124,6 +126,8 @@ protected:
 
 private:
     uint64_t getBufferSize(uint64_t capacity_) const;
+    // Min and max of the non-null values in the chunk.
+    ZoneMap getZoneMap() const;
 
 protected:
     common::LogicalType dataType;
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <mutex>
+#include <span>
+
+#include "common/enums/rel_direction.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+class RelTable;
+class StorageManager;
+
+// The rels of a rel table whose src and dst node tables are the same, optionally filtered on a
+// numeric rel property.
+struct GraphProjection {
+    common::table_id_t relTableID;
+    common::table_id_t nodeTableID;
+    // Rels whose value of the property is null or outside [lowerBound, upperBound] are excluded.
+    // INVALID_PROPERTY_ID if rels are not filtered.
+    common::property_id_t filterPropertyID;
+    double lowerBound;
+    double upperBound;
+
+    GraphProjection(common::table_id_t relTableID, common::table_id_t nodeTableID)
+        : relTableID{relTableID}, nodeTableID{nodeTableID},
+          filterPropertyID{common::INVALID_PROPERTY_ID}, lowerBound{0}, upperBound{0} {}
+    GraphProjection(common::table_id_t relTableID, common::table_id_t nodeTableID,
+        common::property_id_t filterPropertyID, double lowerBound, double upperBound)
+        : relTableID{relTableID}, nodeTableID{nodeTableID}, filterPropertyID{filterPropertyID},
+          lowerBound{lowerBound}, upperBound{upperBound} {}
+
+    inline bool hasFilter() const { return filterPropertyID != common::INVALID_PROPERTY_ID; }
+
+    // Only rels of fixed size numeric properties can be filtered.
+    static bool isFilterableType(common::LogicalTypeID typeID);
+};
+
+/*
+ * CSRGraph is an in-memory snapshot of the committed rels of a graph projection. Both CSRs of the
+ * rel table are scanned chunk by chunk for each node group and compacted into dense arrays, i.e.,
+ * the CSR offsets of all nodes of the node group, and the nbr and rel offsets of the rels which
+ * pass the filter without the gaps of the packed CSRs on disk. Nodes are indexed by their offsets.
+ * Nodes which have been deleted are still indexed but have no rels.
+ */
+class CSRGraph {
+    struct NodeGroupCSR {
+        // Rels of the i-th node of the node group are in [csrOffsets[i], csrOffsets[i + 1]).
+        std::vector<common::offset_t> csrOffsets;
+        std::vector<common::offset_t> nbrOffsets;
+        std::vector<common::offset_t> relOffsets;
+    };
+
+public:
+    CSRGraph(GraphProjection projection, common::column_id_t filterColumnID,
+        common::offset_t numNodes, const std::vector<common::offset_t>& deletedNodeOffsets);
+
+    inline const GraphProjection& getProjection() const { return projection; }
+    inline common::offset_t getNumNodes() const { return numNodes; }
+    inline common::offset_t getNumActiveNodes() const { return numNodes - numDeletedNodes; }
+    inline bool isDeleted(common::offset_t nodeOffset) const { return deleted[nodeOffset]; }
+    inline common::node_group_idx_t getNumNodeGroups() const { return fwdCSRs.size(); }
+    uint64_t getNumRels() const;
+
+    // Loads both CSRs of the node group. Node groups can be loaded concurrently.
+    void loadNodeGroup(transaction::Transaction* transaction, RelTable* relTable,
+        common::node_group_idx_t nodeGroupIdx);
+    void load(transaction::Transaction* transaction, RelTable* relTable);
+
+    // Offsets of the nbrs of the node over its rels in the given direction. Nodes which were
+    // inserted after the snapshot has been taken have no nbrs.
+    inline std::span<const common::offset_t> getNbrs(common::offset_t nodeOffset,
+        common::RelDataDirection direction) const {
+        return getCSRSpan(nodeOffset, direction, false /* isRel */);
+    }
+    // Offsets of the rels of the node in the given direction, in the order of its nbrs.
+    inline std::span<const common::offset_t> getRels(common::offset_t nodeOffset,
+        common::RelDataDirection direction) const {
+        return getCSRSpan(nodeOffset, direction, true /* isRel */);
+    }
+    inline uint64_t getNumNbrs(common::offset_t nodeOffset,
+        common::RelDataDirection direction) const {
+        return getNbrs(nodeOffset, direction).size();
+    }
+
+private:
+    std::span<const common::offset_t> getCSRSpan(common::offset_t nodeOffset,
+        common::RelDataDirection direction, bool isRel) const;
+
+private:
+    GraphProjection projection;
+    common::column_id_t filterColumnID;
+    common::offset_t numNodes;
+    common::offset_t numDeletedNodes;
+    std::vector<bool> deleted;
+    std::vector<NodeGroupCSR> fwdCSRs;
+    std::vector<NodeGroupCSR> bwdCSRs;
+};
+
+/*
+ * CSRGraphCache keeps the graph projections of the database by name, together with the snapshots
+ * of their rels, so that repeated traversals over the same rels read them from memory instead of
+ * scanning the rel table. Projections only live in memory, i.e., they are lost once the database
+ * is closed.
+ *
+ * Snapshots are loaded lazily and only hold committed rels, so they are dropped whenever a write
+ * transaction commits, and only read-only transactions use or cache them.
+ */
+class CSRGraphCache {
+    struct Entry {
+        GraphProjection projection;
+        // Serializes loading the snapshot.
+        std::mutex mtx;
+        std::shared_ptr<CSRGraph> graph;
+
+        explicit Entry(GraphProjection projection) : projection{projection} {}
+    };
+
+public:
+    explicit CSRGraphCache(StorageManager& storageManager) : storageManager{storageManager} {}
+
+    void addProjection(const std::string& name, GraphProjection projection);
+    void dropProjection(const std::string& name);
+    bool containsProjection(const std::string& name) const;
+    GraphProjection getProjection(const std::string& name) const;
+    // Name of a projection of all rels of the rel table. Empty if there is none.
+    std::string getUnfilteredProjectionName(common::table_id_t relTableID) const;
+
+    // Returns the snapshot of the projection, or nullptr if it has not been loaded since the last
+    // commit of a write transaction.
+    std::shared_ptr<CSRGraph> getCachedGraph(const std::string& name) const;
+    // Returns the snapshot of the projection, which is loaded by the calling thread if necessary.
+    std::shared_ptr<CSRGraph> getGraph(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, const std::string& name);
+    // Returns the snapshot of a projection of all rels of the rel table, which is loaded by the
+    // calling thread if necessary. Returns nullptr if there is no such projection.
+    std::shared_ptr<CSRGraph> getUnfilteredGraph(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, common::table_id_t relTableID);
+    // Caches a snapshot of the projection which has been loaded outside of the cache, unless the
+    // projection has been dropped or replaced meanwhile.
+    void cacheGraph(const std::string& name, std::shared_ptr<CSRGraph> graph);
+
+    // Creates an empty snapshot of the projection, whose node groups still need to be loaded.
+    std::unique_ptr<CSRGraph> createGraph(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, const GraphProjection& projection) const;
+
+    void invalidate();
+
+private:
+    std::shared_ptr<Entry> getEntry(const std::string& name) const;
+    std::shared_ptr<CSRGraph> getGraph(transaction::Transaction* transaction,
+        const catalog::Catalog& catalog, Entry& entry);
+
+private:
+    StorageManager& storageManager;
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -10,6 +10,7 @@
 #include "storage/store/chunked_node_group.h"
 #include "storage/store/node_table_data.h"
 #include "storage/store/table.h"
+#include "storage/store/zone_map.h"
 
 namespace kuzu {
 namespace transaction {
@@ -87,6 +88,17 @@ public:
             *readState.dataReadState);
     }
     void read(transaction::Transaction* transaction, TableReadState& readState) override;
+    // Returns false if zone maps show that no node in the node group can pass all filters. Local
+    // changes of write transactions are not covered by zone maps, so node groups are only ruled
+    // out for read-only transactions.
+    bool mayMatch(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
+        const std::vector<ZoneMapFilter>& filters);
+    // Evaluates filters on the compressed values of the node IDs of readState, whose columns must
+    // be the columns of the filters, and removes node IDs which do not satisfy all of them from the
+    // selection vector. As with zone maps, this is only done for read-only transactions. Returns
+    // false if no node ID is left.
+    bool filter(transaction::Transaction* transaction, TableReadState& readState,
+        const std::vector<ZoneMapFilter>& filters);
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(transaction::Transaction* transaction,
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <optional>
+#include <type_traits>
+
+#include "common/enums/expression_type.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class NullMask;
+class Value;
+} // namespace common
+
+namespace storage {
+
+// Signed integers are stored as int64_t, unsigned integers as uint64_t and floating point values as
+// double, so that zone maps of all supported physical types have the same size.
+union ZoneMapValue {
+    int64_t signedInt;
+    uint64_t unsignedInt;
+    double floatVal;
+};
+
+// Min and max of the non-null values in a column chunk. Zone maps are only kept for numeric
+// physical types; they are invalid for other types and for chunks without any non-null value.
+// Updates written in place can only widen the range, so the range may be looser than the values
+// in the chunk, but it always covers them.
+struct ZoneMap {
+    bool isValid = false;
+    ZoneMapValue min{};
+    ZoneMapValue max{};
+
+    // Widens the range to cover the value at pos in data, which holds values of physicalType.
+    // Invalid zone maps stay invalid.
+    void update(const uint8_t* data, common::offset_t pos, common::PhysicalTypeID physicalType);
+    // Returns false if no value within the range can satisfy `value <comparison> literal`.
+    bool mayMatch(common::ExpressionType comparison, ZoneMapValue literal,
+        common::PhysicalTypeID physicalType) const;
+
+    static bool isSupported(common::PhysicalTypeID physicalType);
+    // Computes the zone map of numValues values in data, skipping nulls if nullMask is not null.
+    static ZoneMap compute(const uint8_t* data, uint64_t numValues,
+        common::PhysicalTypeID physicalType, const common::NullMask* nullMask);
+};
+
+// A comparison between a column and a literal, e.g. `n.age > 30`, which is checked against zone
+// maps to skip node groups that cannot have any match, and evaluated on the compressed values of
+// the remaining node groups (see Column::filter).
+struct ZoneMapFilter {
+    common::column_id_t columnID;
+    common::ExpressionType comparison;
+    common::PhysicalTypeID physicalType;
+    ZoneMapValue literal;
+
+    // Returns std::nullopt if zone maps cannot be checked for the comparison or the type of the
+    // literal.
+    static std::optional<ZoneMapFilter> create(common::column_id_t columnID,
+        common::ExpressionType comparison, const common::Value& literal);
+
+    inline bool mayMatch(const ZoneMap& zoneMap) const {
+        return !zoneMap.isValid || zoneMap.mayMatch(comparison, literal, physicalType);
+    }
+
+    // Returns the literal as a value of physicalType, i.e. of the type of the column.
+    template<typename T>
+    inline T getLiteral() const {
+        if constexpr (std::is_floating_point_v<T>) {
+            return (T)literal.floatVal;
+        } else if constexpr (std::is_signed_v<T>) {
+            return (T)literal.signedInt;
+        } else {
+            return (T)literal.unsignedInt;
+        }
+    }
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -20,6 +20,14 @@ constexpr uint64_t WAL_HEADER_PAGE_NEXT_HEADER_PAGE_IDX_FIELD_SIZE = sizeof(comm
 constexpr uint64_t WAL_HEADER_PAGE_PREFIX_FIELD_SIZES =
     WAL_HEADER_PAGE_NUM_RECORDS_FIELD_SIZE + WAL_HEADER_PAGE_NEXT_HEADER_PAGE_IDX_FIELD_SIZE;
 
+/*
+ * The WAL holds the records and shadow pages of the committed transactions which have not been
+ * checkpointed yet, followed by those of the active write transaction. Write transactions which
+ * only update pages and table statistics are committed in memory without writing their pages back
+ * to the database files, i.e., their checkpoint is deferred. Their records are kept in the WAL
+ * until the next checkpoint, which writes back all dirty pages of the database files and clears
+ * the WAL.
+ */
 class WALReplayer;
 class WAL {
     friend class WALReplayer;
@@ -39,6 +47,9 @@ public:
     common::page_idx_t logPageInsertRecord(DBFileID dbFileID,
         common::page_idx_t pageIdxInOriginalFile);
 
+    // The caller needs to flush the pages of the transaction before logging its commit, so that
+    // commits only show up in the file when their data is also written. The commit is durable
+    // once this function returns.
     void logCommit(uint64_t transactionID);
 
     void logTableStatisticsRecord(common::TableType tableType);
@@ -56,6 +67,12 @@ public:
 
     // Removes the contents of WAL file.
     void clearWAL();
+    // Keeps the records of the transaction which has been committed in memory until the next
+    // checkpoint.
+    void deferCheckpoint();
+    // Removes the records and shadow pages of the active write transaction, which has been rolled
+    // back.
+    void clearUncommittedRecords();
 
     // We might need another way to check that the last record is commit for recovery and then
     // we might remove this for now to reduce our code size.
@@ -64,9 +81,19 @@ public:
         return isLastRecordCommit;
     }
 
-    void flushAllPages();
+    // Writes the buffered records and dirty shadow pages to disk, and syncs them if shouldSync.
+    void flushAllPages(bool shouldSync = true);
 
     bool isEmptyWAL() const;
+    // Whether the checkpoint of the active write transaction can be deferred, i.e., it has only
+    // logged page updates and insertions, and table statistics.
+    inline bool canDeferCheckpoint() const { return !hasRecordsRequiringCheckpoint; }
+    // Whether all records are of committed transactions whose checkpoint has been deferred.
+    bool hasOnlyDeferredRecords() const;
+    inline uint64_t getCommittedRecordsSize() const { return committedRecordsSize; }
+    uint64_t getRecordsSize() const;
+    // Size of the records and shadow pages in bytes.
+    uint64_t getSizeInBytes() const;
 
     // TODO(Guodong): I feel this interface is used in a abused way. Should revisit and clean up.
     inline std::string getDirectory() const { return directory; }
@@ -78,7 +105,7 @@ public:
     BMFileHandle& getShadowingFH() { return *shadowingFH; }
 
 private:
-    void initialize();
+    void initialize(bool readOnly);
     void addNewWALRecordNoLock(WALRecord& walRecord);
 
 private:
@@ -94,6 +121,12 @@ private:
     common::VirtualFileSystem* vfs;
     bool isEmpty;
     bool isLastRecordCommit;
+    bool hasRecordsRequiringCheckpoint;
+    // Size of the records of the committed transactions which have not been checkpointed yet, and
+    // number of their shadow pages. The records and shadow pages of the active write transaction
+    // follow them.
+    uint64_t committedRecordsSize;
+    common::page_idx_t numCommittedShadowPages;
 };
 
 } // namespace storage
@@ -10,7 +10,12 @@ namespace storage {
 
 class StorageManager;
 class BufferManager;
-enum class WALReplayMode : uint8_t { COMMIT_CHECKPOINT, ROLLBACK, RECOVERY_CHECKPOINT };
+enum class WALReplayMode : uint8_t {
+    COMMIT_CHECKPOINT,
+    COMMIT_DEFERRED_CHECKPOINT,
+    ROLLBACK,
+    RECOVERY_CHECKPOINT
+};
 
 // Note: This class is not thread-safe.
 class WALReplayer {
@@ -45,6 +50,9 @@ private:
 private:
     bool isRecovering;
     bool isCheckpoint; // if true does redo operations; if false does undo operations
+    // If true, updated pages are only written to their frames in the buffer manager, which are
+    // written back to the database files at the next checkpoint.
+    bool isCheckpointDeferred;
     // Warning: Some fields of the storageManager may not yet be initialized if the WALReplayer
     // has been initialized during recovery, i.e., isRecovering=true.
     StorageManager* storageManager;
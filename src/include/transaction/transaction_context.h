@@ -53,7 +53,10 @@ private:
     void rollbackInternal(bool skipCheckPointing);
 
 private:
-    void beginTransactionInternal(TransactionType transactionType);
+    // Auto-commit write transactions wait for the active write transaction of other connections
+    // to finish, while manual ones fail immediately.
+    void beginTransactionInternal(TransactionType transactionType,
+        bool shouldWaitForActiveWriteTransaction = false);
 
 private:
     std::mutex mtx;
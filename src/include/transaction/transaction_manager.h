@@ -1,5 +1,6 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -20,7 +21,10 @@ class TransactionManager {
 public:
     explicit TransactionManager(storage::WAL& wal)
         : wal{wal}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0}, lastCommitID{0} {};
-    std::unique_ptr<Transaction> beginWriteTransaction(main::ClientContext& clientContext);
+    // If shouldWait, waits up to writeTransactionWaitTimeoutInMicros for the active write
+    // transaction to finish instead of throwing immediately.
+    std::unique_ptr<Transaction> beginWriteTransaction(main::ClientContext& clientContext,
+        bool shouldWait = false);
     std::unique_ptr<Transaction> beginReadOnlyTransaction(main::ClientContext& clientContext);
     void commit(Transaction* transaction);
     void commitButKeepActiveWriteTransaction(Transaction* transaction);
@@ -30,6 +34,9 @@ public:
     // unlocked later by calling allowReceivingNewTransactions() by the thread that called
     // stopNewTransactionsAndWaitUntilAllReadTransactionsLeave().
     void stopNewTransactionsAndWaitUntilAllReadTransactionsLeave();
+    // Stops new transactions as above if there is no active transaction. Returns false without
+    // stopping them otherwise.
+    bool stopNewTransactionsIfNoActiveTransaction();
     void allowReceivingNewTransactions();
 
     // Warning: Below public functions are for tests only
@@ -48,6 +55,9 @@ public:
     inline void setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(uint64_t waitTimeInMicros) {
         checkPointWaitTimeoutForTransactionsToLeaveInMicros = waitTimeInMicros;
     }
+    inline void setWriteTransactionWaitTimeoutInMicros(uint64_t waitTimeInMicros) {
+        writeTransactionWaitTimeoutInMicros = waitTimeInMicros;
+    }
 
 private:
     inline bool hasActiveWriteTransactionNoLock() const {
@@ -56,6 +66,7 @@ private:
     inline void clearActiveWriteTransactionIfWriteTransactionNoLock(Transaction* transaction) {
         if (transaction->isWriteTransaction()) {
             activeWriteTransactionID = INT64_MAX;
+            cvForActiveWriteTransaction.notify_all();
         }
     }
     void commitOrRollbackNoLock(Transaction* transaction, bool isCommit);
@@ -82,8 +93,13 @@ private:
     // function, which needs to let calls to comming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
+    // Notified with mtxForSerializingPublicFunctionCalls when the active write transaction
+    // finishes.
+    std::condition_variable cvForActiveWriteTransaction;
     uint64_t checkPointWaitTimeoutForTransactionsToLeaveInMicros =
         common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS;
+    uint64_t writeTransactionWaitTimeoutInMicros =
+        common::DEFAULT_WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS;
 };
 } // namespace transaction
 } // namespace kuzu
@@ -10,6 +10,7 @@
 #include "extension/extension.h"
 #include "main/database.h"
 #include "main/db_config.h"
+#include "main/streaming_query.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
@@ -60,6 +61,12 @@ ClientContext::ClientContext(Database* database) : database{database} {
     config.showProgressAfter = ClientConfigDefault::SHOW_PROGRESS_AFTER;
     config.recursivePatternSemantic = ClientConfigDefault::RECURSIVE_PATTERN_SEMANTIC;
     config.recursivePatternCardinalityScaleFactor = ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
+    config.hashJoinMemoryFraction = ClientConfigDefault::HASH_JOIN_MEMORY_FRACTION;
+    config.enableStreamingResults = ClientConfigDefault::ENABLE_STREAMING_RESULTS;
+}
+
+ClientContext::~ClientContext() {
+    finishStreamingQueryNoLock();
 }
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
@@ -201,6 +208,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
         return preparedStatementWithError("Connection Exception: Query is empty.");
     }
     std::unique_lock<std::mutex> lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -217,6 +225,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
 std::unique_ptr<PreparedStatement> ClientContext::prepareTest(std::string_view query) {
     auto preparedStatement = std::unique_ptr<PreparedStatement>();
     std::unique_lock<std::mutex> lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -241,6 +250,7 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (query.empty()) {
         return queryResultWithError("Connection Exception: Query is empty.");
     }
@@ -255,8 +265,10 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
+        // Results of multiple statements are materialized, since each statement ends the
+        // transaction of the previous one.
         auto currentQueryResult = executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get(), 0u,
-            false /*requiredNexTx*/);
+            false /*requiredNexTx*/, parsedStatements.size() == 1 /* canStreamResults */);
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -376,6 +388,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
         inputParams) { // NOLINT(performance-unnecessary-value-param): It doesn't make sense to pass
                        // the map as a const reference.
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -389,7 +402,8 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeAndAutoCommitIfNecessaryNoLock(rebindPreparedStatement.get(), 0u, false);
+    return executeAndAutoCommitIfNecessaryNoLock(rebindPreparedStatement.get(), 0u, false,
+        true /* canStreamResults */);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -408,7 +422,8 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
 }
 
 std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLock(
-    PreparedStatement* preparedStatement, uint32_t planIdx, bool requiredNexTx) {
+    PreparedStatement* preparedStatement, uint32_t planIdx, bool requiredNexTx,
+    bool canStreamResults) {
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -433,6 +448,9 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
             return queryResultWithError(exception.what());
         }
     }
+    if (canStreamResults && shouldStreamResultsNoLock(preparedStatement)) {
+        return executeStreamingNoLock(preparedStatement, std::move(physicalPlan));
+    }
     auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
     auto profiler = std::make_unique<Profiler>();
     auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this);
@@ -465,6 +483,52 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     return queryResult;
 }
 
+bool ClientContext::shouldStreamResultsNoLock(PreparedStatement* preparedStatement) const {
+    // Only the results of read-only queries are streamed, whose execution has no side effects
+    // that should be complete once the query returns. The progress bar would be printed in
+    // between results.
+    return config.enableStreamingResults && !config.enableProgressBar &&
+           preparedStatement->preparedSummary.statementType == StatementType::QUERY &&
+           preparedStatement->isReadOnly();
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeStreamingNoLock(
+    PreparedStatement* preparedStatement, std::unique_ptr<PhysicalPlan> physicalPlan) {
+    auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
+    auto profiler = std::make_unique<Profiler>();
+    auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this);
+    auto executingTimer = TimeMetric(true /* enable */);
+    executingTimer.start();
+    std::shared_ptr<FactorizedTable> firstTable;
+    try {
+        auto resultStream =
+            database->queryProcessor->executeStreaming(physicalPlan.get(), executionContext.get());
+        streamingQuery = std::make_shared<StreamingQuery>(this, std::move(profiler),
+            std::move(physicalPlan), std::move(executionContext), std::move(resultStream));
+        firstTable = streamingQuery->getNextTable();
+    } catch (Exception& exception) {
+        // The streaming query has already rolled back the transaction if it failed.
+        if (streamingQuery == nullptr) {
+            this->transactionContext->rollback();
+        }
+        streamingQuery.reset();
+        return queryResultWithError(std::string(exception.what()));
+    }
+    executingTimer.stop();
+    queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    queryResult->initResultTableAndIterator(std::move(firstTable),
+        preparedStatement->statementResult->getColumns());
+    queryResult->streamingQuery = streamingQuery;
+    return queryResult;
+}
+
+void ClientContext::finishStreamingQueryNoLock() {
+    if (streamingQuery != nullptr) {
+        streamingQuery->finish();
+        streamingQuery.reset();
+    }
+}
+
 void ClientContext::addScalarFunction(std::string name, function::function_set definitions) {
     database->catalog->addFunction(CatalogEntryType::SCALAR_FUNCTION_ENTRY, std::move(name),
         std::move(definitions));
@@ -33,8 +33,10 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize)
-    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly) {
+    bool readOnly, uint64_t maxDBSize, uint64_t checkpointThreshold,
+    uint64_t checkpointIntervalInMs)
+    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly),
+      checkpointThreshold{checkpointThreshold}, checkpointIntervalInMs{checkpointIntervalInMs} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -87,6 +89,9 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
     initDBDirAndCoreFilesIfNecessary();
+    if (!systemConfig.readOnly) {
+        removeSpillFiles(&clientContext);
+    }
     wal =
         std::make_unique<WAL>(this->databasePath, systemConfig.readOnly, *bufferManager, vfs.get());
     recoverIfNecessary();
@@ -96,9 +101,29 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     transactionManager = std::make_unique<transaction::TransactionManager>(*wal);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
     databaseManager = std::make_unique<DatabaseManager>();
+    if (!systemConfig.readOnly && systemConfig.checkpointIntervalInMs > 0) {
+        checkpointThread = std::thread([this]() { checkpointPeriodically(); });
+    }
 }
 
 Database::~Database() {
+    {
+        std::unique_lock lck{checkpointMtx};
+        isClosing = true;
+    }
+    checkpointCV.notify_all();
+    if (checkpointThread.joinable()) {
+        checkpointThread.join();
+    }
+    // The WAL keeps records which have not been committed if a failure has been simulated in
+    // tests. They are replayed or discarded when the database is opened again.
+    if (!systemConfig.readOnly && wal->hasOnlyDeferredRecords()) {
+        try {
+            checkpointDeferredCommits();
+        } catch (std::exception& e) {
+            logger->error("Failed to checkpoint the WAL: {}", e.what());
+        }
+    }
     dropLoggers();
     bufferManager->clearEvictionQueue();
 }
@@ -173,6 +198,16 @@ void Database::initDBDirAndCoreFilesIfNecessary() {
     }
 }
 
+void Database::removeSpillFiles(ClientContext* context) {
+    // Spill files are removed by the operators owning them, unless the process crashed. No other
+    // process can be using them, since we hold the write lock on the database directory.
+    auto pattern =
+        vfs->joinPath(databasePath, std::string("*") + StorageConstants::SPILL_FILE_SUFFIX);
+    for (auto& path : vfs->glob(context, pattern)) {
+        vfs->removeFileIfExists(path);
+    }
+}
+
 void Database::initLoggers() {
     // To avoid multi-threading issue in creating logger, we create all loggers together with
     // database instance. All system components should get logger instead of creating.
@@ -206,6 +241,9 @@ void Database::commit(Transaction* transaction, bool skipCheckpointForTestingRec
     KU_ASSERT(transaction->isWriteTransaction());
     catalog->prepareCommitOrRollback(TransactionAction::COMMIT, vfs.get());
     storageManager->prepareCommit(transaction, vfs.get());
+    // Pages and records of the transaction are flushed before stopping new transactions, so
+    // that only the commit record is synced while read transactions are waiting.
+    wal->flushAllPages();
     // Note: It is enough to stop and wait transactions to leave the system instead of
     // for example checking on the query processor's task scheduler. This is because the
     // first and last steps that a connection performs when executing a query is to
@@ -217,12 +255,33 @@ void Database::commit(Transaction* transaction, bool skipCheckpointForTestingRec
     // Note: committing and stopping new transactions can be done in any order. This
     // order allows us to throw exceptions if we have to wait a lot to stop.
     transactionManager->commitButKeepActiveWriteTransaction(transaction);
-    wal->flushAllPages();
+    // Projected graph snapshots only hold committed rels. No read transaction is using them now.
+    storageManager->getCSRGraphCache()->invalidate();
+    // So do property index snapshots and vector index graphs, to which the changes of the
+    // transaction are applied, unless it changed the catalog.
+    if (catalog->hasUpdates()) {
+        storageManager->getPropertyIndexCache()->invalidate();
+        storageManager->getVectorIndexCache()->invalidate();
+    } else {
+        storageManager->getPropertyIndexCache()->applyCommittedChanges(transaction, *catalog,
+            wal->getUpdatedTables());
+        storageManager->getVectorIndexCache()->applyCommittedChanges(transaction, *catalog,
+            wal->getUpdatedTables(), systemConfig.maxNumThreads);
+    }
     if (skipCheckpointForTestingRecovery) {
         transactionManager->allowReceivingNewTransactions();
         return;
     }
-    checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT);
+    if (getenv("NODEFER") == nullptr && wal->canDeferCheckpoint() && wal->getSizeInBytes() < systemConfig.checkpointThreshold) {
+        // Updated pages stay in the buffer manager and the WAL until the next checkpoint.
+        auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
+            bufferManager.get(), catalog.get(), WALReplayMode::COMMIT_DEFERRED_CHECKPOINT,
+            vfs.get());
+        walReplayer->replay();
+        wal->deferCheckpoint();
+    } else {
+        checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT);
+    }
     transactionManager->manuallyClearActiveWriteTransaction(transaction);
     transactionManager->allowReceivingNewTransactions();
 }
@@ -247,6 +306,10 @@ void Database::rollback(transaction::Transaction* transaction,
 void Database::checkpointAndClearWAL(WALReplayMode replayMode) {
     KU_ASSERT(replayMode == WALReplayMode::COMMIT_CHECKPOINT ||
               replayMode == WALReplayMode::RECOVERY_CHECKPOINT);
+    if (replayMode == WALReplayMode::COMMIT_CHECKPOINT && wal->getCommittedRecordsSize() > 0) {
+        // Pages of the transactions whose checkpoint has been deferred are only in their frames.
+        storageManager->flushAllDirtyPages();
+    }
     auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
         bufferManager.get(), catalog.get(), replayMode, vfs.get());
     walReplayer->replay();
@@ -257,9 +320,34 @@ void Database::rollbackAndClearWAL() {
     auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
         bufferManager.get(), catalog.get(), WALReplayMode::ROLLBACK, vfs.get());
     walReplayer->replay();
+    wal->clearUncommittedRecords();
+}
+
+void Database::checkpointDeferredCommits() {
+    storageManager->flushAllDirtyPages();
     wal->clearWAL();
 }
 
+void Database::checkpointPeriodically() {
+    std::unique_lock lck{checkpointMtx};
+    while (!checkpointCV.wait_for(lck,
+        std::chrono::milliseconds(systemConfig.checkpointIntervalInMs),
+        [&]() { return isClosing; })) {
+        // Neither read transactions nor the write transaction wait for the checkpoint to start.
+        if (!transactionManager->stopNewTransactionsIfNoActiveTransaction()) {
+            continue;
+        }
+        try {
+            if (wal->hasOnlyDeferredRecords()) {
+                checkpointDeferredCommits();
+            }
+        } catch (std::exception& e) {
+            logger->error("Failed to checkpoint the WAL: {}", e.what());
+        }
+        transactionManager->allowReceivingNewTransactions();
+    }
+}
+
 void Database::recoverIfNecessary() {
     if (!wal->isEmptyWAL()) {
         logger->info("Starting up StorageManager and found a non-empty WAL with a committed "
@@ -17,7 +17,9 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(HomeDirectorySetting), GET_CONFIGURATION(FileSearchPathSetting),
     GET_CONFIGURATION(ProgressBarSetting), GET_CONFIGURATION(ProgressBarTimerSetting),
     GET_CONFIGURATION(RecursivePatternSemanticSetting),
-    GET_CONFIGURATION(RecursivePatternFactorSetting)};
+    GET_CONFIGURATION(RecursivePatternFactorSetting),
+    GET_CONFIGURATION(HashJoinMemoryFractionSetting),
+    GET_CONFIGURATION(EnableStreamingResultsSetting)};
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
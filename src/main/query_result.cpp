@@ -5,6 +5,7 @@
 #include "common/exception/runtime.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
+#include "main/streaming_query.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -23,7 +24,11 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary) {
     queryResultIterator = QueryResultIterator{this};
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (streamingQuery != nullptr) {
+        streamingQuery->finish();
+    }
+}
 
 bool QueryResult::isSuccess() const {
     return success;
@@ -46,6 +51,9 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
+    if (streamingQuery != nullptr) {
+        throw RuntimeException("Cannot get the number of tuples of a streamed query result.");
+    }
     return factorizedTable->getTotalNumFlatTuples();
 }
 
@@ -54,6 +62,9 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    if (streamingQuery != nullptr) {
+        throw RuntimeException("Cannot reset the iterator of a streamed query result.");
+    }
     iterator->resetState();
 }
 
@@ -62,7 +73,6 @@ void QueryResult::initResultTableAndIterator(
     const binder::expression_vector& columns) {
     factorizedTable = std::move(factorizedTable_);
     tuple = std::make_shared<FlatTuple>();
-    std::vector<Value*> valuesToCollect;
     for (auto i = 0u; i < columns.size(); ++i) {
         auto column = columns[i].get();
         auto columnType = column->getDataType();
@@ -71,15 +81,40 @@ void QueryResult::initResultTableAndIterator(
         columnNames.push_back(columnName);
         std::unique_ptr<Value> value =
             std::make_unique<Value>(Value::createDefaultValue(columnType));
-        valuesToCollect.push_back(value.get());
         tuple->addValue(std::move(value));
     }
+    initIterator();
+}
+
+void QueryResult::initIterator() const {
+    std::vector<Value*> valuesToCollect;
+    for (auto i = 0u; i < tuple->len(); ++i) {
+        valuesToCollect.push_back(tuple->getValue(i));
+    }
     iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
 }
 
+bool QueryResult::fetchNextTable() const {
+    if (streamingQuery == nullptr) {
+        return false;
+    }
+    auto table = streamingQuery->getNextTable();
+    if (table == nullptr) {
+        return false;
+    }
+    factorizedTable = std::move(table);
+    initIterator();
+    return true;
+}
+
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
-    return iterator->hasNextFlatTuple();
+    while (!iterator->hasNextFlatTuple()) {
+        if (!fetchNextTable()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool QueryResult::hasNextQueryResult() const {
@@ -115,7 +150,9 @@ std::string QueryResult::toString() {
             result += columnNames[i];
         }
         result += "\n";
-        resetIterator();
+        if (streamingQuery == nullptr) {
+            resetIterator();
+        }
         while (hasNext()) {
             getNext();
             result += tuple->toString();
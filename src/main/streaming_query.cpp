@@ -0,0 +1,64 @@
+#include "main/streaming_query.h"
+
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+StreamingQuery::StreamingQuery(ClientContext* clientContext, std::unique_ptr<Profiler> profiler,
+    std::unique_ptr<PhysicalPlan> physicalPlan, std::unique_ptr<ExecutionContext> executionContext,
+    std::unique_ptr<ResultStream> resultStream)
+    : clientContext{clientContext}, profiler{std::move(profiler)},
+      physicalPlan{std::move(physicalPlan)}, executionContext{std::move(executionContext)},
+      resultStream{std::move(resultStream)}, finished{false}, exhausted{false} {}
+
+std::shared_ptr<FactorizedTable> StreamingQuery::getNextTable() {
+    std::unique_lock lck{mtx};
+    if (exhausted) {
+        return nullptr;
+    }
+    if (finished) {
+        throw RuntimeException("Cannot read the rest of a streamed query result once another "
+                               "query has run over the same connection.");
+    }
+    std::shared_ptr<FactorizedTable> table;
+    try {
+        table = resultStream->getNextTable();
+    } catch (...) {
+        finishNoLock(false /* success */);
+        throw;
+    }
+    if (!resultStream->hasMoreTables()) {
+        exhausted = true;
+        finishNoLock(true /* success */);
+    }
+    return table;
+}
+
+void StreamingQuery::finish() {
+    std::unique_lock lck{mtx};
+    if (!finished) {
+        finishNoLock(true /* success */);
+    }
+}
+
+void StreamingQuery::finishNoLock(bool success) {
+    finished = true;
+    resultStream.reset();
+    executionContext.reset();
+    physicalPlan.reset();
+    profiler.reset();
+    auto transactionContext = clientContext->getTransactionContext();
+    if (!success) {
+        transactionContext->rollback();
+    } else if (transactionContext->isAutoTransaction()) {
+        transactionContext->commit();
+    }
+}
+
+} // namespace main
+} // namespace kuzu
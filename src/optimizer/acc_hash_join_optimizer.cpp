@@ -7,6 +7,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
+#include "planner/operator/scan/logical_scan_node_property.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 
 using namespace kuzu::common;
@@ -30,16 +31,39 @@ void HashJoinSIPOptimizer::visitOperator(planner::LogicalOperator* op) {
 
 void HashJoinSIPOptimizer::visitHashJoin(planner::LogicalOperator* op) {
     auto hashJoin = (LogicalHashJoin*)op;
-    if (hashJoin->getSIP() == planner::SidewaysInfoPassing::PROHIBIT) {
+    if (hashJoin->getJoinType() != JoinType::INNER) {
         return;
     }
-    if (hashJoin->getJoinType() != JoinType::INNER) {
+    // Semi masks are prohibited for joins rewritten from filters, which are on non-ID keys and
+    // thus can still use key filters.
+    if (hashJoin->getSIP() != planner::SidewaysInfoPassing::PROHIBIT) {
+        if (!tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
+            tryProbeToBuildHJSIP(op);
+        }
+    }
+    tryBuildToProbeKeyFilter(op);
+}
+
+void HashJoinSIPOptimizer::tryBuildToProbeKeyFilter(planner::LogicalOperator* op) {
+    auto hashJoin = (LogicalHashJoin*)op;
+    // The probe side is accumulated before the build side is evaluated.
+    if (hashJoin->getSIP() == planner::SidewaysInfoPassing::PROBE_TO_BUILD) {
         return;
     }
-    if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
+    auto joinConditions = hashJoin->getJoinConditions();
+    if (joinConditions.size() != 1) {
         return;
     }
-    tryProbeToBuildHJSIP(op);
+    auto& [probeKey, buildKey] = joinConditions[0];
+    // Node ID keys are filtered by semi masks.
+    if (probeKey->expressionType != ExpressionType::PROPERTY ||
+        probeKey->dataType != buildKey->dataType) {
+        return;
+    }
+    auto scan = resolveScanNodePropertyToApplyKeyFilter(*probeKey, hashJoin->getChild(0).get());
+    if (scan != nullptr) {
+        hashJoin->setScanToApplyKeyFilter(scan);
+    }
 }
 
 bool HashJoinSIPOptimizer::tryProbeToBuildHJSIP(planner::LogicalOperator* op) {
@@ -217,6 +241,35 @@ HashJoinSIPOptimizer::resolveShortestPathExtendToApplySemiMask(const binder::Exp
     return result;
 }
 
+planner::LogicalOperator* HashJoinSIPOptimizer::resolveScanNodePropertyToApplyKeyFilter(
+    const binder::Expression& key, planner::LogicalOperator* root) {
+    auto op = root;
+    while (true) {
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+            auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(op);
+            for (auto& property : scan->getProperties()) {
+                if (property->getUniqueName() == key.getUniqueName()) {
+                    return scan->getTableIDs().size() == 1 ? op : nullptr;
+                }
+            }
+        } break;
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::HASH_JOIN:
+        case LogicalOperatorType::INTERSECT:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::SEMI_MASKER:
+            // Probe sides of joins are in the same pipeline.
+            break;
+        default:
+            return nullptr;
+        }
+        op = op->getChild(0).get();
+    }
+}
+
 std::shared_ptr<planner::LogicalOperator> HashJoinSIPOptimizer::appendNodeSemiMasker(
     std::vector<planner::LogicalOperator*> opsToApplySemiMask,
     std::shared_ptr<planner::LogicalOperator> child) {
@@ -4,12 +4,15 @@
 #include "binder/expression/property_expression.h"
 #include "binder/expression_visitor.h"
 #include "common/cast.h"
+#include "main/client_context.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_dummy_scan.h"
 #include "planner/operator/scan/logical_index_scan.h"
+#include "planner/operator/scan/logical_property_index_scan.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
+#include "storage/index/property_index.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -37,7 +40,7 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitOperator
     default: { // Stop current push down for unhandled operator.
         for (auto i = 0u; i < op->getNumChildren(); ++i) {
             // Start new push down for child.
-            auto optimizer = FilterPushDownOptimizer();
+            auto optimizer = FilterPushDownOptimizer(context);
             op->setChild(i, optimizer.visitOperator(op->getChild(i)));
         }
         op->computeFlatSchema();
@@ -80,10 +83,10 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     }
     KU_ASSERT(op->getNumChildren() == 2);
     // Push probe side
-    auto probeOptimizer = FilterPushDownOptimizer(std::move(probePSet));
+    auto probeOptimizer = FilterPushDownOptimizer(context, std::move(probePSet));
     op->setChild(0, probeOptimizer.visitOperator(op->getChild(0)));
     // Push build side
-    auto buildOptimizer = FilterPushDownOptimizer(std::move(buildPSet));
+    auto buildOptimizer = FilterPushDownOptimizer(context, std::move(buildPSet));
     op->setChild(1, buildOptimizer.visitOperator(op->getChild(1)));
 
     auto probeSchema = op->getChild(0)->getSchema();
@@ -130,6 +133,7 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
     if (tableIDs.size() == 1) {
         primaryKeyEqualityComparison = predicateSet.popNodePKEqualityComparison(*nodeID);
     }
+    auto hasIndexScan = false;
     if (primaryKeyEqualityComparison != nullptr) { // Try rewrite index scan
         auto rhs = primaryKeyEqualityComparison->getChild(1);
         if (rhs->expressionType == ExpressionType::LITERAL) {
@@ -143,18 +147,36 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
                 std::move(expressionsScan));
             indexScan->computeFlatSchema();
             op->setChild(0, std::move(indexScan));
+            hasIndexScan = true;
         } else {
             // Cannot rewrite and add predicate back.
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (!hasIndexScan && tableIDs.size() == 1 &&
+        op->getChild(0)->getOperatorType() == LogicalOperatorType::SCAN_INTERNAL_ID) {
+        auto propertyIndexScan = getPropertyIndexScan(nodeID, tableIDs[0]);
+        if (propertyIndexScan != nullptr) {
+            op->setChild(0, std::move(propertyIndexScan));
+            hasIndexScan = true;
+        }
+    }
+    // Zone maps are checked by the first scan, so that node groups without any match are skipped
+    // before any property is read. Node IDs produced by index scans are not sequential, so zone
+    // maps cannot be checked on them.
+    expression_vector zoneMapPredicates;
+    if (tableIDs.size() == 1 && !hasIndexScan) {
+        zoneMapPredicates = getZoneMapPredicates(*nodeID);
+    }
     // Perform filter push down.
     auto currentRoot = scan->getChild(0);
     for (auto& predicate : predicateSet.equalityPredicates) {
-        currentRoot = pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot);
+        currentRoot =
+            pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot, zoneMapPredicates);
     }
     for (auto& predicate : predicateSet.nonEqualityPredicates) {
-        currentRoot = pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot);
+        currentRoot =
+            pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot, zoneMapPredicates);
     }
     // Scan remaining properties.
     expression_vector properties;
@@ -164,13 +186,130 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
         }
         properties.push_back(property);
     }
-    return appendScanNodeProperty(nodeID, tableIDs, properties, currentRoot);
+    return appendScanNodeProperty(nodeID, tableIDs, properties, currentRoot, zoneMapPredicates);
+}
+
+static ExpressionType reverseComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::getPropertyIndexScan(
+    std::shared_ptr<binder::Expression> nodeID, common::table_id_t tableID) {
+    // Index snapshots only hold committed values.
+    if (!context->getTx()->isReadOnly()) {
+        return nullptr;
+    }
+    auto variableName = ((PropertyExpression&)*nodeID).getVariableName();
+    std::shared_ptr<Expression> indexedProperty;
+    PropertyIndexBound lowerBound, upperBound;
+    // Equality predicates come first.
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        auto comparisonType = predicate->expressionType;
+        if (!isExpressionComparison(comparisonType) ||
+            comparisonType == ExpressionType::NOT_EQUALS) {
+            continue;
+        }
+        auto property = predicate->getChild(0);
+        auto value = predicate->getChild(1);
+        if (property->expressionType != ExpressionType::PROPERTY) {
+            std::swap(property, value);
+            comparisonType = reverseComparison(comparisonType);
+        }
+        if (property->expressionType != ExpressionType::PROPERTY ||
+            (value->expressionType != ExpressionType::LITERAL &&
+                value->expressionType != ExpressionType::PARAMETER) ||
+            property->dataType != value->dataType) {
+            continue;
+        }
+        auto& propertyExpression = (PropertyExpression&)*property;
+        if (propertyExpression.getVariableName() != variableName ||
+            !propertyExpression.hasPropertyID(tableID) ||
+            !storage::PropertyIndexCache::containsIndex(context->getTx(), *context->getCatalog(),
+                tableID, propertyExpression.getPropertyID(tableID))) {
+            continue;
+        }
+        if (indexedProperty == nullptr) {
+            indexedProperty = property;
+        } else if (indexedProperty->getUniqueName() != property->getUniqueName()) {
+            continue;
+        }
+        switch (comparisonType) {
+        case ExpressionType::EQUALS: {
+            lowerBound = PropertyIndexBound(value, true /* inclusive */);
+            upperBound = PropertyIndexBound(value, true /* inclusive */);
+        } break;
+        case ExpressionType::GREATER_THAN:
+        case ExpressionType::GREATER_THAN_EQUALS: {
+            if (lowerBound.isUnbounded()) {
+                lowerBound = PropertyIndexBound(value,
+                    comparisonType == ExpressionType::GREATER_THAN_EQUALS);
+            }
+        } break;
+        case ExpressionType::LESS_THAN:
+        case ExpressionType::LESS_THAN_EQUALS: {
+            if (upperBound.isUnbounded()) {
+                upperBound =
+                    PropertyIndexBound(value, comparisonType == ExpressionType::LESS_THAN_EQUALS);
+            }
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+        if (comparisonType == ExpressionType::EQUALS) {
+            break;
+        }
+    }
+    if (indexedProperty == nullptr) {
+        return nullptr;
+    }
+    auto dummyScan = std::make_shared<LogicalDummyScan>();
+    dummyScan->computeFlatSchema();
+    auto indexScan = std::make_shared<LogicalPropertyIndexScan>(std::move(nodeID), tableID,
+        std::move(indexedProperty), std::move(lowerBound), std::move(upperBound),
+        std::move(dummyScan));
+    indexScan->computeFlatSchema();
+    return indexScan;
+}
+
+binder::expression_vector FilterPushDownOptimizer::getZoneMapPredicates(
+    const binder::Expression& nodeID) {
+    auto variableName = ((PropertyExpression&)nodeID).getVariableName();
+    expression_vector result;
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        if (!isExpressionComparison(predicate->expressionType)) {
+            continue;
+        }
+        auto property = predicate->getChild(0);
+        auto literal = predicate->getChild(1);
+        if (property->expressionType == ExpressionType::LITERAL) {
+            std::swap(property, literal);
+        }
+        if (property->expressionType != ExpressionType::PROPERTY ||
+            literal->expressionType != ExpressionType::LITERAL ||
+            property->dataType != literal->dataType ||
+            ((PropertyExpression&)*property).getVariableName() != variableName) {
+            continue;
+        }
+        result.push_back(predicate);
+    }
+    return result;
 }
 
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToScanNode(
     std::shared_ptr<binder::Expression> nodeID, std::vector<common::table_id_t> tableIDs,
-    std::shared_ptr<binder::Expression> predicate,
-    std::shared_ptr<planner::LogicalOperator> child) {
+    std::shared_ptr<binder::Expression> predicate, std::shared_ptr<planner::LogicalOperator> child,
+    binder::expression_vector& zoneMapPredicates) {
     binder::expression_set propertiesSet;
     auto expressionCollector = std::make_unique<ExpressionCollector>();
     for (auto& expression : expressionCollector->collectPropertyExpressions(predicate)) {
@@ -184,7 +323,8 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToSca
         propertiesSet.insert(expression);
     }
     auto scanNodeProperty = appendScanNodeProperty(std::move(nodeID), std::move(tableIDs),
-        expression_vector{propertiesSet.begin(), propertiesSet.end()}, std::move(child));
+        expression_vector{propertiesSet.begin(), propertiesSet.end()}, std::move(child),
+        zoneMapPredicates);
     return appendFilter(std::move(predicate), scanNodeProperty);
 }
 
@@ -201,12 +341,15 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::finishPushDow
 
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::appendScanNodeProperty(
     std::shared_ptr<binder::Expression> nodeID, std::vector<common::table_id_t> nodeTableIDs,
-    binder::expression_vector properties, std::shared_ptr<planner::LogicalOperator> child) {
+    binder::expression_vector properties, std::shared_ptr<planner::LogicalOperator> child,
+    binder::expression_vector& zoneMapPredicates) {
     if (properties.empty()) {
         return child;
     }
     auto scanNodeProperty = std::make_shared<LogicalScanNodeProperty>(std::move(nodeID),
         std::move(nodeTableIDs), std::move(properties), std::move(child));
+    scanNodeProperty->setZoneMapPredicates(std::move(zoneMapPredicates));
+    zoneMapPredicates.clear();
     scanNodeProperty->computeFlatSchema();
     return scanNodeProperty;
 }
@@ -25,7 +25,7 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* client
     auto removeUnnecessaryJoinOptimizer = RemoveUnnecessaryJoinOptimizer();
     removeUnnecessaryJoinOptimizer.rewrite(plan);
 
-    auto filterPushDownOptimizer = FilterPushDownOptimizer();
+    auto filterPushDownOptimizer = FilterPushDownOptimizer(client);
     filterPushDownOptimizer.rewrite(plan);
 
     auto projectionPushDownOptimizer = ProjectionPushDownOptimizer();
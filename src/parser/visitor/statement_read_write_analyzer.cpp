@@ -1,5 +1,12 @@
 #include "parser/visitor/statement_read_write_analyzer.h"
 
+#include "common/string_utils.h"
+#include "function/table/call_functions.h"
+#include "parser/expression/parsed_function_expression.h"
+#include "parser/query/reading_clause/in_query_call_clause.h"
+
+using namespace kuzu::common;
+
 namespace kuzu {
 namespace parser {
 
@@ -8,5 +15,17 @@ bool StatementReadWriteAnalyzer::isReadOnly(const Statement& statement) {
     return readOnly;
 }
 
+void StatementReadWriteAnalyzer::visitInQueryCall(const ReadingClause* readingClause) {
+    auto& call = readingClause->constCast<InQueryCallClause>();
+    auto functionExpr = call.getFunctionExpression()->constPtrCast<ParsedFunctionExpression>();
+    auto functionName = StringUtils::getUpper(functionExpr->getFunctionName());
+    if (functionName == function::CreatePropertyIndexFunction::name ||
+        functionName == function::DropPropertyIndexFunction::name ||
+        functionName == function::CreateVectorIndexFunction::name ||
+        functionName == function::DropVectorIndexFunction::name) {
+        readOnly = false;
+    }
+}
+
 } // namespace parser
 } // namespace kuzu
@@ -81,6 +81,8 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
         return "PATH_PROPERTY_PROBE";
     case LogicalOperatorType::PROJECTION:
         return "PROJECTION";
+    case LogicalOperatorType::PROPERTY_INDEX_SCAN:
+        return "PROPERTY_INDEX_SCAN";
     case LogicalOperatorType::RECURSIVE_EXTEND:
         return "RECURSIVE_EXTEND";
     case LogicalOperatorType::SCAN_FILE:
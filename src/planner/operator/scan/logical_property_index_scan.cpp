@@ -0,0 +1,28 @@
+#include "planner/operator/scan/logical_property_index_scan.h"
+
+namespace kuzu {
+namespace planner {
+
+std::string LogicalPropertyIndexScan::getExpressionsForPrinting() const {
+    auto result = property->toString() + " in ";
+    result += lowerBound.inclusive ? "[" : "(";
+    result += lowerBound.isUnbounded() ? "-inf" : lowerBound.value->toString();
+    result += ", ";
+    result += upperBound.isUnbounded() ? "inf" : upperBound.value->toString();
+    result += upperBound.inclusive ? "]" : ")";
+    return result;
+}
+
+void LogicalPropertyIndexScan::computeFactorizedSchema() {
+    copyChildSchema(0);
+    auto groupPos = schema->createGroup();
+    schema->insertToGroupAndScope(nodeID, groupPos);
+}
+
+void LogicalPropertyIndexScan::computeFlatSchema() {
+    copyChildSchema(0);
+    schema->insertToGroupAndScope(nodeID, 0);
+}
+
+} // namespace planner
+} // namespace kuzu
@@ -158,13 +158,30 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     // Create recursive plan
     auto recursivePlan = std::make_unique<LogicalPlan>();
     createRecursivePlan(*recursiveInfo, direction, *recursivePlan);
+    // Shortest paths to a single dst node can be computed by a bidirectional BFS, which needs a
+    // recursive plan extending from the dst node. Node predicates are skipped for the node where
+    // both searches meet, so they are only supported by the single directional BFS.
+    std::shared_ptr<LogicalOperator> bwdRecursiveRoot;
+    if ((rel->getRelType() == QueryRelType::SHORTEST ||
+            rel->getRelType() == QueryRelType::ALL_SHORTEST) &&
+        recursiveInfo->nodePredicate == nullptr) {
+        auto bwdDirection = direction;
+        if (direction != ExtendDirection::BOTH) {
+            bwdDirection =
+                direction == ExtendDirection::FWD ? ExtendDirection::BWD : ExtendDirection::FWD;
+        }
+        auto bwdRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, bwdDirection, *bwdRecursivePlan);
+        bwdRecursiveRoot = bwdRecursivePlan->getLastOperator();
+    }
     // Create recursive extend
     if (boundNode->getNumTableIDs() > recursiveInfo->node->getNumTableIDs()) {
         appendNodeLabelFilter(boundNode->getInternalID(), recursiveInfo->node->getTableIDsSet(),
             plan);
     }
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
-        RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator());
+        RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator(),
+        std::move(bwdRecursiveRoot));
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
@@ -238,6 +255,9 @@ void Planner::createRecursivePlan(const RecursiveInfo& recursiveInfo, ExtendDire
     }
     auto relProperties = collectPropertiesToRead(recursiveInfo.relPredicate);
     relProperties.push_back(rel->getInternalIDProperty());
+    if (recursiveInfo.weightExpression != nullptr) {
+        relProperties.push_back(recursiveInfo.weightExpression);
+    }
     auto iri = getIRIProperty(relProperties);
     if (iri != nullptr) {
         // IRI Cannot be scanned directly from rel table. For recursive plan filter, we first read
@@ -87,8 +87,14 @@ void Planner::planRegularMatch(const QueryGraphCollection& queryGraphCollection,
             predicatesToPullUp.push_back(predicate);
         }
     }
-    auto joinNodeIDs = ExpressionUtil::getExpressionsWithDataType(correlatedExpressions,
-        LogicalTypeID::INTERNAL_ID);
+    // Only the IDs of nodes which are already bound are joined on. Other node IDs in scope, e.g.
+    // node IDs returned by table functions, are compared by the predicates pulled up below.
+    expression_vector joinNodeIDs;
+    for (auto& node : queryGraphCollection.getQueryNodes()) {
+        if (leftPlan.getSchema()->isExpressionInScope(*node->getInternalID())) {
+            joinNodeIDs.push_back(node->getInternalID());
+        }
+    }
     if (joinNodeIDs.empty()) {
         auto rightPlan =
             planQueryGraphCollectionInNewContext(SubqueryType::NONE, correlatedExpressions,
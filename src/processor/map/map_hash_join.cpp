@@ -1,7 +1,11 @@
+#include "main/client_context.h"
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_node_property.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -57,6 +61,43 @@ std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema&
         std::move(payloadsPos), std::move(tableSchema));
 }
 
+static bool isFixedSize(const LogicalType& type) {
+    return type.getPhysicalType() != PhysicalTypeID::ANY &&
+           type.getPhysicalType() < PhysicalTypeID::STRING;
+}
+
+// Both sides of a hash join can be spilled only if their tuples are flat and fixed-sized, so that
+// they can be written to and read back from disk as raw bytes.
+static bool canSpillHashJoin(LogicalHashJoin& hashJoin,
+    const FactorizedTableSchema& buildTableSchema, const expression_vector& buildKeys,
+    const expression_vector& payloads) {
+    if (!hashJoin.requireFlatProbeKeys()) {
+        return false;
+    }
+    auto probeSchema = hashJoin.getChild(0)->getSchema();
+    for (auto& expression : probeSchema->getExpressionsInScope()) {
+        if (!probeSchema->getGroup(expression)->isFlat() || !isFixedSize(expression->dataType)) {
+            return false;
+        }
+    }
+    for (auto i = 0u; i < buildTableSchema.getNumColumns(); i++) {
+        if (!buildTableSchema.getColumn(i)->isFlat()) {
+            return false;
+        }
+    }
+    for (auto& expression : buildKeys) {
+        if (!isFixedSize(expression->dataType)) {
+            return false;
+        }
+    }
+    for (auto& expression : payloads) {
+        if (!isFixedSize(expression->dataType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logicalOperator) {
     auto hashJoin = (LogicalHashJoin*)logicalOperator;
     auto outSchema = hashJoin->getSchema();
@@ -83,9 +124,29 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
+    auto spillable = clientContext->getClientConfig()->hashJoinMemoryFraction > 0 &&
+                     canSpillHashJoin(*hashJoin, *buildInfo->getTableSchema(), buildKeys, payloads);
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    if (spillable) {
+        auto bufferPoolSize =
+            clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize();
+        sharedState->enableSpilling(
+            bufferPoolSize * clientContext->getClientConfig()->hashJoinMemoryFraction);
+    }
+    if (hashJoin->getScanToApplyKeyFilter() != nullptr) {
+        auto& scanProperty = (const LogicalScanNodeProperty&)*hashJoin->getScanToApplyKeyFilter();
+        auto scan = logicalOpToPhysicalOpMap.at(hashJoin->getScanToApplyKeyFilter());
+        KU_ASSERT(scan->getOperatorType() == PhysicalOperatorType::SCAN_NODE_TABLE);
+        auto properties = scanProperty.getProperties();
+        for (auto i = 0u; i < properties.size(); i++) {
+            if (properties[i]->getUniqueName() == probeKeys[0]->getUniqueName()) {
+                ((ScanNodeTable*)scan)->addKeyFilter(i, sharedState->enableKeyFilter());
+                break;
+            }
+        }
+    }
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema), sharedState,
             std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(), paramsString);
@@ -106,6 +167,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    if (spillable) {
+        for (auto& expression : hashJoin->getChild(0)->getSchema()->getExpressionsInScope()) {
+            probeDataInfo.spillDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+        }
+    }
 
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
@@ -0,0 +1,52 @@
+#include "binder/expression/property_expression.h"
+#include "planner/operator/scan/logical_property_index_scan.h"
+#include "processor/operator/property_index_scan.h"
+#include "processor/operator/scan_node_id.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapPropertyIndexScan(
+    LogicalOperator* logicalOperator) {
+    auto scan = ku_dynamic_cast<LogicalOperator*, LogicalPropertyIndexScan*>(logicalOperator);
+    auto inSchema = scan->getChild(0)->getSchema();
+    auto outSchema = scan->getSchema();
+    auto outDataPos = DataPos(outSchema->getExpressionPos(*scan->getNodeID()));
+    auto storageManager = clientContext->getStorageManager();
+    auto cache = storageManager->getPropertyIndexCache();
+    auto tableID = scan->getTableID();
+    auto propertyID = ((PropertyExpression&)*scan->getProperty()).getPropertyID(tableID);
+    // Prepared statements may run in a write transaction, or after the index has been dropped.
+    // Predicates on the property are still evaluated on top, so scanning all nodes is enough.
+    if (!clientContext->getTx()->isReadOnly() ||
+        !storage::PropertyIndexCache::containsIndex(clientContext->getTx(),
+            *clientContext->getCatalog(), tableID, propertyID)) {
+        auto nodeTable = ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
+            storageManager->getTable(tableID));
+        auto sharedState = std::make_shared<ScanNodeIDSharedState>();
+        sharedState->addTableState(nodeTable);
+        return std::make_unique<ScanNodeID>(outDataPos, std::move(sharedState), getOperatorID(),
+            scan->getNodeID()->toString());
+    }
+    auto prevOperator = mapOperator(scan->getChild(0).get());
+    auto& lowerBound = scan->getLowerBound();
+    auto& upperBound = scan->getUpperBound();
+    auto info = std::make_unique<PropertyIndexScanInfo>(tableID, propertyID,
+        lowerBound.isUnbounded() ? nullptr :
+                                   ExpressionMapper::getEvaluator(lowerBound.value, inSchema),
+        lowerBound.inclusive,
+        upperBound.isUnbounded() ? nullptr :
+                                   ExpressionMapper::getEvaluator(upperBound.value, inSchema),
+        upperBound.inclusive, outDataPos);
+    return std::make_unique<PropertyIndexScan>(std::move(info), cache, std::move(prevOperator),
+        getOperatorID(), scan->getExpressionsForPrinting());
+}
+
+} // namespace processor
+} // namespace kuzu
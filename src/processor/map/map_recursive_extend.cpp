@@ -1,3 +1,4 @@
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "processor/operator/recursive_extend/recursive_join.h"
 #include "processor/plan_mapper.h"
@@ -20,6 +21,25 @@ static std::shared_ptr<RecursiveJoinSharedState> createSharedState(
     return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks));
 }
 
+// Recursive plans without predicates over the rels of a single rel table, whose src and dst node
+// tables are the same, can be replaced by reading a projected graph of the rel table.
+static common::table_id_t getGraphRelTableID(const RecursiveInfo& recursiveInfo,
+    main::ClientContext& clientContext) {
+    auto& rel = *recursiveInfo.rel;
+    if (rel.getNumTableIDs() != 1 || recursiveInfo.nodePredicate != nullptr ||
+        recursiveInfo.relPredicate != nullptr || recursiveInfo.weightExpression != nullptr) {
+        return common::INVALID_TABLE_ID;
+    }
+    auto relTableID = rel.getSingleTableID();
+    auto relTableEntry = common::ku_dynamic_cast<catalog::TableCatalogEntry*,
+        catalog::RelTableCatalogEntry*>(
+        clientContext.getCatalog()->getTableCatalogEntry(clientContext.getTx(), relTableID));
+    if (relTableEntry->getSrcTableID() != relTableEntry->getDstTableID()) {
+        return common::INVALID_TABLE_ID;
+    }
+    return relTableID;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator* logicalOperator) {
     auto extend = logicalOperator->constPtrCast<LogicalRecursiveExtend>();
     auto boundNode = extend->getBoundNode();
@@ -46,6 +66,24 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     dataInfo.recursiveDstNodeTableIDs = recursiveInfo->node->getTableIDsSet();
     dataInfo.recursiveEdgeIDPos =
         getDataPos(*recursiveInfo->rel->getInternalIDProperty(), *recursivePlanSchema);
+    if (recursiveInfo->weightExpression != nullptr) {
+        dataInfo.recursiveEdgeWeightPos =
+            getDataPos(*recursiveInfo->weightExpression, *recursivePlanSchema);
+    } else {
+        dataInfo.recursiveEdgeWeightPos = DataPos::getInvalidPos();
+    }
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    auto logicalBwdRecursiveRoot = extend->getBwdRecursiveChild();
+    if (logicalBwdRecursiveRoot != nullptr) {
+        bwdRecursiveRoot = mapOperator(logicalBwdRecursiveRoot.get());
+        auto bwdRecursivePlanSchema = logicalBwdRecursiveRoot->getSchema();
+        dataInfo.bwdLocalResultSetDescriptor =
+            std::make_unique<ResultSetDescriptor>(bwdRecursivePlanSchema);
+        dataInfo.bwdRecursiveDstNodeIDPos =
+            getDataPos(*recursiveInfo->nodeCopy->getInternalID(), *bwdRecursivePlanSchema);
+        dataInfo.bwdRecursiveEdgeIDPos =
+            getDataPos(*recursiveInfo->rel->getInternalIDProperty(), *bwdRecursivePlanSchema);
+    }
     if (extend->getJoinType() == RecursiveJoinType::TRACK_PATH) {
         dataInfo.pathPos = getDataPos(*rel, *outSchema);
     } else {
@@ -62,9 +100,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     info.queryRelType = rel->getRelType();
     info.joinType = extend->getJoinType();
     info.direction = extend->getDirection();
+    info.graphRelTableID = getGraphRelTableID(*recursiveInfo, *clientContext);
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     return std::make_unique<RecursiveJoin>(std::move(info), sharedState, std::move(prevOperator),
-        getOperatorID(), extend->getExpressionsForPrinting(), std::move(recursiveRoot));
+        getOperatorID(), extend->getExpressionsForPrinting(), std::move(recursiveRoot),
+        std::move(bwdRecursiveRoot));
 }
 
 } // namespace processor
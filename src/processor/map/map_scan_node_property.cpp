@@ -1,3 +1,4 @@
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 #include "processor/operator/scan/scan_multi_node_tables.h"
@@ -11,6 +12,39 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+static ExpressionType reverseComparison(ExpressionType comparison) {
+    switch (comparison) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparison;
+    }
+}
+
+static std::optional<storage::ZoneMapFilter> getZoneMapFilter(const Expression& predicate,
+    table_id_t tableID, catalog::TableCatalogEntry* tableEntry) {
+    auto comparison = predicate.expressionType;
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (property->expressionType == ExpressionType::LITERAL) {
+        std::swap(property, literal);
+        comparison = reverseComparison(comparison);
+    }
+    auto& propertyExpression = (PropertyExpression&)*property;
+    if (!propertyExpression.hasPropertyID(tableID)) {
+        return std::nullopt;
+    }
+    auto columnID = tableEntry->getColumnID(propertyExpression.getPropertyID(tableID));
+    return storage::ZoneMapFilter::create(columnID, comparison,
+        *((LiteralExpression&)*literal).getValue());
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
     LogicalOperator* logicalOperator) {
     auto& scanProperty = (const LogicalScanNodeProperty&)*logicalOperator;
@@ -62,6 +96,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
             ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
                 clientContext->getStorageManager()->getTable(tableID)),
             std::move(columnIDs));
+        for (auto& predicate : scanProperty.getZoneMapPredicates()) {
+            auto filter = getZoneMapFilter(*predicate, tableID, tableSchema);
+            if (filter.has_value()) {
+                info->zoneMapFilters.push_back(*filter);
+            }
+        }
         return std::make_unique<ScanNodeTable>(std::move(info), inputNodeIDVectorPos,
             std::move(outVectorsPos), std::move(prevOperator), getOperatorID(),
             scanProperty.getExpressionsForPrinting());
@@ -42,6 +42,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     case LogicalOperatorType::INDEX_SCAN_NODE: {
         physicalOperator = mapIndexScan(logicalOperator);
     } break;
+    case LogicalOperatorType::PROPERTY_INDEX_SCAN: {
+        physicalOperator = mapPropertyIndexScan(logicalOperator);
+    } break;
     case LogicalOperatorType::EMPTY_RESULT: {
         physicalOperator = mapEmptyResult(logicalOperator);
     } break;
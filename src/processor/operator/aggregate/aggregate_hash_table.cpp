@@ -1,6 +1,8 @@
 #include "processor/operator/aggregate/aggregate_hash_table.h"
 
 #include "common/utils.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate/count_star.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -14,7 +16,8 @@ AggregateHashTable::AggregateHashTable(MemoryManager& memoryManager,
     const std::vector<std::unique_ptr<AggregateFunction>>& aggregateFunctions,
     const std::vector<LogicalType>& distinctAggKeyTypes, uint64_t numEntriesToAllocate,
     std::unique_ptr<FactorizedTableSchema> tableSchema)
-    : BaseHashTable{memoryManager, std::move(keyTypes)}, payloadTypes{std::move(payloadTypes)} {
+    : BaseHashTable{memoryManager, std::move(keyTypes)}, payloadTypes{std::move(payloadTypes)},
+      distinctAggKeyTypes{distinctAggKeyTypes} {
     initializeFT(aggregateFunctions, std::move(tableSchema));
     initializeHashTable(numEntriesToAllocate);
     KU_ASSERT(aggregateFunctions.size() == distinctAggKeyTypes.size());
@@ -60,6 +63,23 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
 }
 
 void AggregateHashTable::merge(AggregateHashTable& other) {
+    merge(*other.factorizedTable);
+}
+
+void AggregateHashTable::merge(AggregateHashTable& other, uint64_t partitionIdx,
+    uint64_t numPartitionsLog2) {
+    KU_ASSERT(numPartitionsLog2 > 0 && numPartitionsLog2 < 64);
+    mergeIf(*other.factorizedTable, [&](hash_t hash) {
+        return getPartitionIdx(hash, numPartitionsLog2) == partitionIdx;
+    });
+}
+
+void AggregateHashTable::merge(const FactorizedTable& table) {
+    mergeIf(table, [](hash_t /*hash*/) { return true; });
+}
+
+template<typename FILTER_FUNC>
+void AggregateHashTable::mergeIf(const FactorizedTable& table, FILTER_FUNC filter) {
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
     std::vector<ValueVector*> vectorsToScan(keyTypes.size() + payloadTypes.size());
     std::vector<ValueVector*> groupByHashVectors(keyTypes.size());
@@ -88,24 +108,40 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
-    uint64_t startTupleIdx = 0;
-    while (startTupleIdx < other.factorizedTable->getNumTuples()) {
-        auto numTuplesToScan = std::min(other.factorizedTable->getNumTuples() - startTupleIdx,
-            DEFAULT_VECTOR_CAPACITY);
-        other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+    auto tuplesToMerge = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    uint64_t numTuplesToMerge = 0;
+    auto mergeTuples = [&]() {
+        resizeHashTableIfNecessary(numTuplesToMerge);
+        table.lookup(vectorsToScan, colIdxesToScan, tuplesToMerge.get(),
+            0 /* startPos */, numTuplesToMerge);
         findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
             vectorsToScanState.get());
         auto aggregateStateOffset = aggStateColOffsetInFT;
         for (auto& aggregateFunction : aggregateFunctions) {
-            for (auto i = 0u; i < numTuplesToScan; i++) {
-                aggregateFunction->combineState(hashSlotsToUpdateAggState[i]->entry +
-                                                    aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+            for (auto i = 0u; i < numTuplesToMerge; i++) {
+                aggregateFunction->combineState(
+                    hashSlotsToUpdateAggState[i]->entry + aggregateStateOffset,
+                    tuplesToMerge[i] + aggregateStateOffset, &memoryManager);
             }
             aggregateStateOffset += aggregateFunction->getAggregateStateSize();
         }
-        startTupleIdx += numTuplesToScan;
+        numTuplesToMerge = 0;
+    };
+    auto numBytesPerTuple = table.getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : table.getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            if (filter(*(hash_t*)(tuple + hashColOffsetInFT))) {
+                tuplesToMerge[numTuplesToMerge++] = tuple;
+                if (numTuplesToMerge == DEFAULT_VECTOR_CAPACITY) {
+                    mergeTuples();
+                }
+            }
+            tuple += numBytesPerTuple;
+        }
+    }
+    if (numTuplesToMerge > 0) {
+        mergeTuples();
     }
 }
 
@@ -120,6 +156,51 @@ void AggregateHashTable::finalizeAggregateStates() {
     }
 }
 
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy(
+    uint64_t numEntriesToAllocate) const {
+    return std::make_unique<AggregateHashTable>(memoryManager, keyTypes, payloadTypes,
+        aggregateFunctions, distinctAggKeyTypes, numEntriesToAllocate,
+        factorizedTable->getTableSchema()->copy());
+}
+
+static bool isFixedSizeType(PhysicalTypeID physicalType) {
+    return physicalType < PhysicalTypeID::STRING;
+}
+
+bool AggregateHashTable::isSpillable() const {
+    for (auto& type : keyTypes) {
+        if (!isFixedSizeType(type.getPhysicalType())) {
+            return false;
+        }
+    }
+    for (auto& type : payloadTypes) {
+        if (!isFixedSizeType(type.getPhysicalType())) {
+            return false;
+        }
+    }
+    for (auto& aggregateFunction : aggregateFunctions) {
+        // Distinct aggregates keep their own hash tables of seen values.
+        if (aggregateFunction->isDistinct) {
+            return false;
+        }
+        auto& name = aggregateFunction->name;
+        if (name == CountStarFunction::name || name == CountFunction::name ||
+            name == AggregateSumFunction::name || name == AggregateAvgFunction::name) {
+            continue;
+        }
+        // MIN and MAX over strings keep the value in an overflow buffer.
+        if ((name == AggregateMinFunction::name || name == AggregateMaxFunction::name) &&
+            std::all_of(aggregateFunction->parameterTypeIDs.begin(),
+                aggregateFunction->parameterTypeIDs.end(), [](LogicalTypeID typeID) {
+                    return isFixedSizeType(LogicalType::getPhysicalType(typeID));
+                })) {
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
 void AggregateHashTable::initializeFT(
     const std::vector<std::unique_ptr<AggregateFunction>>& aggFuncs,
     std::unique_ptr<FactorizedTableSchema> tableSchema) {
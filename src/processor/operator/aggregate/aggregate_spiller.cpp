@@ -0,0 +1,99 @@
+#include "processor/operator/aggregate/aggregate_spiller.h"
+
+#include <fcntl.h>
+
+#include <cstring>
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+AggregateSpiller::~AggregateSpiller() {
+    if (fileInfo != nullptr) {
+        fileInfo.reset();
+        vfs->removeFileIfExists(filePath);
+    }
+}
+
+void AggregateSpiller::spill(AggregateHashTable& hashTable) {
+    auto table = hashTable.getFactorizedTable();
+    auto tableSchema = table->getTableSchema();
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    // Note: we store hash values at the last column of factorizedTable.
+    auto hashColOffset = tableSchema->getColOffset(tableSchema->getNumColumns() - 1);
+    auto maxNumTuplesPerRun = SPILL_RUN_SIZE / numBytesPerTuple;
+    KU_ASSERT(maxNumTuplesPerRun > 0);
+    std::array<std::unique_ptr<uint8_t[]>, NUM_PARTITIONS> runBuffers;
+    std::array<uint64_t, NUM_PARTITIONS> numTuplesInRuns{};
+    for (auto& runBuffer : runBuffers) {
+        runBuffer = std::make_unique<uint8_t[]>(maxNumTuplesPerRun * numBytesPerTuple);
+    }
+    for (auto& tupleBlock : table->getTupleDataBlocks()) {
+        auto tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto partitionIdx = AggregateHashTable::getPartitionIdx(
+                *(hash_t*)(tuple + hashColOffset), NUM_PARTITIONS_LOG2);
+            auto& numTuplesInRun = numTuplesInRuns[partitionIdx];
+            memcpy(runBuffers[partitionIdx].get() + numTuplesInRun * numBytesPerTuple, tuple,
+                numBytesPerTuple);
+            if (++numTuplesInRun == maxNumTuplesPerRun) {
+                writeRun(partitionIdx, runBuffers[partitionIdx].get(), numTuplesInRun,
+                    numBytesPerTuple);
+                numTuplesInRun = 0;
+            }
+            tuple += numBytesPerTuple;
+        }
+    }
+    for (auto partitionIdx = 0u; partitionIdx < NUM_PARTITIONS; partitionIdx++) {
+        if (numTuplesInRuns[partitionIdx] > 0) {
+            writeRun(partitionIdx, runBuffers[partitionIdx].get(), numTuplesInRuns[partitionIdx],
+                numBytesPerTuple);
+        }
+    }
+    numSpilledTuples.fetch_add(table->getNumTuples());
+}
+
+void AggregateSpiller::mergePartition(uint64_t partitionIdx, AggregateHashTable& hashTable,
+    MemoryManager& memoryManager) {
+    if (spilledRuns[partitionIdx].empty()) {
+        return;
+    }
+    // Null flags of the spilled entries depend on the hash table they were spilled from, so we
+    // always read the null map back.
+    auto tableSchema = hashTable.getFactorizedTable()->getTableSchema()->copy();
+    for (auto i = 0u; i < tableSchema->getNumColumns(); i++) {
+        tableSchema->setMayContainsNullsToTrue(i);
+    }
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    FactorizedTable spilledTable{&memoryManager, std::move(tableSchema)};
+    auto runBuffer = std::make_unique<uint8_t[]>(SPILL_RUN_SIZE);
+    for (auto& run : spilledRuns[partitionIdx]) {
+        fileInfo->readFromFile(runBuffer.get(), run.numTuples * numBytesPerTuple, run.offset);
+        for (auto i = 0u; i < run.numTuples; i++) {
+            memcpy(spilledTable.appendEmptyTuple(), runBuffer.get() + i * numBytesPerTuple,
+                numBytesPerTuple);
+        }
+        hashTable.merge(spilledTable);
+        spilledTable.clear();
+    }
+}
+
+void AggregateSpiller::writeRun(uint64_t partitionIdx, const uint8_t* data, uint64_t numTuples,
+    uint64_t numBytesPerTuple) {
+    auto numBytes = numTuples * numBytesPerTuple;
+    uint64_t offset;
+    {
+        std::unique_lock lck{mtx};
+        if (fileInfo == nullptr) {
+            fileInfo = vfs->openFile(filePath, O_RDWR | O_CREAT | O_TRUNC);
+        }
+        offset = fileSize.fetch_add(numBytes);
+        spilledRuns[partitionIdx].push_back(SpilledRun{offset, numTuples});
+    }
+    fileInfo->writeFile(data, numBytes, offset);
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,7 +1,14 @@
 #include "processor/operator/aggregate/hash_aggregate.h"
 
+#include <bit>
+#include <thread>
+
+#include "common/constants.h"
 #include "common/utils.h"
+#include "main/client_context.h"
 #include "processor/result/mark_hash_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -16,38 +23,141 @@ void HashAggregateSharedState::appendAggregateHashTable(
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
 }
 
-void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
-    std::unique_lock lck{mtx};
-    if (localAggregateHashTables.size() == 1) {
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-    } else {
-        auto numEntries = 0u;
-        for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
+void HashAggregateSharedState::spillAggregateHashTable(AggregateHashTable& aggregateHashTable,
+    main::ClientContext* context) {
+    {
+        std::unique_lock lck{mtx};
+        if (spiller == nullptr) {
+            auto vfs = context->getVFSUnsafe();
+            auto fileName = "aggregate_" + std::to_string(reinterpret_cast<uintptr_t>(this)) +
+                            StorageConstants::SPILL_FILE_SUFFIX;
+            spiller = std::make_unique<AggregateSpiller>(vfs,
+                vfs->joinPath(context->getStorageManager()->getWAL()->getDirectory(), fileName));
         }
+    }
+    spiller->spill(aggregateHashTable);
+}
+
+void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& memoryManager) {
+    std::unique_lock lck{mtx};
+    uint64_t numEntries = 0;
+    for (auto& ht : localAggregateHashTables) {
+        numEntries += ht->getNumEntries();
+    }
+    if (spiller != nullptr) {
+        // Spilled entries are partitioned by the spiller, and can only be merged back through
+        // partitions of the same granularity.
+        this->memoryManager = &memoryManager;
+        numPartitionsLog2 = AggregateSpiller::NUM_PARTITIONS_LOG2;
+        globalPartitions.resize(AggregateSpiller::NUM_PARTITIONS);
+        nextPartitionIdxToMerge = 0;
+        numMergedPartitions = 0;
+        return;
+    }
+    auto numPartitions = std::min(nextPowerOfTwo(numEntries / MIN_NUM_ENTRIES_PER_PARTITION),
+        (uint64_t)1 << MAX_NUM_PARTITIONS_LOG2);
+    if (localAggregateHashTables.size() > 1 && numPartitions > 1) {
+        numPartitionsLog2 = std::countr_zero(numPartitions);
+        globalPartitions.resize(numPartitions);
+        nextPartitionIdxToMerge = 0;
+        numMergedPartitions = 0;
+        return;
+    }
+    if (localAggregateHashTables.size() > 1) {
         localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
         for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
-            globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+            localAggregateHashTables[0]->merge(*localAggregateHashTables[i]);
         }
     }
+    localAggregateHashTables[0]->finalizeAggregateStates();
+    globalPartitions.push_back(std::move(localAggregateHashTables[0]));
+    nextPartitionIdxToMerge = 1;
+    numMergedPartitions = 1;
 }
 
-void HashAggregateSharedState::finalizeAggregateHashTable() {
-    std::unique_lock lck{mtx};
-    globalAggregateHashTable->finalizeAggregateStates();
+void HashAggregateSharedState::mergePartitions() {
+    auto numPartitions = globalPartitions.size();
+    while (true) {
+        auto partitionIdx = nextPartitionIdxToMerge.fetch_add(1);
+        if (partitionIdx >= numPartitions) {
+            break;
+        }
+        mergePartition(partitionIdx);
+        numMergedPartitions.fetch_add(1);
+    }
+    // Reading can only start after all partitions are merged.
+    while (numMergedPartitions.load() < numPartitions) {
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+    std::call_once(initMorselsFlag, [this]() { initMorselsToRead(); });
 }
 
-std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
-    std::unique_lock lck{mtx};
-    if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
-        return std::make_pair(currentOffset, currentOffset);
-    }
-    auto startOffset = currentOffset;
-    auto range = std::min(DEFAULT_VECTOR_CAPACITY,
-        globalAggregateHashTable->getNumEntries() - currentOffset);
-    currentOffset += range;
-    return std::make_pair(startOffset, startOffset + range);
+void HashAggregateSharedState::mergePartition(uint64_t partitionIdx) {
+    uint64_t numEntries = 0;
+    for (auto& ht : localAggregateHashTables) {
+        numEntries += ht->getNumEntries();
+    }
+    auto partition = localAggregateHashTables[0]->createEmptyCopy(
+        nextPowerOfTwo(numEntries >> numPartitionsLog2));
+    for (auto& ht : localAggregateHashTables) {
+        partition->merge(*ht, partitionIdx, numPartitionsLog2);
+    }
+    if (spiller != nullptr) {
+        spiller->mergePartition(partitionIdx, *partition, *memoryManager);
+    }
+    partition->finalizeAggregateStates();
+    globalPartitions[partitionIdx] = std::move(partition);
+}
+
+void HashAggregateSharedState::initMorselsToRead() {
+    // All entries have been merged into global partitions at this point.
+    localAggregateHashTables.clear();
+    if (spiller != nullptr) {
+        numSpilledTuples = spiller->getNumSpilledTuples();
+        numSpilledBytes = spiller->getNumSpilledBytes();
+        spiller.reset();
+    }
+    uint64_t numMorsels = 0;
+    morselEndIdxes.reserve(globalPartitions.size());
+    for (auto& partition : globalPartitions) {
+        numMorsels += (partition->getNumEntries() + DEFAULT_VECTOR_CAPACITY - 1) /
+                      DEFAULT_VECTOR_CAPACITY;
+        morselEndIdxes.push_back(numMorsels);
+    }
+    numMorselsToRead.store(numMorsels, std::memory_order_release);
+}
+
+std::tuple<AggregateHashTable*, uint64_t, uint64_t>
+HashAggregateSharedState::getNextRangeToRead() {
+    auto morselIdx = nextMorselIdxToRead.fetch_add(1);
+    auto it = std::upper_bound(morselEndIdxes.begin(), morselEndIdxes.end(), morselIdx);
+    if (it == morselEndIdxes.end()) {
+        return std::make_tuple(nullptr, 0, 0);
+    }
+    auto partitionIdx = it - morselEndIdxes.begin();
+    auto partition = globalPartitions[partitionIdx].get();
+    auto firstMorselIdx = partitionIdx == 0 ? 0 : morselEndIdxes[partitionIdx - 1];
+    auto startOffset = (morselIdx - firstMorselIdx) * DEFAULT_VECTOR_CAPACITY;
+    auto endOffset = std::min(startOffset + DEFAULT_VECTOR_CAPACITY, partition->getNumEntries());
+    return std::make_tuple(partition, startOffset, endOffset);
+}
+
+uint64_t HashAggregateSharedState::getNumTuples() {
+    mergePartitions();
+    uint64_t numTuples = 0;
+    for (auto& partition : globalPartitions) {
+        numTuples += partition->getNumEntries();
+    }
+    return numTuples;
+}
+
+double HashAggregateSharedState::getProgress() const {
+    auto numMorsels = numMorselsToRead.load(std::memory_order_acquire);
+    if (numMorsels == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(std::min(nextMorselIdxToRead.load(), numMorsels)) / numMorsels;
 }
 
 HashAggregateInfo::HashAggregateInfo(std::vector<DataPos> flatKeysPos,
@@ -112,20 +222,39 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto& info : aggInfos) {
         distinctAggKeyTypes.push_back(info.distinctAggKeyType);
     }
-    localState.init(*resultSet, context->clientContext, hashInfo, aggregateFunctions,
-        distinctAggKeyTypes);
+    auto clientContext = context->clientContext;
+    localState.init(*resultSet, clientContext, hashInfo, aggregateFunctions, distinctAggKeyTypes);
+    localState.spillThreshold = UINT64_MAX;
+    if (localState.aggregateHashTable->isSpillable()) {
+        auto bufferPoolSize =
+            clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize();
+        localState.spillThreshold = bufferPoolSize * SPILL_MEMORY_FRACTION /
+                                    std::max<uint64_t>(clientContext->getMaxNumThreadForExec(), 1);
+    }
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
         localState.append(aggInputs, resultSet->multiplicity);
+        if (localState.aggregateHashTable->getMemoryUsage() > localState.spillThreshold) {
+            sharedState->spillAggregateHashTable(*localState.aggregateHashTable,
+                context->clientContext);
+            localState.aggregateHashTable = localState.aggregateHashTable->createEmptyCopy(0);
+        }
     }
     sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable));
 }
 
 void HashAggregate::finalize(ExecutionContext* context) {
     sharedState->combineAggregateHashTable(*context->clientContext->getMemoryManager());
-    sharedState->finalizeAggregateHashTable();
+}
+
+std::unordered_map<std::string, std::string> HashAggregate::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"NumSpilledTuples", std::to_string(sharedState->getNumSpilledTuples())});
+    result.insert({"NumSpilledBytes", std::to_string(sharedState->getNumSpilledBytes())});
+    return result;
 }
 
 } // namespace processor
@@ -6,6 +6,7 @@ namespace kuzu {
 namespace processor {
 
 void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    sharedState->mergePartitions();
     BaseAggregateScan::initLocalStateInternal(resultSet, context);
     for (auto& dataPos : groupByKeyVectorsPos) {
         auto valueVector = resultSet->getValueVector(dataPos);
@@ -16,17 +17,16 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 }
 
 bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
+    auto [partition, startOffset, endOffset] = sharedState->getNextRangeToRead();
     if (startOffset >= endOffset) {
         return false;
     }
     auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(groupByKeyVectors, startOffset, numRowsToScan,
-        groupByKeyVectorsColIdxes);
+    auto factorizedTable = partition->getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, startOffset, numRowsToScan, groupByKeyVectorsColIdxes);
     for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+        auto entry = partition->getEntry(startOffset + pos);
+        auto offset = factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
@@ -38,13 +38,7 @@ bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
 }
 
 double HashAggregateScan::getProgress(ExecutionContext* /*context*/) const {
-    uint64_t totalNumTuples = sharedState->getFactorizedTable()->getNumTuples();
-    if (totalNumTuples == 0) {
-        return 0.0;
-    } else if (sharedState->getCurrentOffset() == totalNumTuples) {
-        return 1.0;
-    }
-    return static_cast<double>(sharedState->getCurrentOffset()) / totalNumTuples;
+    return sharedState->getProgress();
 }
 
 } // namespace processor
@@ -1,5 +1,11 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
+#include <thread>
+
+#include "common/constants.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
 using namespace kuzu::common;
 using namespace kuzu::storage;
 
@@ -11,6 +17,206 @@ void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     hashTable->merge(localHashTable);
 }
 
+void HashJoinSharedState::initHashSlots() {
+    hashTable->allocateHashSlots(hashTable->getNumTuples());
+    if (keyFilter != nullptr && !spilling) {
+        // Spilled build side tuples are not in the hash table, so the filter can only be used if
+        // nothing is spilled.
+        keyFilter->init(hashTable->getNumTuples());
+    }
+    nextBlockIdxToBuild = 0;
+    numBuiltBlocks = 0;
+}
+
+void HashJoinSharedState::buildHashSlots() {
+    auto numBlocks = hashTable->getNumTupleBlocks();
+    auto filter = keyFilter != nullptr && keyFilter->isEnabled() ? keyFilter.get() : nullptr;
+    while (true) {
+        auto blockIdx = nextBlockIdxToBuild.fetch_add(1);
+        if (blockIdx >= numBlocks) {
+            break;
+        }
+        hashTable->buildHashSlots(blockIdx, filter);
+        numBuiltBlocks.fetch_add(1);
+    }
+    // Probing can only start after all blocks are inserted into the htDirectory.
+    while (numBuiltBlocks.load() < numBlocks) {
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+}
+
+void HashJoinSharedState::updateMemoryUsage(int64_t numBytes) {
+    if (numBytes < 0) {
+        numBytesInMemory.fetch_sub(-numBytes);
+        return;
+    }
+    if (numBytesInMemory.fetch_add(numBytes) + numBytes > spillMemoryThreshold) {
+        spilling = true;
+    }
+}
+
+HashJoinSpiller* HashJoinSharedState::getSpiller(main::ClientContext* context) {
+    std::unique_lock lck(mtx);
+    if (spiller == nullptr) {
+        auto vfs = context->getVFSUnsafe();
+        auto fileName = "hash_join_" + std::to_string(reinterpret_cast<uintptr_t>(this)) +
+                        StorageConstants::SPILL_FILE_SUFFIX;
+        spiller = std::make_unique<HashJoinSpiller>(vfs,
+            vfs->joinPath(context->getStorageManager()->getWAL()->getDirectory(), fileName));
+    }
+    return spiller.get();
+}
+
+void HashJoinSharedState::appendSpilledRuns(PartitionedRowWriter& writer) {
+    std::unique_lock lck(mtx);
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinSpiller::NUM_PARTITIONS; partitionIdx++) {
+        auto& runs = writer.getRuns(partitionIdx);
+        spilledRuns[partitionIdx].insert(spilledRuns[partitionIdx].end(), runs.begin(),
+            runs.end());
+        runs.clear();
+    }
+}
+
+void HashJoinSharedState::finalizeSpilling(main::ClientContext* context) {
+    auto numBytesPerTuple = hashTable->getTableSchema()->getNumBytesPerTuple();
+    if (hashTable->getNumTuples() > 0) {
+        // Local hash tables merged before spilling started.
+        PartitionedRowWriter writer{getSpiller(context), numBytesPerTuple};
+        hashTable->spill(writer);
+        writer.flush();
+        appendSpilledRuns(writer);
+    }
+    uint64_t numBytesInGroup = 0;
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinSpiller::NUM_PARTITIONS; partitionIdx++) {
+        uint64_t numBytesInPartition = 0;
+        for (auto& run : spilledRuns[partitionIdx]) {
+            numBytesInPartition += run.numRows * numBytesPerTuple;
+        }
+        if (numBytesInGroup > 0 && numBytesInGroup + numBytesInPartition > spillMemoryThreshold) {
+            partitionGroupEndIdxes.push_back(partitionIdx);
+            numBytesInGroup = 0;
+        }
+        numBytesInGroup += numBytesInPartition;
+    }
+    partitionGroupEndIdxes.push_back(HashJoinSpiller::NUM_PARTITIONS);
+}
+
+void HashJoinSharedState::registerSpillingProber() {
+    std::unique_lock lck(mtx);
+    numSpillingProbers++;
+}
+
+void HashJoinSharedState::finishProbeSpilling(PartitionedRowWriter* writer) {
+    std::unique_lock lck(mtx);
+    if (writer != nullptr) {
+        for (auto partitionIdx = 0u; partitionIdx < HashJoinSpiller::NUM_PARTITIONS;
+             partitionIdx++) {
+            auto& runs = writer->getRuns(partitionIdx);
+            spilledProbeRuns[partitionIdx].insert(spilledProbeRuns[partitionIdx].end(),
+                runs.begin(), runs.end());
+            runs.clear();
+        }
+    }
+    KU_ASSERT(numSpillingProbers > 0);
+    numSpillingProbers--;
+}
+
+bool HashJoinSharedState::getNextSpilledProbeRun(SpilledRun& run,
+    JoinHashTable*& groupHashTable_) {
+    std::unique_lock lck(mtx);
+    while (true) {
+        if (numSpillingProbers == 0 && !isLoadingGroup) {
+            if (nextGroupProbeRunIdx < groupProbeRuns.size()) {
+                run = groupProbeRuns[nextGroupProbeRunIdx++];
+                numGroupProbeRunsInProgress++;
+                groupHashTable_ = groupHashTable.get();
+                return true;
+            }
+            if (nextGroupIdx == partitionGroupEndIdxes.size()) {
+                // Other probers may still be probing the last group.
+                return false;
+            }
+            if (numGroupProbeRunsInProgress == 0) {
+                advancePartitionGroup(lck);
+                continue;
+            }
+        }
+        lck.unlock();
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+        lck.lock();
+    }
+}
+
+void HashJoinSharedState::finishSpilledProbeRun() {
+    std::unique_lock lck(mtx);
+    KU_ASSERT(numGroupProbeRunsInProgress > 0);
+    numGroupProbeRunsInProgress--;
+    if (numGroupProbeRunsInProgress == 0 && nextGroupProbeRunIdx == groupProbeRuns.size() &&
+        nextGroupIdx == partitionGroupEndIdxes.size()) {
+        // The last group is fully probed.
+        groupHashTable.reset();
+    }
+}
+
+uint64_t HashJoinSharedState::getNumSpilledBytes() {
+    std::unique_lock lck(mtx);
+    return spiller == nullptr ? 0 : spiller->getNumSpilledBytes();
+}
+
+void HashJoinSharedState::advancePartitionGroup(std::unique_lock<std::mutex>& lck) {
+    // Free the previous group before loading the next one.
+    groupHashTable.reset();
+    groupProbeRuns.clear();
+    nextGroupProbeRunIdx = 0;
+    uint64_t groupIdx;
+    do {
+        groupIdx = nextGroupIdx++;
+        for (auto partitionIdx = groupIdx == 0 ? 0 : partitionGroupEndIdxes[groupIdx - 1];
+             partitionIdx < partitionGroupEndIdxes[groupIdx]; partitionIdx++) {
+            groupProbeRuns.insert(groupProbeRuns.end(), spilledProbeRuns[partitionIdx].begin(),
+                spilledProbeRuns[partitionIdx].end());
+        }
+        // Groups without probe tuples produce no results, and are not loaded.
+    } while (groupProbeRuns.empty() && nextGroupIdx < partitionGroupEndIdxes.size());
+    if (groupProbeRuns.empty()) {
+        return;
+    }
+    isLoadingGroup = true;
+    lck.unlock();
+    std::unique_ptr<JoinHashTable> loadedHashTable;
+    try {
+        loadedHashTable = loadPartitionGroup(groupIdx);
+    } catch (...) {
+        lck.lock();
+        isLoadingGroup = false;
+        throw;
+    }
+    lck.lock();
+    groupHashTable = std::move(loadedHashTable);
+    isLoadingGroup = false;
+}
+
+std::unique_ptr<JoinHashTable> HashJoinSharedState::loadPartitionGroup(uint64_t groupIdx) {
+    auto groupHashTable_ = hashTable->createEmptyCopy();
+    auto numBytesPerTuple = hashTable->getTableSchema()->getNumBytesPerTuple();
+    auto buffer = std::make_unique<uint8_t[]>(
+        std::max<uint64_t>(HashJoinSpiller::SPILL_RUN_SIZE, numBytesPerTuple));
+    for (auto partitionIdx = groupIdx == 0 ? 0 : partitionGroupEndIdxes[groupIdx - 1];
+         partitionIdx < partitionGroupEndIdxes[groupIdx]; partitionIdx++) {
+        for (auto& run : spilledRuns[partitionIdx]) {
+            spiller->read(buffer.get(), run.numRows * numBytesPerTuple, run.offset);
+            groupHashTable_->appendSpilledTuples(buffer.get(), run.numRows);
+        }
+    }
+    groupHashTable_->allocateHashSlots(groupHashTable_->getNumTuples());
+    for (auto blockIdx = 0u; blockIdx < groupHashTable_->getNumTupleBlocks(); blockIdx++) {
+        groupHashTable_->buildHashSlots(blockIdx);
+    }
+    return groupHashTable_;
+}
+
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     std::vector<LogicalType> keyTypes;
     for (auto i = 0u; i < info->keysPos.size(); ++i) {
@@ -39,10 +245,12 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
-    auto numTuples = sharedState->getHashTable()->getNumTuples();
-    sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+void HashJoinBuild::finalize(ExecutionContext* context) {
+    if (sharedState->isSpilling()) {
+        // The global hash table is left empty, but still probed by tuples with null keys.
+        sharedState->finalizeSpilling(context->clientContext);
+    }
+    sharedState->initHashSlots();
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -51,10 +259,42 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             appendVectors();
         }
+        if (sharedState->canSpill()) {
+            spillIfNecessary(context);
+        }
+    }
+    if (sharedState->isSpilling()) {
+        spillLocalHashTable(context);
+        spillWriter->flush();
+        sharedState->appendSpilledRuns(*spillWriter);
+        return;
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
 }
 
+void HashJoinBuild::spillIfNecessary(ExecutionContext* context) {
+    // Memory usage is reported in steps to avoid contention on the shared counter.
+    auto memoryUsage = hashTable->getMemoryUsage();
+    if (memoryUsage - numReportedBytes >= MEMORY_REPORT_STEP) {
+        sharedState->updateMemoryUsage(memoryUsage - numReportedBytes);
+        numReportedBytes = memoryUsage;
+    }
+    if (sharedState->isSpilling() && memoryUsage >= MEMORY_REPORT_STEP) {
+        spillLocalHashTable(context);
+    }
+}
+
+void HashJoinBuild::spillLocalHashTable(ExecutionContext* context) {
+    if (spillWriter == nullptr) {
+        spillWriter = std::make_unique<PartitionedRowWriter>(
+            sharedState->getSpiller(context->clientContext),
+            hashTable->getTableSchema()->getNumBytesPerTuple());
+    }
+    hashTable->spill(*spillWriter);
+    sharedState->updateMemoryUsage(-(int64_t)numReportedBytes);
+    numReportedBytes = 0;
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -1,11 +1,28 @@
 #include "processor/operator/hash_join/hash_join_probe.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
+HashJoinProbe::~HashJoinProbe() {
+    if (spillState == nullptr) {
+        return;
+    }
+    if (!spillState->isReadingSpilledTuples) {
+        // Probe tuples buffered by this thread are dropped, since it produces no further results.
+        sharedState->finishProbeSpilling(nullptr /* writer */);
+    } else if (spillState->hasRunInProgress) {
+        sharedState->finishSpilledProbeRun();
+    }
+}
+
 void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    sharedState->buildHashSlots();
+    hashTable = sharedState->getHashTable();
     probeState = std::make_unique<ProbeState>();
     for (auto& keyDataPos : probeDataInfo.keysDataPos) {
         keyVectors.push_back(resultSet->getValueVector(keyDataPos).get());
@@ -31,6 +48,115 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64,
             context->clientContext->getMemoryManager());
     }
+    if (sharedState->isSpilling()) {
+        KU_ASSERT(flatProbe && !probeDataInfo.spillDataPos.empty());
+        spillState = std::make_unique<ProbeSpillState>();
+        // A spilled probe tuple consists of a null flag and a value for each vector, followed by
+        // the multiplicity of the result set.
+        uint64_t numBytesPerTuple = sizeof(uint64_t);
+        for (auto& dataPos : probeDataInfo.spillDataPos) {
+            auto vector = resultSet->getValueVector(dataPos).get();
+            spillState->vectors.push_back(vector);
+            numBytesPerTuple += 1 + vector->getNumBytesPerValue();
+            auto state = resultSet->dataChunks[dataPos.dataChunkPos]->state.get();
+            if (std::find(spillState->states.begin(), spillState->states.end(), state) ==
+                spillState->states.end()) {
+                spillState->states.push_back(state);
+            }
+        }
+        spillState->spiller = sharedState->getSpiller(context->clientContext);
+        spillState->writer =
+            std::make_unique<PartitionedRowWriter>(spillState->spiller, numBytesPerTuple);
+        spillState->runBuffer = std::make_unique<uint8_t[]>(
+            std::max<uint64_t>(HashJoinSpiller::SPILL_RUN_SIZE, numBytesPerTuple));
+        sharedState->registerSpillingProber();
+        spillState->selVector = std::make_shared<SelectionVector>(1 /* capacity */);
+        spillState->selVector->setToUnfiltered(1);
+    }
+}
+
+bool HashJoinProbe::getNextProbeTuple(ExecutionContext* context) {
+    if (spillState == nullptr) {
+        return children[0]->getNextTuple(context);
+    }
+    if (!spillState->isReadingSpilledTuples) {
+        while (children[0]->getNextTuple(context)) {
+            if (!spillProbeTuple()) {
+                // Tuples with null keys have no match, but may still produce results (e.g. left
+                // join). They are probed against the (empty) global hash table right away.
+                return true;
+            }
+        }
+        spillState->writer->flush();
+        sharedState->finishProbeSpilling(spillState->writer.get());
+        spillState->isReadingSpilledTuples = true;
+    }
+    return readSpilledProbeTuple();
+}
+
+bool HashJoinProbe::spillProbeTuple() {
+    for (auto& keyVector : keyVectors) {
+        KU_ASSERT(keyVector->state->isFlat());
+        if (keyVector->isNull(keyVector->state->selVector->selectedPositions[0])) {
+            return false;
+        }
+    }
+    JoinHashTable::computeKeyHashes(keyVectors, hashVector.get(), tmpHashVector.get());
+    auto hash = hashVector->getValue<hash_t>(hashVector->state->selVector->selectedPositions[0]);
+    auto tuple = spillState->writer->appendRow(HashJoinSpiller::getPartitionIdx(hash));
+    for (auto& vector : spillState->vectors) {
+        auto pos = vector->state->selVector->selectedPositions[0];
+        auto numBytesPerValue = vector->getNumBytesPerValue();
+        *tuple = vector->isNull(pos);
+        memcpy(tuple + 1, vector->getData() + pos * numBytesPerValue, numBytesPerValue);
+        tuple += 1 + numBytesPerValue;
+    }
+    memcpy(tuple, &resultSet->multiplicity, sizeof(uint64_t));
+    return true;
+}
+
+bool HashJoinProbe::readSpilledProbeTuple() {
+    while (spillState->nextTupleIdx == spillState->numTuplesInRun) {
+        if (!readNextSpilledRun()) {
+            return false;
+        }
+    }
+    for (auto& state : spillState->states) {
+        state->setToFlat();
+        state->selVector = spillState->selVector;
+    }
+    auto tuple = spillState->runBuffer.get() +
+                 spillState->nextTupleIdx++ * spillState->writer->getNumBytesPerRow();
+    for (auto& vector : spillState->vectors) {
+        auto numBytesPerValue = vector->getNumBytesPerValue();
+        vector->setNull(0 /* pos */, *tuple);
+        memcpy(vector->getData(), tuple + 1, numBytesPerValue);
+        tuple += 1 + numBytesPerValue;
+    }
+    memcpy(&resultSet->multiplicity, tuple, sizeof(uint64_t));
+    return true;
+}
+
+bool HashJoinProbe::readNextSpilledRun() {
+    // All tuples of the previous run have been probed, and no matched tuple of its partition group
+    // is referenced anymore.
+    if (spillState->hasRunInProgress) {
+        sharedState->finishSpilledProbeRun();
+        spillState->hasRunInProgress = false;
+    }
+    SpilledRun run{};
+    JoinHashTable* groupHashTable = nullptr;
+    if (!sharedState->getNextSpilledProbeRun(run, groupHashTable)) {
+        hashTable = sharedState->getHashTable();
+        return false;
+    }
+    spillState->hasRunInProgress = true;
+    hashTable = groupHashTable;
+    spillState->spiller->read(spillState->runBuffer.get(),
+        run.numRows * spillState->writer->getNumBytesPerRow(), run.offset);
+    spillState->numTuplesInRun = run.numRows;
+    spillState->nextTupleIdx = 0;
+    return true;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -43,14 +169,14 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(keyVectors[0]->state->selVector);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeTuple(context)) {
             return false;
         }
         saveSelVector(keyVectors[0]->state->selVector);
-        sharedState->getHashTable()->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
+        hashTable->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
             probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
+    auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors,
         probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -61,14 +187,14 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(keyVector->state->selVector);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextProbeTuple(context)) {
         return false;
     }
     saveSelVector(keyVector->state->selVector);
-    sharedState->getHashTable()->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
+    hashTable->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
         probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -80,7 +206,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -100,7 +226,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector->setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -181,6 +307,13 @@ uint64_t HashJoinProbe::getJoinResult() {
     }
 }
 
+std::unordered_map<std::string, std::string> HashJoinProbe::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"NumSpilledBytes", std::to_string(sharedState->getNumSpilledBytes())});
+    return result;
+}
+
 // The general flow of a hash join probe:
 // 1) find matched tuples of probe side key from ht.
 // 2) populate values from matched tuples into resultKeyDataChunk , buildSideFlatResultDataChunk
@@ -0,0 +1,69 @@
+#include "processor/operator/hash_join/hash_join_spiller.h"
+
+#include <fcntl.h>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+HashJoinSpiller::~HashJoinSpiller() {
+    if (fileInfo != nullptr) {
+        fileInfo.reset();
+        vfs->removeFileIfExists(filePath);
+    }
+}
+
+uint64_t HashJoinSpiller::write(const uint8_t* data, uint64_t numBytes) {
+    uint64_t offset;
+    {
+        std::unique_lock lck{mtx};
+        if (fileInfo == nullptr) {
+            fileInfo = vfs->openFile(filePath, O_RDWR | O_CREAT | O_TRUNC);
+        }
+        offset = fileSize.fetch_add(numBytes);
+    }
+    fileInfo->writeFile(data, numBytes, offset);
+    return offset;
+}
+
+void HashJoinSpiller::read(uint8_t* buffer, uint64_t numBytes, uint64_t offset) {
+    KU_ASSERT(fileInfo != nullptr && offset + numBytes <= fileSize.load());
+    fileInfo->readFromFile(buffer, numBytes, offset);
+}
+
+PartitionedRowWriter::PartitionedRowWriter(HashJoinSpiller* spiller, uint64_t numBytesPerRow)
+    : spiller{spiller}, numBytesPerRow{numBytesPerRow}, numRowsInBuffers{} {
+    maxNumRowsPerRun = std::max<uint64_t>(HashJoinSpiller::SPILL_RUN_SIZE / numBytesPerRow, 1);
+}
+
+uint8_t* PartitionedRowWriter::appendRow(uint64_t partitionIdx) {
+    KU_ASSERT(partitionIdx < HashJoinSpiller::NUM_PARTITIONS);
+    auto& buffer = buffers[partitionIdx];
+    if (buffer == nullptr) {
+        buffer = std::make_unique<uint8_t[]>(maxNumRowsPerRun * numBytesPerRow);
+    } else if (numRowsInBuffers[partitionIdx] == maxNumRowsPerRun) {
+        flushPartition(partitionIdx);
+    }
+    return buffer.get() + numRowsInBuffers[partitionIdx]++ * numBytesPerRow;
+}
+
+void PartitionedRowWriter::flush() {
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinSpiller::NUM_PARTITIONS; partitionIdx++) {
+        if (numRowsInBuffers[partitionIdx] > 0) {
+            flushPartition(partitionIdx);
+        }
+    }
+}
+
+void PartitionedRowWriter::flushPartition(uint64_t partitionIdx) {
+    auto numRows = numRowsInBuffers[partitionIdx];
+    auto offset = spiller->write(buffers[partitionIdx].get(), numRows * numBytesPerRow);
+    runs[partitionIdx].push_back(SpilledRun{offset, numRows});
+    numRowsInBuffers[partitionIdx] = 0;
+}
+
+} // namespace processor
+} // namespace kuzu
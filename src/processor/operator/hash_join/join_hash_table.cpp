@@ -1,5 +1,7 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <atomic>
+
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 
@@ -58,7 +60,22 @@ void JoinHashTable::appendVector(ValueVector* vector,
     }
 }
 
+static bool isSortedOnSelectedPos(ValueVector* nodeIDVector) {
+    auto selVector = nodeIDVector->state->selVector.get();
+    for (auto i = 1u; i < selVector->selectedSize; i++) {
+        if (nodeIDVector->getValue<nodeID_t>(selVector->selectedPositions[i]) <
+            nodeIDVector->getValue<nodeID_t>(selVector->selectedPositions[i - 1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void sortSelectedPos(ValueVector* nodeIDVector) {
+    // Adjacency lists copied into rel tables are already sorted by neighbor offset.
+    if (isSortedOnSelectedPos(nodeIDVector)) {
+        return;
+    }
     auto selVector = nodeIDVector->state->selVector.get();
     auto size = selVector->selectedSize;
     auto buffer = selVector->getMultableBuffer();
@@ -111,16 +128,17 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     }
 }
 
-void JoinHashTable::buildHashSlots() {
-    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
-        uint8_t* tuple = tupleBlock->getData();
-        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
-            auto lastSlotEntryInHT = insertEntry(tuple);
-            auto prevPtr = getPrevTuple(tuple);
-            memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
-                sizeof(uint8_t*));
-            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+void JoinHashTable::buildHashSlots(uint64_t tupleBlockIdx, JoinKeyFilter* keyFilter) {
+    auto& tupleBlock = factorizedTable->getTupleDataBlocks()[tupleBlockIdx];
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    auto hashColOffset = getHashValueColOffset();
+    uint8_t* tuple = tupleBlock->getData();
+    for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+        insertEntry(tuple);
+        if (keyFilter != nullptr) {
+            keyFilter->insert(*(hash_t*)(tuple + hashColOffset));
         }
+        tuple += numBytesPerTuple;
     }
 }
 
@@ -133,16 +151,54 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
     if (!discardNullFromKeys(keyVectors)) {
         return;
     }
+    computeKeyHashes(keyVectors, hashVector, tmpHashVector);
+    for (auto i = 0u; i < hashVector->state->selVector->selectedSize; i++) {
+        auto pos = hashVector->state->selVector->selectedPositions[i];
+        KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
+        probedTuples[i] = getTupleForHash(hashVector->getValue<hash_t>(pos));
+    }
+}
+
+void JoinHashTable::computeKeyHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector* hashVector, ValueVector* tmpHashVector) {
     function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
     for (auto i = 1u; i < keyVectors.size(); i++) {
         function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
         function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
     }
-    for (auto i = 0u; i < hashVector->state->selVector->selectedSize; i++) {
-        auto pos = hashVector->state->selVector->selectedPositions[i];
-        KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector->getValue<hash_t>(pos));
+}
+
+void JoinHashTable::spill(PartitionedRowWriter& writer) {
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    KU_ASSERT(writer.getNumBytesPerRow() == numBytesPerTuple);
+    auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto partitionIdx = HashJoinSpiller::getPartitionIdx(*(hash_t*)(tuple + hashColOffset));
+            memcpy(writer.appendRow(partitionIdx), tuple, numBytesPerTuple);
+            tuple += numBytesPerTuple;
+        }
+    }
+    factorizedTable->clear();
+}
+
+void JoinHashTable::appendSpilledTuples(const uint8_t* tuples, uint64_t numTuples) {
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    for (auto i = 0u; i < numTuples; i++) {
+        memcpy(factorizedTable->appendEmptyTuple(), tuples + i * numBytesPerTuple,
+            numBytesPerTuple);
+    }
+}
+
+std::unique_ptr<JoinHashTable> JoinHashTable::createEmptyCopy() const {
+    auto tableSchemaCopy = tableSchema->copy();
+    // Null flags of spilled tuples depend on the hash table they were spilled from.
+    for (auto i = 0u; i < tableSchemaCopy->getNumColumns(); i++) {
+        tableSchemaCopy->setMayContainsNullsToTrue(i);
     }
+    return std::make_unique<JoinHashTable>(memoryManager, LogicalType::copy(keyTypes),
+        std::move(tableSchemaCopy));
 }
 
 sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
@@ -187,11 +243,17 @@ uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
                        (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
 }
 
-uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
-    auto slot = findHashSlot(tuple);
-    auto prevPtr = *slot;
-    *slot = tuple;
-    return prevPtr;
+void JoinHashTable::insertEntry(uint8_t* tuple) const {
+    static_assert(sizeof(std::atomic<uint8_t*>) == sizeof(uint8_t*));
+    // Slots are 8-byte aligned inside hash slot blocks, so they can be accessed atomically.
+    // Ordering with probing is guaranteed by the caller, which synchronizes after all insertions
+    // are done.
+    auto slot = reinterpret_cast<std::atomic<uint8_t*>*>(findHashSlot(tuple));
+    auto prevPtr = slot->load(std::memory_order_relaxed);
+    do {
+        memcpy(reinterpret_cast<void*>(getPrevTuple(tuple)), reinterpret_cast<void*>(&prevPtr),
+            sizeof(uint8_t*));
+    } while (!slot->compare_exchange_weak(prevPtr, tuple, std::memory_order_relaxed));
 }
 
 bool JoinHashTable::compareFlatKeys(const std::vector<ValueVector*>& keyVectors,
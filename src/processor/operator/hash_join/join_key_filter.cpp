@@ -0,0 +1,45 @@
+#include "processor/operator/hash_join/join_key_filter.h"
+
+#include <bit>
+
+#include "common/vector/value_vector.h"
+#include "function/hash/vector_hash_functions.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void JoinKeyFilter::init(uint64_t numKeys) {
+    auto numBits = std::min(std::bit_ceil(std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY, 64)),
+        MAX_NUM_WORDS * 64);
+    if (numBits < numKeys * MIN_NUM_BITS_PER_KEY) {
+        // The filter would have too many false positives to be worth checking.
+        enabled = false;
+        return;
+    }
+    numWords = numBits / 64;
+    words = std::make_unique<std::atomic<uint64_t>[]>(numWords);
+    for (auto i = 0u; i < numWords; i++) {
+        words[i].store(0, std::memory_order_relaxed);
+    }
+    enabled = true;
+}
+
+sel_t JoinKeyFilter::select(ValueVector& keyVector, ValueVector& hashVector,
+    SelectionVector& selVector) const {
+    function::VectorHashFunction::computeHash(&keyVector, &hashVector);
+    auto buffer = selVector.getMultableBuffer();
+    sel_t numSelectedValues = 0;
+    for (auto i = 0u; i < selVector.selectedSize; i++) {
+        auto pos = selVector.selectedPositions[i];
+        buffer[numSelectedValues] = pos;
+        numSelectedValues +=
+            !keyVector.isNull(pos) && mayContain(hashVector.getValue<hash_t>(pos));
+    }
+    selVector.setToFiltered(numSelectedValues);
+    return numSelectedValues;
+}
+
+} // namespace processor
+} // namespace kuzu
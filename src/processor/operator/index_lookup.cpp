@@ -62,30 +62,18 @@ void IndexLookup::checkNullKeys(ValueVector* keyVector) {
     }
 }
 
-void stringPKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->selVector->selectedSize;
-    for (auto i = 0u; i < numKeys; i++) {
-        auto key =
-            keyVector->getValue<ku_string_t>(keyVector->state->selVector->selectedPositions[i]);
-        if (!info.index->lookup(transaction, key.getAsStringView(), offsets[i])) {
-            throw RuntimeException(ExceptionMessage::nonExistentPKException(key.getAsString()));
-        }
-    }
-}
-
-template<HashablePrimitive T>
-void primitivePKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->selVector->selectedSize;
-    for (auto i = 0u; i < numKeys; i++) {
-        auto pos = keyVector->state->selVector->selectedPositions[i];
-        auto key = keyVector->getValue<T>(pos);
-        if (!info.index->lookup(transaction, key, offsets[i])) {
-            throw RuntimeException(
-                ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)));
-        }
-    }
+static void throwNonExistentPKException(const ValueVector* keyVector, sel_t pos) {
+    TypeUtils::visit(
+        keyVector->dataType.getPhysicalType(),
+        [&](ku_string_t) {
+            throw RuntimeException(ExceptionMessage::nonExistentPKException(
+                keyVector->getValue<ku_string_t>(pos).getAsString()));
+        },
+        [&]<HashablePrimitive T>(T) {
+            throw RuntimeException(ExceptionMessage::nonExistentPKException(
+                TypeUtils::toString(keyVector->getValue<T>(pos))));
+        },
+        [&](auto) { KU_UNREACHABLE; });
 }
 
 // TODO(Guodong): Add short path for unfiltered case.
@@ -93,23 +81,21 @@ void IndexLookup::fillOffsetArraysFromVector(transaction::Transaction* transacti
     const IndexLookupInfo& info, ValueVector* keyVector, ValueVector* resultVector) {
     KU_ASSERT(resultVector->dataType.getPhysicalType() == PhysicalTypeID::INT64);
     auto offsets = (offset_t*)resultVector->getData();
-    TypeUtils::visit(
-        info.pkDataType->getPhysicalType(),
-        [&](ku_string_t) {
-            stringPKFillOffsetArraysFromVector(transaction, info, keyVector, offsets);
-        },
-        [&]<HashablePrimitive T>(T) {
-            if (info.pkDataType->getLogicalTypeID() == LogicalTypeID::SERIAL) {
-                auto numKeys = keyVector->state->selVector->selectedSize;
-                for (auto i = 0u; i < numKeys; i++) {
-                    auto pos = keyVector->state->selVector->selectedPositions[i];
-                    offsets[i] = keyVector->getValue<int64_t>(pos);
-                }
-            } else {
-                primitivePKFillOffsetArraysFromVector<T>(transaction, info, keyVector, offsets);
-            }
-        },
-        [&](auto) { KU_UNREACHABLE; });
+    auto numKeys = keyVector->state->selVector->selectedSize;
+    if (info.pkDataType->getLogicalTypeID() == LogicalTypeID::SERIAL) {
+        for (auto i = 0u; i < numKeys; i++) {
+            auto pos = keyVector->state->selVector->selectedPositions[i];
+            offsets[i] = keyVector->getValue<int64_t>(pos);
+        }
+        return;
+    }
+    info.index->lookup(transaction, keyVector, offsets);
+    for (auto i = 0u; i < numKeys; i++) {
+        if (offsets[i] == INVALID_OFFSET) {
+            throwNonExistentPKException(keyVector,
+                keyVector->state->selVector->selectedPositions[i]);
+        }
+    }
 }
 
 } // namespace processor
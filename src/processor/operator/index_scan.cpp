@@ -20,18 +20,15 @@ bool IndexScan::getNextTuplesInternal(ExecutionContext* context) {
         }
         saveSelVector(outVector->state->selVector);
         numSelectedValues = 0u;
+        pkIndex->lookup(context->clientContext->getTx(), indexVector, nodeOffsets.data());
         auto buffer = outVector->state->selVector->getMultableBuffer();
         for (auto i = 0u; i < indexVector->state->selVector->selectedSize; ++i) {
-            auto pos = indexVector->state->selVector->selectedPositions[i];
-            if (indexVector->isNull(pos)) {
+            if (nodeOffsets[i] == INVALID_OFFSET) {
                 continue;
             }
-            buffer[numSelectedValues] = pos;
-            offset_t nodeOffset = INVALID_OFFSET;
-            numSelectedValues +=
-                pkIndex->lookup(context->clientContext->getTx(), indexVector, pos, nodeOffset);
-            nodeID_t nodeID{nodeOffset, tableID};
-            outVector->setValue<nodeID_t>(pos, nodeID);
+            auto pos = indexVector->state->selVector->selectedPositions[i];
+            buffer[numSelectedValues++] = pos;
+            outVector->setValue<nodeID_t>(pos, nodeID_t{nodeOffsets[i], tableID});
         }
         if (!outVector->state->isFlat() && outVector->state->selVector->isUnfiltered()) {
             outVector->state->selVector->setToFiltered();
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "function/hash/hash_functions.h"
+#include "processor/operator/intersect/intersect_simd.h"
 
 using namespace kuzu::common;
 
@@ -27,10 +28,13 @@ void Intersect::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* /
         payloadVectorsToScanInto.push_back(std::move(vectorsToReadInto));
     }
     for (auto& sharedHT : sharedHTs) {
+        sharedHT->buildHashSlots();
         intersectSelVectors.push_back(std::make_unique<SelectionVector>(DEFAULT_VECTOR_CAPACITY));
         isIntersectListAFlatValue.push_back(
             sharedHT->getHashTable()->getTableSchema()->getColumn(1)->isFlat());
     }
+    leftOffsets.resize(DEFAULT_VECTOR_CAPACITY);
+    rightOffsets.resize(DEFAULT_VECTOR_CAPACITY);
 }
 
 void Intersect::probeHTs() {
@@ -52,31 +56,30 @@ void Intersect::probeHTs() {
     }
 }
 
-void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
-    nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
+// Copies the offsets of a list of node IDs into offsets, and returns whether they are distinct.
+static bool packOffsets(const nodeID_t* nodeIDs, uint64_t numValues, offset_t* offsets) {
+    auto isDistinct = true;
+    for (auto i = 0u; i < numValues; i++) {
+        offsets[i] = nodeIDs[i].offset;
+        isDistinct &= i == 0 || offsets[i - 1] != offsets[i];
+    }
+    return isDistinct;
+}
+
+void Intersect::twoWayIntersect(offset_t* leftOffsets, SelectionVector& lSelVector,
+    bool isLeftDistinct, const offset_t* rightOffsets, SelectionVector& rSelVector,
+    bool isRightDistinct) {
     KU_ASSERT(lSelVector.selectedSize <= rSelVector.selectedSize);
     auto leftPositionBuffer = lSelVector.getMultableBuffer();
     auto rightPositionBuffer = rSelVector.getMultableBuffer();
-    sel_t leftPosition = 0, rightPosition = 0;
-    uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.selectedSize && rightPosition < rSelVector.selectedSize) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID.offset < rightNodeID.offset) {
-            leftPosition++;
-        } else if (leftNodeID.offset > rightNodeID.offset) {
-            rightPosition++;
-        } else {
-            leftPositionBuffer[outputValuePosition] = leftPosition;
-            rightPositionBuffer[outputValuePosition] = rightPosition;
-            leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
-        }
+    auto numMatches = IntersectSIMD::intersect(leftOffsets, lSelVector.selectedSize,
+        rightOffsets, rSelVector.selectedSize, isLeftDistinct && isRightDistinct,
+        leftPositionBuffer, rightPositionBuffer);
+    for (auto i = 0u; i < numMatches; i++) {
+        leftOffsets[i] = leftOffsets[leftPositionBuffer[i]];
     }
-    lSelVector.setToFiltered(outputValuePosition);
-    rSelVector.setToFiltered(outputValuePosition);
+    lSelVector.setToFiltered(numMatches);
+    rSelVector.setToFiltered(numMatches);
 }
 
 static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
@@ -125,22 +128,36 @@ void Intersect::intersectLists(const std::vector<overflow_value_t>& listsToInter
         return;
     }
     KU_ASSERT(listsToIntersect[0].numElements <= DEFAULT_VECTOR_CAPACITY);
-    memcpy(outKeyVector->getData(), listsToIntersect[0].value,
-        listsToIntersect[0].numElements * sizeof(nodeID_t));
+    // Lists are intersected on their offsets, which are packed densely for the SIMD kernel.
+    auto leftNodeIDs = (nodeID_t*)listsToIntersect[0].value;
+    auto isLeftDistinct =
+        packOffsets(leftNodeIDs, listsToIntersect[0].numElements, leftOffsets.data());
     SelectionVector lSelVector(listsToIntersect[0].numElements);
     lSelVector.selectedSize = listsToIntersect[0].numElements;
     std::vector<SelectionVector*> selVectorsForIntersectedLists;
     intersectSelVectors[0]->setToUnfiltered(listsToIntersect[0].numElements);
     selVectorsForIntersectedLists.push_back(intersectSelVectors[0].get());
     for (auto i = 0u; i < listsToIntersect.size() - 1; i++) {
-        intersectSelVectors[i + 1]->setToUnfiltered(listsToIntersect[i + 1].numElements);
-        twoWayIntersect((nodeID_t*)outKeyVector->getData(), lSelVector,
-            (nodeID_t*)listsToIntersect[i + 1].value, *intersectSelVectors[i + 1]);
+        auto& rightList = listsToIntersect[i + 1];
+        KU_ASSERT(rightList.numElements <= DEFAULT_VECTOR_CAPACITY);
+        auto isRightDistinct =
+            packOffsets((nodeID_t*)rightList.value, rightList.numElements, rightOffsets.data());
+        intersectSelVectors[i + 1]->setToUnfiltered(rightList.numElements);
+        twoWayIntersect(leftOffsets.data(), lSelVector, isLeftDistinct, rightOffsets.data(),
+            *intersectSelVectors[i + 1], isRightDistinct);
         // Here we need to slice all selVectors that have been previously intersected, as all these
         // lists need to be selected synchronously to read payloads correctly.
         sliceSelVectors(selVectorsForIntersectedLists, lSelVector);
         lSelVector.setToUnfiltered();
         selVectorsForIntersectedLists.push_back(intersectSelVectors[i + 1].get());
+        if (lSelVector.selectedSize == 0) {
+            break;
+        }
+    }
+    // The selected positions of the first list point to the node IDs that are in all lists.
+    auto outNodeIDs = (nodeID_t*)outKeyVector->getData();
+    for (auto i = 0u; i < lSelVector.selectedSize; i++) {
+        outNodeIDs[i] = leftNodeIDs[intersectSelVectors[0]->selectedPositions[i]];
     }
     outKeyVector->state->selVector->selectedSize = lSelVector.selectedSize;
 }
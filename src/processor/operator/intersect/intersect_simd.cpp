@@ -0,0 +1,165 @@
+#include "processor/operator/intersect/intersect_simd.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_X86_SIMD
+#include <immintrin.h>
+#endif
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+namespace {
+
+struct IntersectOutput {
+    sel_t* leftPositions;
+    sel_t* rightPositions;
+    uint64_t numMatches = 0;
+
+    inline void append(uint64_t leftPosition, uint64_t rightPosition) {
+        leftPositions[numMatches] = leftPosition;
+        rightPositions[numMatches] = rightPosition;
+        numMatches++;
+    }
+};
+
+void merge(const offset_t* left, uint64_t leftSize, uint64_t leftPosition, const offset_t* right,
+    uint64_t rightSize, uint64_t rightPosition, IntersectOutput& output) {
+    while (leftPosition < leftSize && rightPosition < rightSize) {
+        if (left[leftPosition] < right[rightPosition]) {
+            leftPosition++;
+        } else if (left[leftPosition] > right[rightPosition]) {
+            rightPosition++;
+        } else {
+            output.append(leftPosition++, rightPosition++);
+        }
+    }
+}
+
+// Finds each value of small in large, starting from the position following the previous match.
+// The range holding the value is found by doubling the step from that position, so each search
+// costs O(log(distance)) rather than O(distance) comparisons.
+template<bool SMALL_IS_LEFT>
+void gallop(const offset_t* small, uint64_t smallSize, const offset_t* large, uint64_t largeSize,
+    IntersectOutput& output) {
+    uint64_t largePosition = 0;
+    for (auto smallPosition = 0u; smallPosition < smallSize; smallPosition++) {
+        auto value = small[smallPosition];
+        uint64_t step = 1;
+        auto end = largePosition;
+        while (end < largeSize && large[end] < value) {
+            largePosition = end + 1;
+            end = largePosition + step;
+            step *= 2;
+        }
+        end = std::min(end, largeSize);
+        largePosition = std::lower_bound(large + largePosition, large + end, value) - large;
+        if (largePosition == largeSize) {
+            return;
+        }
+        if (large[largePosition] == value) {
+            if constexpr (SMALL_IS_LEFT) {
+                output.append(smallPosition, largePosition);
+            } else {
+                output.append(largePosition, smallPosition);
+            }
+            largePosition++;
+        }
+    }
+}
+
+#ifdef KUZU_X86_SIMD
+static inline uint32_t rotateLeft(uint32_t mask, uint32_t numBits, uint32_t numLanes) {
+    return ((mask << numBits) | (mask >> (numLanes - numBits))) & ((1u << numLanes) - 1);
+}
+
+static inline void appendMatches(uint32_t leftMask, uint32_t rightMask, uint64_t leftPosition,
+    uint64_t rightPosition, IntersectOutput& output) {
+    while (leftMask != 0) {
+        output.append(leftPosition + __builtin_ctz(leftMask),
+            rightPosition + __builtin_ctz(rightMask));
+        leftMask &= leftMask - 1;
+        rightMask &= rightMask - 1;
+    }
+}
+
+__attribute__((target("avx2"))) static inline uint32_t movemaskAVX2(__m256i mask) {
+    return _mm256_movemask_pd(_mm256_castsi256_pd(mask));
+}
+
+// Compares a block of left with all rotations of a block of right, where lane i of the j-th
+// rotation holds lane (i + j) % 4 of the block. Since values are distinct, the k-th matching lane
+// of the left block matches the k-th matching lane of the right one. The block with the smaller
+// last value can't match any later value of the other list and is skipped (or both if their last
+// values are equal). Remaining values are merged.
+__attribute__((target("avx2"))) static uint64_t intersectAVX2(const offset_t* left,
+    uint64_t leftSize, const offset_t* right, uint64_t rightSize, IntersectOutput& output) {
+    static constexpr uint64_t BLOCK_SIZE = 4;
+    uint64_t leftPosition = 0, rightPosition = 0;
+    while (leftPosition + BLOCK_SIZE <= leftSize && rightPosition + BLOCK_SIZE <= rightSize) {
+        auto leftBlock = _mm256_loadu_si256((const __m256i*)(left + leftPosition));
+        auto rightBlock = _mm256_loadu_si256((const __m256i*)(right + rightPosition));
+        auto match0 = _mm256_cmpeq_epi64(leftBlock, rightBlock);
+        auto match1 = _mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0x39));
+        auto match2 = _mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0x4e));
+        auto match3 = _mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0x93));
+        auto leftMask = movemaskAVX2(
+            _mm256_or_si256(_mm256_or_si256(match0, match1), _mm256_or_si256(match2, match3)));
+        // Most blocks don't match in intersections of adjacency lists.
+        if (leftMask != 0) {
+            auto rightMask = movemaskAVX2(match0) | rotateLeft(movemaskAVX2(match1), 1, 4) |
+                             rotateLeft(movemaskAVX2(match2), 2, 4) |
+                             rotateLeft(movemaskAVX2(match3), 3, 4);
+            appendMatches(leftMask, rightMask, leftPosition, rightPosition, output);
+        }
+        auto leftLast = left[leftPosition + BLOCK_SIZE - 1];
+        auto rightLast = right[rightPosition + BLOCK_SIZE - 1];
+        // Branch-free, since which block ends first is unpredictable.
+        leftPosition += (uint64_t)(leftLast <= rightLast) * BLOCK_SIZE;
+        rightPosition += (uint64_t)(rightLast <= leftLast) * BLOCK_SIZE;
+    }
+    merge(left, leftSize, leftPosition, right, rightSize, rightPosition, output);
+    return output.numMatches;
+}
+#endif
+
+using intersect_kernel_t = uint64_t (*)(const offset_t*, uint64_t, const offset_t*, uint64_t,
+    IntersectOutput&);
+
+intersect_kernel_t selectKernel() {
+#ifdef KUZU_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return intersectAVX2;
+    }
+#endif
+    return nullptr;
+}
+
+const intersect_kernel_t kernel = selectKernel();
+
+} // namespace
+
+uint64_t IntersectSIMD::intersect(const offset_t* left, uint64_t leftSize, const offset_t* right,
+    uint64_t rightSize, bool isDistinct, sel_t* leftPositions, sel_t* rightPositions) {
+    IntersectOutput output{leftPositions, rightPositions};
+    if (leftSize == 0 || rightSize == 0) {
+        return 0;
+    }
+    if (rightSize / leftSize >= GALLOPING_RATIO) {
+        gallop<true /* SMALL_IS_LEFT */>(left, leftSize, right, rightSize, output);
+    } else if (leftSize / rightSize >= GALLOPING_RATIO) {
+        gallop<false /* SMALL_IS_LEFT */>(right, rightSize, left, leftSize, output);
+    } else if (isDistinct && kernel != nullptr) {
+        kernel(left, leftSize, right, rightSize, output);
+    } else {
+        merge(left, leftSize, 0, right, rightSize, 0, output);
+    }
+    return output.numMatches;
+}
+
+} // namespace processor
+} // namespace kuzu
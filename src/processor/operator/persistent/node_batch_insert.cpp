@@ -29,7 +29,7 @@ void NodeBatchInsertSharedState::initPKIndex(kuzu::processor::ExecutionContext*
             readerSharedState->funcState->ptrCast<function::BaseScanSharedState>();
         numRows = scanSharedState->getNumRows();
     } else {
-        numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+        numRows = distinctSharedState->getNumTuples();
     }
     pkIndex->bulkReserve(numRows);
     globalIndexBuilder = IndexBuilder(std::make_shared<IndexBuilderSharedState>(pkIndex));
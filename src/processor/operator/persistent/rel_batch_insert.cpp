@@ -1,5 +1,7 @@
 #include "processor/operator/persistent/rel_batch_insert.h"
 
+#include <numeric>
+
 #include "common/exception/copy.h"
 #include "common/exception/message.h"
 #include "common/string_format.h"
@@ -73,6 +75,7 @@ void RelBatchInsert::prepareCSRNodeGroup(const ChunkedNodeGroupCollection& parti
         auto& offsetChunk = chunkedGroup->getColumnChunkUnsafe(relInfo.offsetColumnID);
         setOffsetFromCSROffsets(offsetChunk, *csrHeader.offset);
     }
+    sortCSRListsByNbrOffset(partition, relInfo, csrHeader, csrChunkCapacity);
     populateEndCSROffsets(csrHeader, gaps);
 }
 
@@ -174,6 +177,54 @@ void RelBatchInsert::setOffsetFromCSROffsets(ColumnChunk& nodeOffsetChunk,
     }
 }
 
+void RelBatchInsert::sortCSRListsByNbrOffset(const ChunkedNodeGroupCollection& partition,
+    const RelBatchInsertInfo& relInfo, const ChunkedCSRHeader& csrHeader,
+    offset_t csrChunkCapacity) {
+    // Rels of a node are placed in the order they are read. Here we reorder them by neighbor
+    // offset, so that scans of a CSR list produce sorted neighbors, which intersect builds then
+    // don't need to sort.
+    auto nbrColumnID = relInfo.offsetColumnID == 0 ? 1 : 0;
+    std::vector<offset_t> nbrOffsets(csrChunkCapacity);
+    for (auto& chunkedGroup : partition.getChunkedGroups()) {
+        auto& offsetChunk = chunkedGroup->getColumnChunk(relInfo.offsetColumnID);
+        auto& nbrChunk = chunkedGroup->getColumnChunk(nbrColumnID);
+        for (auto i = 0u; i < offsetChunk.getNumValues(); i++) {
+            nbrOffsets[offsetChunk.getValue<offset_t>(i)] = nbrChunk.getValue<offset_t>(i);
+        }
+    }
+    // newCSROffsets[csrOffset] is the position of the rel at csrOffset after sorting its list.
+    std::vector<offset_t> newCSROffsets(csrChunkCapacity);
+    std::vector<offset_t> csrOffsets;
+    auto isSorted = true;
+    for (auto i = 0u; i < csrHeader.offset->getNumValues(); i++) {
+        // End csr offsets don't include gaps yet.
+        auto endCSROffset = csrHeader.offset->getValue<offset_t>(i);
+        auto startCSROffset = endCSROffset - csrHeader.length->getValue<length_t>(i);
+        csrOffsets.resize(endCSROffset - startCSROffset);
+        std::iota(csrOffsets.begin(), csrOffsets.end(), startCSROffset);
+        if (!std::is_sorted(nbrOffsets.begin() + startCSROffset,
+                nbrOffsets.begin() + endCSROffset)) {
+            isSorted = false;
+            std::stable_sort(csrOffsets.begin(), csrOffsets.end(),
+                [&](offset_t left, offset_t right) {
+                    return nbrOffsets[left] < nbrOffsets[right];
+                });
+        }
+        for (auto j = 0u; j < csrOffsets.size(); j++) {
+            newCSROffsets[csrOffsets[j]] = startCSROffset + j;
+        }
+    }
+    if (isSorted) {
+        return;
+    }
+    for (auto& chunkedGroup : partition.getChunkedGroups()) {
+        auto& offsetChunk = chunkedGroup->getColumnChunkUnsafe(relInfo.offsetColumnID);
+        for (auto i = 0u; i < offsetChunk.getNumValues(); i++) {
+            offsetChunk.setValue<offset_t>(newCSROffsets[offsetChunk.getValue<offset_t>(i)], i);
+        }
+    }
+}
+
 void RelBatchInsert::appendNewNodeGroup(const RelBatchInsertInfo& relInfo,
     RelBatchInsertLocalState& localState, BatchInsertSharedState& sharedState,
     const PartitionerSharedState& partitionerSharedState) {
@@ -77,6 +77,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "PATH_PROPERTY_PROBE";
     case PhysicalOperatorType::PROJECTION:
         return "PROJECTION";
+    case PhysicalOperatorType::PROPERTY_INDEX_SCAN:
+        return "PROPERTY_INDEX_SCAN";
     case PhysicalOperatorType::RECURSIVE_JOIN:
         return "RECURSIVE_JOIN";
     case PhysicalOperatorType::RENAME_PROPERTY:
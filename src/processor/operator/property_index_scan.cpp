@@ -0,0 +1,68 @@
+#include "processor/operator/property_index_scan.h"
+
+#include <algorithm>
+
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void PropertyIndexScan::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    auto memoryManager = context->clientContext->getMemoryManager();
+    if (info->lowerBound != nullptr) {
+        info->lowerBound->init(*resultSet, memoryManager);
+    }
+    if (info->upperBound != nullptr) {
+        info->upperBound->init(*resultSet, memoryManager);
+    }
+    outVector = resultSet->getValueVector(info->outDataPos).get();
+}
+
+void PropertyIndexScan::lookup(ExecutionContext* context) {
+    auto clientContext = context->clientContext;
+    const ValueVector* lowerBound = nullptr;
+    const ValueVector* upperBound = nullptr;
+    if (info->lowerBound != nullptr) {
+        info->lowerBound->evaluate(clientContext);
+        lowerBound = info->lowerBound->resultVector.get();
+    }
+    if (info->upperBound != nullptr) {
+        info->upperBound->evaluate(clientContext);
+        upperBound = info->upperBound->resultVector.get();
+    }
+    // The snapshot is held until the lookup is done, even if the index is dropped meanwhile.
+    auto index = cache->getIndex(clientContext->getTx(), *clientContext->getCatalog(),
+        info->tableID, info->propertyID);
+    auto [begin, end] =
+        index->lookup(lowerBound, info->lowerInclusive, upperBound, info->upperInclusive);
+    auto offsets = index->getNodeOffsets(begin, end);
+    nodeOffsets.assign(offsets.begin(), offsets.end());
+    std::sort(nodeOffsets.begin(), nodeOffsets.end());
+    nextIdx = 0;
+}
+
+bool PropertyIndexScan::getNextTuplesInternal(ExecutionContext* context) {
+    while (nextIdx >= nodeOffsets.size()) {
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        lookup(context);
+    }
+    // Node IDs of an output vector must be in the same node group.
+    auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(nodeOffsets[nextIdx]);
+    auto numNodes = 0u;
+    outVector->state->selVector->setToUnfiltered();
+    while (nextIdx < nodeOffsets.size() && numNodes < DEFAULT_VECTOR_CAPACITY &&
+           StorageUtils::getNodeGroupIdx(nodeOffsets[nextIdx]) == nodeGroupIdx) {
+        outVector->setValue<nodeID_t>(numNodes++, nodeID_t{nodeOffsets[nextIdx++], info->tableID});
+    }
+    outVector->state->initOriginalAndSelectedSize(numNodes);
+    metrics->numOutputTuple.increase(numNodes);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
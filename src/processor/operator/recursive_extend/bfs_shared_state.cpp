@@ -0,0 +1,187 @@
+#include "processor/operator/recursive_extend/bfs_shared_state.h"
+
+namespace kuzu {
+namespace processor {
+
+BFSSharedState::BFSSharedState(BaseBFSState* bfsState, const BottomUpInfo* bottomUpInfo)
+    : bfsState{bfsState}, bottomUpInfo{bottomUpInfo}, isBottomUp{false}, nextUnvisitedNodeIdx{0},
+      morselSize{1}, numMorselsHandedOut{0}, numMorselsApplied{0},
+      stopHandingOutMorsels{false}, finished{false}, aborted{false}, published{false} {
+    if (bfsState->isComplete()) {
+        finished = true;
+    } else {
+        startLevel();
+    }
+}
+
+bool BFSSharedState::getMorsel(BFSMorsel& morsel, bool& hasNewMorsels) {
+    std::unique_lock lck{mtx};
+    while (!finished) {
+        if (!stopHandingOutMorsels && bfsState->isComplete()) {
+            stopHandingOutMorsels = true;
+        }
+        if (!stopHandingOutMorsels && hasNextMorsel()) {
+            morsel.morselIdx = numMorselsHandedOut++;
+            morsel.level = bfsState->getCurrentLevel();
+            morsel.isBottomUp = isBottomUp;
+            morsel.nodeIDs = getNextMorsel();
+            finishedMorsels.emplace_back();
+            return true;
+        }
+        if (!tryFinishLevel()) {
+            return false;
+        }
+        if (published) {
+            hasNewMorsels = true;
+        }
+    }
+    return false;
+}
+
+bool BFSSharedState::finishMorsel(const BFSMorsel& morsel, std::vector<FrontierEdge> edges) {
+    std::unique_lock lck{mtx};
+    finishedMorsels[morsel.morselIdx] = std::move(edges);
+    return applyFinishedMorsels() && published;
+}
+
+bool BFSSharedState::abortMorsel(const BFSMorsel& morsel) {
+    std::unique_lock lck{mtx};
+    aborted = true;
+    stopHandingOutMorsels = true;
+    finishedMorsels[morsel.morselIdx] = std::vector<FrontierEdge>{};
+    return applyFinishedMorsels() && published;
+}
+
+bool BFSSharedState::hasMorsel() {
+    std::unique_lock lck{mtx};
+    return hasMorselNoLock();
+}
+
+bool BFSSharedState::hasMorselOrIsFinished() {
+    std::unique_lock lck{mtx};
+    return finished || hasMorselNoLock();
+}
+
+bool BFSSharedState::isFinished() {
+    std::unique_lock lck{mtx};
+    return finished;
+}
+
+bool BFSSharedState::isAborted() {
+    std::unique_lock lck{mtx};
+    return aborted;
+}
+
+bool BFSSharedState::isPublished() {
+    std::unique_lock lck{mtx};
+    return published;
+}
+
+void BFSSharedState::setPublished(bool isPublished) {
+    std::unique_lock lck{mtx};
+    published = isPublished;
+}
+
+bool BFSSharedState::applyFinishedMorsels() {
+    auto isWeighted = bfsState->isWeighted();
+    while (numMorselsApplied < finishedMorsels.size() &&
+           finishedMorsels[numMorselsApplied].has_value()) {
+        for (auto& edge : *finishedMorsels[numMorselsApplied]) {
+            if (isWeighted) {
+                bfsState->relax(edge.boundNodeID, edge.nbrNodeID, edge.relID, edge.weight);
+            } else {
+                bfsState->markVisited(edge.boundNodeID, edge.nbrNodeID, edge.relID,
+                    edge.boundNodeMultiplicity);
+            }
+        }
+        finishedMorsels[numMorselsApplied].reset();
+        numMorselsApplied++;
+    }
+    if (!stopHandingOutMorsels && bfsState->isComplete()) {
+        stopHandingOutMorsels = true;
+    }
+    if (stopHandingOutMorsels || !hasNextMorsel()) {
+        return tryFinishLevel();
+    }
+    return false;
+}
+
+// Follows the single threaded BFS: the BFS stops as soon as it is complete, otherwise the current
+// level is finalized once all of its nodes have been extended.
+bool BFSSharedState::tryFinishLevel() {
+    if (numMorselsApplied < numMorselsHandedOut) {
+        return false;
+    }
+    if (aborted || bfsState->isComplete()) {
+        finished = true;
+        return true;
+    }
+    bfsState->finalizeCurrentLevel();
+    if (bfsState->isComplete()) {
+        finished = true;
+        return true;
+    }
+    startLevel();
+    return true;
+}
+
+void BFSSharedState::startLevel() {
+    isBottomUp = shouldExtendBottomUp();
+    unvisitedNodeIDs.clear();
+    nextUnvisitedNodeIdx = 0;
+    frontierNodeIDs.clear();
+    auto numNodesToExtend = bfsState->getCurrentFrontierSize();
+    if (isBottomUp) {
+        for (auto& [tableID, numNodes] : bottomUpInfo->tableIDAndNumNodes) {
+            for (auto offset = 0u; offset < numNodes; ++offset) {
+                auto nodeID = common::nodeID_t{offset, tableID};
+                if (!bfsState->isVisited(nodeID)) {
+                    unvisitedNodeIDs.push_back(nodeID);
+                }
+            }
+        }
+        for (auto nodeID : bfsState->getCurrentFrontierNodeIDs()) {
+            frontierNodeIDs.insert(nodeID);
+        }
+        numNodesToExtend = unvisitedNodeIDs.size();
+    }
+    morselSize =
+        std::clamp<uint64_t>(numNodesToExtend / MIN_NUM_MORSELS_PER_LEVEL, 1, MAX_MORSEL_SIZE);
+    numMorselsHandedOut = 0;
+    numMorselsApplied = 0;
+    stopHandingOutMorsels = false;
+    finishedMorsels.clear();
+}
+
+bool BFSSharedState::shouldExtendBottomUp() const {
+    if (bottomUpInfo == nullptr) {
+        return false;
+    }
+    auto numVisitedNodes = bfsState->getNumVisitedNodes();
+    auto numUnvisitedNodes =
+        bottomUpInfo->numNodes > numVisitedNodes ? bottomUpInfo->numNodes - numVisitedNodes : 0;
+    return numUnvisitedNodes < bfsState->getCurrentFrontierSize();
+}
+
+bool BFSSharedState::hasMorselNoLock() const {
+    return !finished && !stopHandingOutMorsels && hasNextMorsel();
+}
+
+bool BFSSharedState::hasNextMorsel() const {
+    return isBottomUp ? nextUnvisitedNodeIdx < unvisitedNodeIDs.size() :
+                        bfsState->hasNextMorsel();
+}
+
+std::span<const common::nodeID_t> BFSSharedState::getNextMorsel() {
+    if (!isBottomUp) {
+        return bfsState->getNextMorsel(morselSize);
+    }
+    auto numNodes = std::min(morselSize, unvisitedNodeIDs.size() - nextUnvisitedNodeIdx);
+    auto morsel = std::span<const common::nodeID_t>(
+        unvisitedNodeIDs.data() + nextUnvisitedNodeIdx, numNodes);
+    nextUnvisitedNodeIdx += numNodes;
+    return morsel;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -6,19 +6,23 @@ namespace kuzu {
 namespace processor {
 
 void Frontier::addEdge(nodeID_t boundNodeID, nodeID_t nbrNodeID, nodeID_t relID) {
-    if (!bwdEdges.contains(nbrNodeID)) {
+    auto edgeIdx = bwdEdges.size();
+    bwdEdges.push_back(BwdEdge{{boundNodeID, relID}, INVALID_EDGE_IDX});
+    auto [edgeList, inserted] = bwdEdgeLists.insert(nbrNodeID, BwdEdgeList{edgeIdx, edgeIdx});
+    if (inserted) {
         nodeIDs.push_back(nbrNodeID);
-        bwdEdges.insert({nbrNodeID, std::vector<frontier::node_rel_id_t>{}});
+    } else {
+        bwdEdges[edgeList->lastEdgeIdx].nextEdgeIdx = edgeIdx;
+        edgeList->lastEdgeIdx = edgeIdx;
     }
-    bwdEdges.at(nbrNodeID).emplace_back(boundNodeID, relID);
 }
 
 void Frontier::addNodeWithMultiplicity(nodeID_t nodeID, uint64_t multiplicity) {
-    if (nodeIDToMultiplicity.contains(nodeID)) {
-        nodeIDToMultiplicity.at(nodeID) += multiplicity;
-    } else {
-        nodeIDToMultiplicity.insert({nodeID, multiplicity});
+    auto [nodeMultiplicity, inserted] = nodeIDToMultiplicity.insert(nodeID, multiplicity);
+    if (inserted) {
         nodeIDs.push_back(nodeID);
+    } else {
+        *nodeMultiplicity += multiplicity;
     }
 }
 
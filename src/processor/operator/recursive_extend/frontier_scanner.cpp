@@ -80,11 +80,13 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
     }
 
     auto level = 0;
-    while (!nbrsStack.empty()) {
+    while (!cursorStack.empty()) {
         auto& cursor = cursorStack.top();
-        cursor++;
-        if ((uint64_t)cursor < nbrsStack.top()->size()) { // Found a new nbr
-            auto& nbr = nbrsStack.top()->at(cursor);
+        cursor.edgeIdx = cursor.edgeIdx == Frontier::INVALID_EDGE_IDX ?
+                             cursor.firstEdgeIdx :
+                             cursor.frontier->getNextBwdEdgeIdx(cursor.edgeIdx);
+        if (cursor.edgeIdx != Frontier::INVALID_EDGE_IDX) { // Found a new nbr
+            auto& nbr = cursor.frontier->getBwdEdge(cursor.edgeIdx);
             nodeIDs[level] = nbr.first;
             relIDs[level] = nbr.second;
             if (level == 0) { // Found a new nbr at level 0. Found a new path.
@@ -95,12 +97,12 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
                 continue;
             }
             // Push new stack.
-            cursorStack.push(-1);
-            nbrsStack.push(&frontiers[level]->bwdEdges.at(nbr.first));
+            auto frontier = frontiers[level];
+            cursorStack.push(BwdEdgeCursor{
+                frontier, frontier->getFirstBwdEdgeIdx(nbr.first), Frontier::INVALID_EDGE_IDX});
             level--;
         } else { // Failed to find a nbr. Pop stack.
             cursorStack.pop();
-            nbrsStack.pop();
             level++;
         }
     }
@@ -113,13 +115,13 @@ void PathScanner::initDfs(const frontier::node_rel_id_t& nodeAndRelID, size_t cu
         return;
     }
     if (currentDepth == 0) {
-        cursorStack.top() = -1;
+        cursorStack.top().edgeIdx = Frontier::INVALID_EDGE_IDX;
         return;
     }
-    auto nbrs = &frontiers[currentDepth]->bwdEdges.at(nodeAndRelID.first);
-    nbrsStack.push(nbrs);
-    cursorStack.push(0);
-    initDfs(nbrs->at(0), currentDepth - 1);
+    auto frontier = frontiers[currentDepth];
+    auto firstEdgeIdx = frontier->getFirstBwdEdgeIdx(nodeAndRelID.first);
+    cursorStack.push(BwdEdgeCursor{frontier, firstEdgeIdx, firstEdgeIdx});
+    initDfs(frontier->getBwdEdge(firstEdgeIdx), currentDepth - 1);
 }
 
 static void writePathRels(RecursiveJoinVectors* vectors, sel_t pos, nodeID_t srcNodeID,
@@ -9,6 +9,12 @@ namespace processor {
 
 void PathPropertyProbe::initLocalStateInternal(ResultSet* /*resultSet_*/,
     ExecutionContext* /*context*/) {
+    if (sharedState->nodeHashTableState != nullptr) {
+        sharedState->nodeHashTableState->buildHashSlots();
+    }
+    if (sharedState->relHashTableState != nullptr) {
+        sharedState->relHashTableState->buildHashSlots();
+    }
     localState = std::make_unique<PathPropertyProbeLocalState>();
     vectors = std::make_unique<Vectors>();
     auto pathVector = resultSet->getValueVector(info->pathPos);
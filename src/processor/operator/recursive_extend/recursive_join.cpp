@@ -1,9 +1,12 @@
 #include "processor/operator/recursive_extend/recursive_join.h"
 
+#include "common/types/int128_t.h"
 #include "processor/operator/recursive_extend/all_shortest_path_state.h"
 #include "processor/operator/recursive_extend/scan_frontier.h"
 #include "processor/operator/recursive_extend/shortest_path_state.h"
 #include "processor/operator/recursive_extend/variable_length_state.h"
+#include "processor/operator/recursive_extend/weighted_shortest_path_state.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -11,6 +14,105 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+void RecursiveJoinSharedState::registerSourceScanner() {
+    std::unique_lock lck{mtx};
+    numSourceScanners++;
+}
+
+void RecursiveJoinSharedState::finishScanningSources() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numSourceScanners > 0);
+    numSourceScanners--;
+    cv.notify_all();
+}
+
+void RecursiveJoinSharedState::publishBFS(BFSSharedState& bfs) {
+    std::unique_lock lck{mtx};
+    publishedBFSs.push_back(PublishedBFS{&bfs, 0 /* numHelpers */});
+    bfs.setPublished(true);
+    cv.notify_all();
+}
+
+void RecursiveJoinSharedState::unpublishBFS(BFSSharedState& bfs) {
+    std::unique_lock lck{mtx};
+    auto isHelped = [&]() {
+        return std::any_of(publishedBFSs.begin(), publishedBFSs.end(),
+            [&](const PublishedBFS& published) {
+                return published.bfs == &bfs && published.numHelpers > 0;
+            });
+    };
+    cv.wait(lck, [&]() { return !isHelped(); });
+    std::erase_if(publishedBFSs,
+        [&](const PublishedBFS& published) { return published.bfs == &bfs; });
+    bfs.setPublished(false);
+    cv.notify_all();
+}
+
+BFSSharedState* RecursiveJoinSharedState::getBFSToHelp(BFSMorsel& morsel) {
+    std::unique_lock lck{mtx};
+    numIdleThreads++;
+    while (true) {
+        BFSSharedState* bfs = nullptr;
+        for (auto& published : publishedBFSs) {
+            if (published.bfs->hasMorsel()) {
+                published.numHelpers++;
+                bfs = published.bfs;
+                break;
+            }
+        }
+        if (bfs != nullptr) {
+            lck.unlock();
+            auto hasNewMorsels = false;
+            auto hasMorsel = bfs->getMorsel(morsel, hasNewMorsels);
+            if (hasNewMorsels) {
+                notifyWaitingThreads();
+            }
+            if (hasMorsel) {
+                numIdleThreads--;
+                return bfs;
+            }
+            // Other threads have taken the remaining morsels in the meantime.
+            releaseBFS(*bfs);
+            lck.lock();
+            continue;
+        }
+        if (numSourceScanners == 0 && publishedBFSs.empty()) {
+            numIdleThreads--;
+            return nullptr;
+        }
+        cv.wait(lck);
+    }
+}
+
+void RecursiveJoinSharedState::releaseBFS(BFSSharedState& bfs) {
+    std::unique_lock lck{mtx};
+    for (auto& published : publishedBFSs) {
+        if (published.bfs == &bfs) {
+            KU_ASSERT(published.numHelpers > 0);
+            published.numHelpers--;
+        }
+    }
+    cv.notify_all();
+}
+
+void RecursiveJoinSharedState::waitForMorsel(BFSSharedState& bfs) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&]() { return bfs.hasMorselOrIsFinished(); });
+}
+
+void RecursiveJoinSharedState::notifyWaitingThreads() {
+    // Waiting threads check their condition while holding the lock, so taking it here makes sure
+    // that the notification is not lost.
+    std::unique_lock lck{mtx};
+    cv.notify_all();
+}
+
+RecursiveJoin::~RecursiveJoin() {
+    if (isScanningSources) {
+        sharedState->finishScanningSources();
+    }
+}
+
 void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context) {
     auto& dataInfo = info.dataInfo;
     populateTargetDstNodes(context);
@@ -117,6 +219,33 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
             KU_UNREACHABLE;
         }
     } break;
+    case QueryRelType::WEIGHTED_SHORTEST: {
+        if (semantic != PathSemantic::WALK) {
+            throw RuntimeException("Different path semantics for weighted shortest path is not "
+                                   "implemented. Try WALK semantic.");
+        }
+        switch (joinType) {
+        case planner::RecursiveJoinType::TRACK_PATH: {
+            vectors->pathVector = resultSet->getValueVector(dataInfo.pathPos).get();
+            bfsState = std::make_unique<WeightedShortestPathState<true /* TRACK_PATH */>>(
+                upperBound, targetDstNodes.get());
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
+                    dataInfo.tableIDToName, nullptr, extendInBWD));
+            }
+        } break;
+        case planner::RecursiveJoinType::TRACK_NONE: {
+            bfsState = std::make_unique<WeightedShortestPathState<false /* TRACK_PATH */>>(
+                upperBound, targetDstNodes.get());
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(
+                    std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
+            }
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -157,7 +286,26 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
             StructVector::getFieldVector(pathRelsDataVector, pathRelsLabelFieldIdx).get();
     }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
+    if (bwdRecursiveRoot != nullptr) {
+        bidirectionalBFSState = std::make_unique<BidirectionalBFSState>();
+        bottomUpInfo = std::make_unique<BottomUpInfo>();
+        auto storageManager = context->clientContext->getStorageManager();
+        for (auto tableID : dataInfo.recursiveDstNodeTableIDs) {
+            auto nodeTable = ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
+                storageManager->getTable(tableID));
+            auto numNodes = nodeTable->getMaxNodeOffset(context->clientContext->getTx()) + 1;
+            bottomUpInfo->tableIDAndNumNodes.emplace_back(tableID, numNodes);
+            bottomUpInfo->numNodes += numNodes;
+        }
+    }
     initLocalRecursivePlan(context);
+    if (info.graphRelTableID != INVALID_TABLE_ID) {
+        initGraph(context);
+    }
+    if (!isScanningSources) {
+        isScanningSources = true;
+        sharedState->registerSourceScanner();
+    }
 }
 
 bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
@@ -180,6 +328,11 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
             return true;
         }
         if (!children[0]->getNextTuple(context)) {
+            if (isScanningSources) {
+                isScanningSources = false;
+                sharedState->finishScanningSources();
+            }
+            helpOtherBFSs(context);
             return false;
         }
         bfsState->resetState();
@@ -208,48 +361,308 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
         vectors->srcNodeIDVector->state->selVector->selectedPositions[0]);
     bfsState->markSrc(nodeID);
-    scanFrontier->setNodePredicateExecFlag(true);
-    while (!bfsState->isComplete()) {
-        auto boundNodeID = bfsState->getNextNodeID();
-        if (boundNodeID.offset != INVALID_OFFSET) {
-            // Found a starting node from current frontier.
-            scanFrontier->setNodeID(boundNodeID);
-            while (recursiveRoot->getNextTuple(context)) { // Exhaust recursive plan.
-                updateVisitedNodes(boundNodeID);
+    if (bidirectionalBFSState != nullptr && targetDstNodes->getNodeIDs().size() == 1) {
+        auto dstNodeID = *targetDstNodes->getNodeIDs().begin();
+        if (dstNodeID != nodeID) {
+            computeBidirectionalBFS(context, nodeID, dstNodeID);
+            return;
+        }
+    }
+    // The frontier is extended in morsels. Other threads extend morsels as well once the BFS is
+    // published, which only happens if some threads have run out of sources.
+    BFSSharedState bfs{bfsState.get(), bottomUpInfo.get()};
+    try {
+        BFSMorsel morsel;
+        while (true) {
+            if (!bfs.isPublished() && sharedState->hasIdleThreads()) {
+                sharedState->publishBFS(bfs);
+            }
+            auto hasNewMorsels = false;
+            if (bfs.getMorsel(morsel, hasNewMorsels)) {
+                if (hasNewMorsels) {
+                    sharedState->notifyWaitingThreads();
+                }
+                extendMorsel(context, bfs, morsel);
+                continue;
+            }
+            if (bfs.isFinished()) {
+                break;
+            }
+            sharedState->waitForMorsel(bfs);
+        }
+    } catch (...) {
+        // Other threads may still be extending morsels of the BFS.
+        if (bfs.isPublished()) {
+            sharedState->waitForMorsel(bfs);
+            sharedState->unpublishBFS(bfs);
+        }
+        throw;
+    }
+    if (bfs.isPublished()) {
+        sharedState->unpublishBFS(bfs);
+    }
+    if (bfs.isAborted()) {
+        throw RuntimeException("Recursive join failed to extend the frontier in another thread.");
+    }
+}
+
+void RecursiveJoin::helpOtherBFSs(ExecutionContext* context) {
+    BFSMorsel morsel;
+    while (auto bfs = sharedState->getBFSToHelp(morsel)) {
+        try {
+            extendMorsel(context, *bfs, morsel);
+        } catch (...) {
+            sharedState->releaseBFS(*bfs);
+            throw;
+        }
+        // The BFS may be destroyed as soon as it is released.
+        sharedState->releaseBFS(*bfs);
+    }
+}
+
+static double getWeight(const ValueVector& vector, sel_t pos) {
+    switch (vector.dataType.getLogicalTypeID()) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return vector.getValue<int64_t>(pos);
+    case LogicalTypeID::INT32:
+        return vector.getValue<int32_t>(pos);
+    case LogicalTypeID::INT16:
+        return vector.getValue<int16_t>(pos);
+    case LogicalTypeID::INT8:
+        return vector.getValue<int8_t>(pos);
+    case LogicalTypeID::UINT64:
+        return vector.getValue<uint64_t>(pos);
+    case LogicalTypeID::UINT32:
+        return vector.getValue<uint32_t>(pos);
+    case LogicalTypeID::UINT16:
+        return vector.getValue<uint16_t>(pos);
+    case LogicalTypeID::UINT8:
+        return vector.getValue<uint8_t>(pos);
+    case LogicalTypeID::INT128:
+        return Int128_t::Cast<double>(vector.getValue<int128_t>(pos));
+    case LogicalTypeID::DOUBLE:
+        return vector.getValue<double>(pos);
+    case LogicalTypeID::FLOAT:
+        return vector.getValue<float>(pos);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<typename FUNC>
+void RecursiveJoin::extendNode(ExecutionContext* context, nodeID_t nodeID, bool isSrc, bool isBwd,
+    FUNC func) {
+    if (graph != nullptr) {
+        auto& projection = graph->getProjection();
+        if (nodeID.tableID != projection.nodeTableID) {
+            return;
+        }
+        for (auto direction : isBwd ? bwdGraphDirections : graphDirections) {
+            auto nbrs = graph->getNbrs(nodeID.offset, direction);
+            auto rels = graph->getRels(nodeID.offset, direction);
+            for (auto i = 0u; i < nbrs.size(); ++i) {
+                // Positions are only used to read weights, which graphs do not have.
+                func(nodeID_t{nbrs[i], projection.nodeTableID},
+                    relID_t{rels[i], projection.relTableID}, 0 /* pos */);
+            }
+        }
+        return;
+    }
+    auto root = isBwd ? bwdRecursiveRoot.get() : recursiveRoot.get();
+    auto frontier = isBwd ? bwdScanFrontier : scanFrontier;
+    auto dstNodeIDVector =
+        isBwd ? vectors->bwdRecursiveDstNodeIDVector : vectors->recursiveDstNodeIDVector;
+    auto edgeIDVector = isBwd ? vectors->bwdRecursiveEdgeIDVector : vectors->recursiveEdgeIDVector;
+    // Node predicates are only executed on the source node.
+    frontier->setNodePredicateExecFlag(isSrc);
+    frontier->setNodeID(nodeID);
+    while (root->getNextTuple(context)) {
+        auto& selVector = *dstNodeIDVector->state->selVector;
+        for (auto i = 0u; i < selVector.selectedSize; ++i) {
+            auto pos = selVector.selectedPositions[i];
+            func(dstNodeIDVector->getValue<nodeID_t>(pos), edgeIDVector->getValue<relID_t>(pos),
+                pos);
+        }
+    }
+}
+
+void RecursiveJoin::extendMorsel(ExecutionContext* context, BFSSharedState& bfs,
+    const BFSMorsel& morsel) {
+    std::vector<FrontierEdge> edges;
+    try {
+        if (morsel.isBottomUp) {
+            for (auto nodeID : morsel.nodeIDs) {
+                auto numEdges = edges.size();
+                extendNode(context, nodeID, false /* isSrc */, true /* isBwd */,
+                    [&](nodeID_t nbrNodeID, relID_t relID, sel_t) {
+                        if (bfs.isFrontierNode(nbrNodeID)) {
+                            edges.push_back(FrontierEdge{nbrNodeID, nodeID, relID,
+                                bfs.getMultiplicity(nbrNodeID)});
+                        }
+                    });
+                // Apply the edges of each node in the order of the frontier, i.e., in the order in
+                // which a top down level finds them.
+                std::stable_sort(edges.begin() + numEdges, edges.end(),
+                    [](const FrontierEdge& a, const FrontierEdge& b) {
+                        return a.boundNodeID < b.boundNodeID;
+                    });
+            }
+        } else if (vectors->recursiveEdgeWeightVector != nullptr) {
+            auto& weightVector = *vectors->recursiveEdgeWeightVector;
+            for (auto boundNodeID : morsel.nodeIDs) {
+                extendNode(context, boundNodeID, morsel.level == 0, false /* isBwd */,
+                    [&](nodeID_t nbrNodeID, relID_t relID, sel_t pos) {
+                        // Rels without a weight are skipped.
+                        if (weightVector.isNull(pos)) {
+                            return;
+                        }
+                        auto weight = getWeight(weightVector, pos);
+                        if (!(weight >= 0)) {
+                            throw RuntimeException(
+                                stringFormat("Found weight {} in weighted shortest path. Weights "
+                                             "must be non-negative numbers.",
+                                    weight));
+                        }
+                        edges.push_back(FrontierEdge{boundNodeID, nbrNodeID, relID, 1, weight});
+                    });
+            }
+        } else {
+            for (auto boundNodeID : morsel.nodeIDs) {
+                auto boundNodeMultiplicity = bfs.getMultiplicity(boundNodeID);
+                extendNode(context, boundNodeID, morsel.level == 0, false /* isBwd */,
+                    [&](nodeID_t nbrNodeID, relID_t relID, sel_t) {
+                        edges.push_back(
+                            FrontierEdge{boundNodeID, nbrNodeID, relID, boundNodeMultiplicity});
+                    });
             }
+        }
+    } catch (...) {
+        if (bfs.abortMorsel(morsel)) {
+            sharedState->notifyWaitingThreads();
+        }
+        throw;
+    }
+    if (bfs.finishMorsel(morsel, std::move(edges))) {
+        sharedState->notifyWaitingThreads();
+    }
+}
+
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context, nodeID_t srcNodeID,
+    nodeID_t dstNodeID) {
+    auto& state = *bidirectionalBFSState;
+    state.resetState(srcNodeID, dstNodeID);
+    while (true) {
+        // Both searches have not met, so paths are longer than the upper bound, or do not exist.
+        if (state.getNumLevels() == info.upperBound || bfsState->getCurrentFrontierSize() == 0 ||
+            state.getBwdFrontier().empty()) {
+            return;
+        }
+        auto hasMet = false;
+        if (bfsState->getCurrentFrontierSize() <= state.getBwdFrontier().size()) {
+            extendFwdLevel(context, false /* isRestricted */);
+            hasMet = state.finalizeFwdLevel(bfsState->getCurrentFrontierNodeIDs());
         } else {
-            // Otherwise move to the next frontier.
-            bfsState->finalizeCurrentLevel();
-            scanFrontier->setNodePredicateExecFlag(false);
+            extendBwdLevel(context);
+            hasMet = state.finalizeBwdLevel();
+        }
+        if (hasMet) {
+            break;
+        }
+    }
+    state.meet();
+    while (!bfsState->isComplete()) {
+        extendFwdLevel(context, true /* isRestricted */);
+    }
+}
+
+void RecursiveJoin::extendFwdLevel(ExecutionContext* context, bool isRestricted) {
+    auto& state = *bidirectionalBFSState;
+    auto level = bfsState->getCurrentLevel();
+    for (auto boundNodeID : bfsState->getNextMorsel(bfsState->getCurrentFrontierSize())) {
+        if (isRestricted && bfsState->isComplete()) {
+            break;
         }
+        auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
+        extendNode(context, boundNodeID, level == 0, false /* isBwd */,
+            [&](nodeID_t nbrNodeID, relID_t relID, sel_t) {
+                if (!isRestricted || state.isOnShortestPath(nbrNodeID, level + 1)) {
+                    bfsState->markVisited(boundNodeID, nbrNodeID, relID, boundNodeMultiplicity);
+                }
+            });
     }
+    bfsState->finalizeCurrentLevel();
 }
 
-void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
-    auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
-    for (auto i = 0u; i < vectors->recursiveDstNodeIDVector->state->selVector->selectedSize; ++i) {
-        auto pos = vectors->recursiveDstNodeIDVector->state->selVector->selectedPositions[i];
-        auto nbrNodeID = vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(pos);
-        auto edgeID = vectors->recursiveEdgeIDVector->getValue<relID_t>(pos);
-        bfsState->markVisited(boundNodeID, nbrNodeID, edgeID, boundNodeMultiplicity);
+void RecursiveJoin::extendBwdLevel(ExecutionContext* context) {
+    auto& state = *bidirectionalBFSState;
+    auto isDst = state.getBwdLevel() == 0;
+    for (auto boundNodeID : state.getBwdFrontier()) {
+        extendNode(context, boundNodeID, isDst, true /* isBwd */,
+            [&](nodeID_t nbrNodeID, relID_t, sel_t) { state.markBwdVisited(nbrNodeID); });
     }
 }
 
-void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
-    auto op = recursiveRoot.get();
+static ScanFrontier* getScanFrontier(PhysicalOperator* root) {
+    auto op = root;
     while (!op->isSource()) {
         KU_ASSERT(op->getNumChildren() == 1);
         op = op->getChild(0);
     }
+    return (ScanFrontier*)op;
+}
+
+void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     auto& dataInfo = info.dataInfo;
-    scanFrontier = (ScanFrontier*)op;
+    scanFrontier = getScanFrontier(recursiveRoot.get());
     localResultSet = std::make_unique<ResultSet>(dataInfo.localResultSetDescriptor.get(),
         context->clientContext->getMemoryManager());
     vectors->recursiveDstNodeIDVector =
         localResultSet->getValueVector(dataInfo.recursiveDstNodeIDPos).get();
     vectors->recursiveEdgeIDVector =
         localResultSet->getValueVector(dataInfo.recursiveEdgeIDPos).get();
+    if (dataInfo.recursiveEdgeWeightPos.isValid()) {
+        vectors->recursiveEdgeWeightVector =
+            localResultSet->getValueVector(dataInfo.recursiveEdgeWeightPos).get();
+    }
     recursiveRoot->initLocalState(localResultSet.get(), context);
+    if (bwdRecursiveRoot == nullptr) {
+        return;
+    }
+    bwdScanFrontier = getScanFrontier(bwdRecursiveRoot.get());
+    bwdLocalResultSet = std::make_unique<ResultSet>(dataInfo.bwdLocalResultSetDescriptor.get(),
+        context->clientContext->getMemoryManager());
+    vectors->bwdRecursiveDstNodeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo.bwdRecursiveDstNodeIDPos).get();
+    vectors->bwdRecursiveEdgeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo.bwdRecursiveEdgeIDPos).get();
+    bwdRecursiveRoot->initLocalState(bwdLocalResultSet.get(), context);
+}
+
+void RecursiveJoin::initGraph(ExecutionContext* context) {
+    auto clientContext = context->clientContext;
+    auto transaction = clientContext->getTx();
+    // Snapshots only hold committed rels, which write transactions may not see as is.
+    if (!transaction->isReadOnly()) {
+        return;
+    }
+    graph = clientContext->getStorageManager()->getCSRGraphCache()->getUnfilteredGraph(
+        transaction, *clientContext->getCatalog(), info.graphRelTableID);
+    if (graph == nullptr) {
+        return;
+    }
+    graphDirections.clear();
+    bwdGraphDirections.clear();
+    if (info.direction == ExtendDirection::BOTH) {
+        graphDirections = {RelDataDirection::FWD, RelDataDirection::BWD};
+        bwdGraphDirections = graphDirections;
+    } else {
+        auto direction = ExtendDirectionUtils::getRelDataDirection(info.direction);
+        auto bwdDirection =
+            direction == RelDataDirection::FWD ? RelDataDirection::BWD : RelDataDirection::FWD;
+        graphDirections.push_back(direction);
+        bwdGraphDirections.push_back(bwdDirection);
+    }
 }
 
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext* context) {
@@ -12,6 +12,7 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
         auto vec = resultSet->getValueVector(pos).get();
         payloadVectors.push_back(vec);
         payloadAndMarkVectors.push_back(vec);
+        payloadDataChunkPoses.insert(pos.dataChunkPos);
     }
     if (info->accumulateType == AccumulateType::OPTIONAL_) {
         markVector = std::make_unique<ValueVector>(*LogicalType::BOOL(),
@@ -37,6 +38,28 @@ void ResultCollector::executeInternal(ExecutionContext* context) {
     }
 }
 
+std::unique_ptr<FactorizedTable> ResultCollector::collectNextTable(ExecutionContext* context,
+    uint64_t numFlatTuples, bool& hasMoreTuples) {
+    KU_ASSERT(info->accumulateType == AccumulateType::REGULAR);
+    auto table = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+        info->tableSchema->copy());
+    uint64_t numCollectedFlatTuples = 0;
+    while (numCollectedFlatTuples < numFlatTuples) {
+        if (!children[0]->getNextTuple(context)) {
+            hasMoreTuples = false;
+            return table;
+        }
+        if (!payloadVectors.empty()) {
+            for (auto i = 0u; i < resultSet->multiplicity; i++) {
+                table->append(payloadAndMarkVectors);
+            }
+            numCollectedFlatTuples += resultSet->getNumTuples(payloadDataChunkPoses);
+        }
+    }
+    hasMoreTuples = true;
+    return table;
+}
+
 void ResultCollector::finalize(ExecutionContext* /*context*/) {
     switch (info->accumulateType) {
     case AccumulateType::OPTIONAL_: {
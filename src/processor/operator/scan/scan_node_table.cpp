@@ -1,5 +1,7 @@
 #include "processor/operator/scan/scan_node_table.h"
 
+#include "storage/storage_utils.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -7,19 +9,114 @@ namespace processor {
 
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
-    readState = std::make_unique<storage::NodeTableReadState>(info->columnIDs);
-    ScanTable::initVectors(*readState, *resultSet);
+    std::vector<bool> isKeyColumn(info->columnIDs.size(), false);
+    std::vector<column_id_t> keyColumnIDs;
+    std::vector<ValueVector*> keyVectors;
+    for (auto& keyFilter : info->keyFilters) {
+        // Filters of hash joins whose build side is spilled or too large are disabled.
+        if (!keyFilter.filter->isEnabled() || isKeyColumn[keyFilter.columnIdx]) {
+            continue;
+        }
+        isKeyColumn[keyFilter.columnIdx] = true;
+        keyFilters.push_back(keyFilter.filter);
+        keyColumnIDs.push_back(info->columnIDs[keyFilter.columnIdx]);
+        keyVectors.push_back(resultSet->getValueVector(outVectorsPos[keyFilter.columnIdx]).get());
+    }
+    std::vector<column_id_t> columnIDs;
+    std::vector<ValueVector*> vectors;
+    for (auto i = 0u; i < info->columnIDs.size(); i++) {
+        if (!isKeyColumn[i]) {
+            columnIDs.push_back(info->columnIDs[i]);
+            vectors.push_back(resultSet->getValueVector(outVectorsPos[i]).get());
+        }
+    }
+    readState = std::make_unique<storage::NodeTableReadState>(std::move(columnIDs));
+    readState->nodeIDVector = nodeIDVector;
+    readState->outputVectors = std::move(vectors);
+    if (!info->zoneMapFilters.empty()) {
+        std::vector<column_id_t> filterColumnIDs;
+        for (auto& filter : info->zoneMapFilters) {
+            filterColumnIDs.push_back(filter.columnID);
+        }
+        filterReadState = std::make_unique<storage::NodeTableReadState>(std::move(filterColumnIDs));
+        filterReadState->nodeIDVector = nodeIDVector;
+    }
+    // Filtering the selection vector of the node IDs filters all output vectors.
+    KU_ASSERT(!filtersSelVector() || outState == nodeIDVector->state.get());
+    if (!keyFilters.empty()) {
+        keyReadState = std::make_unique<storage::NodeTableReadState>(std::move(keyColumnIDs));
+        keyReadState->nodeIDVector = nodeIDVector;
+        keyReadState->outputVectors = std::move(keyVectors);
+        hashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64,
+            context->clientContext->getMemoryManager());
+    }
 }
 
 bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
+    auto transaction = context->clientContext->getTx();
+    while (true) {
+        if (filtersSelVector()) {
+            restoreSelVector(nodeIDVector->state->selVector);
+        }
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        if (canSkipByZoneMaps(transaction)) {
+            continue;
+        }
+        if (!filtersSelVector()) {
+            break;
+        }
+        saveSelVector(nodeIDVector->state->selVector);
+        if (filterByCompressedValues(transaction) &&
+            (keyFilters.empty() || readAndFilterKeys(transaction))) {
+            break;
+        }
+    }
+    if (readState->columnIDs.empty()) {
+        return true;
     }
     for (auto& vector : readState->outputVectors) {
         vector->resetAuxiliaryBuffer();
     }
-    info->table->initializeReadState(context->clientContext->getTx(), info->columnIDs, *readState);
-    info->table->read(context->clientContext->getTx(), *readState);
+    info->table->initializeReadState(transaction, readState->columnIDs, *readState);
+    info->table->read(transaction, *readState);
+    return true;
+}
+
+bool ScanNodeTable::canSkipByZoneMaps(transaction::Transaction* transaction) {
+    // Node IDs which are not sequential may come from multiple node groups.
+    if (info->zoneMapFilters.empty() || !nodeIDVector->isSequential()) {
+        return false;
+    }
+    auto nodeGroupIdx = storage::StorageUtils::getNodeGroupIdx(nodeIDVector->readNodeOffset(0));
+    if (nodeGroupIdx != zoneMapNodeGroupIdx) {
+        zoneMapNodeGroupIdx = nodeGroupIdx;
+        skipNodeGroup = !info->table->mayMatch(transaction, nodeGroupIdx, info->zoneMapFilters);
+    }
+    return skipNodeGroup;
+}
+
+bool ScanNodeTable::filterByCompressedValues(transaction::Transaction* transaction) {
+    if (filterReadState == nullptr) {
+        return true;
+    }
+    info->table->initializeReadState(transaction, filterReadState->columnIDs, *filterReadState);
+    return info->table->filter(transaction, *filterReadState, info->zoneMapFilters);
+}
+
+bool ScanNodeTable::readAndFilterKeys(transaction::Transaction* transaction) {
+    for (auto& vector : keyReadState->outputVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    info->table->initializeReadState(transaction, keyReadState->columnIDs, *keyReadState);
+    info->table->read(transaction, *keyReadState);
+    auto& selVector = *nodeIDVector->state->selVector;
+    for (auto i = 0u; i < keyFilters.size(); i++) {
+        if (keyFilters[i]->select(*keyReadState->outputVectors[i], *hashVector, selVector) == 0) {
+            return false;
+        }
+    }
     return true;
 }
 
@@ -31,6 +31,19 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     return resultCollector->getResultFactorizedTable();
 }
 
+std::unique_ptr<ResultStream> QueryProcessor::executeStreaming(PhysicalPlan* physicalPlan,
+    ExecutionContext* context) {
+    auto lastOperator = physicalPlan->lastOperator.get();
+    auto resultCollector = ku_dynamic_cast<PhysicalOperator*, ResultCollector*>(lastOperator);
+    auto task = std::make_shared<ProcessorTask>(resultCollector, context);
+    decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
+    initTask(task.get());
+    for (auto& childTask : task->children) {
+        taskScheduler->scheduleTaskAndWaitOrError(childTask, context);
+    }
+    return std::make_unique<ResultStream>(resultCollector, context);
+}
+
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     ExecutionContext* context) {
     if (op->isSource()) {
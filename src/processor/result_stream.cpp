@@ -0,0 +1,24 @@
+#include "processor/result_stream.h"
+
+#include "processor/processor_task.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+ResultStream::ResultStream(ResultCollector* resultCollector, ExecutionContext* context)
+    : resultCollector{resultCollector}, context{context}, hasMoreTuples{true} {
+    resultCollector->initGlobalState(context);
+    resultSet = ProcessorTask::populateResultSet(resultCollector,
+        context->clientContext->getMemoryManager());
+    resultCollector->initLocalState(resultSet.get(), context);
+}
+
+std::unique_ptr<FactorizedTable> ResultStream::getNextTable() {
+    KU_ASSERT(hasMoreTuples);
+    return resultCollector->collectNextTable(context, DEFAULT_VECTOR_CAPACITY, hasMoreTuples);
+}
+
+} // namespace processor
+} // namespace kuzu
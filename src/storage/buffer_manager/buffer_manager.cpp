@@ -17,56 +17,112 @@ using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
+EvictionQueue::EvictionQueue() : nextShardToDequeue{0} {
+    for (auto& numCandidatesInTier : numCandidates) {
+        numCandidatesInTier = 0;
+    }
+}
+
+void EvictionQueue::enqueue(EvictionCandidate& candidate, EvictionTier tier, Shard& shard) {
+    std::vector<EvictionCandidate> candidatesToProtect;
+    {
+        std::scoped_lock lck{shard.mtx};
+        shard.candidates.push_back(candidate);
+        numCandidates[(uint8_t)tier]++;
+        if (++shard.numInsertions == BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL) {
+            shard.numInsertions = 0;
+            candidatesToProtect = removeNonEvictableCandidates(tier, shard);
+        }
+    }
+    // Shards are locked one at a time, so the candidates are moved after releasing the lock.
+    for (auto& candidateToProtect : candidatesToProtect) {
+        enqueue(candidateToProtect, EvictionTier::PROTECTED);
+    }
+}
+
+// Like 2Q, we evict from the PROBATION tier as long as it holds a reasonable share of the
+// candidates, so that pages which are accessed once, e.g., by a sequential scan, don't push the hot
+// pages out. Once the PROBATION tier becomes too small, pages of the PROTECTED tier are evicted
+// instead, so that newly read pages stay cached long enough to be accessed again.
+bool EvictionQueue::dequeue(EvictionCandidate& candidate) {
+    auto numProbationCandidates = numCandidates[(uint8_t)EvictionTier::PROBATION].load();
+    auto numProtectedCandidates = numCandidates[(uint8_t)EvictionTier::PROTECTED].load();
+    auto preferProbation = numProbationCandidates *
+                               BufferPoolConstants::EVICTION_QUEUE_MIN_PROBATION_RATIO >=
+                           numProbationCandidates + numProtectedCandidates;
+    auto firstTier = preferProbation ? EvictionTier::PROBATION : EvictionTier::PROTECTED;
+    auto secondTier = preferProbation ? EvictionTier::PROTECTED : EvictionTier::PROBATION;
+    return dequeue(firstTier, candidate) || dequeue(secondTier, candidate);
+}
+
+bool EvictionQueue::dequeue(EvictionTier tier, EvictionCandidate& candidate) {
+    auto startShardIdx = nextShardToDequeue.fetch_add(1);
+    for (auto i = 0u; i < NUM_SHARDS; i++) {
+        auto& shard = shards[(uint8_t)tier][(startShardIdx + i) % NUM_SHARDS];
+        std::scoped_lock lck{shard.mtx};
+        if (!shard.candidates.empty()) {
+            candidate = shard.candidates.front();
+            shard.candidates.pop_front();
+            numCandidates[(uint8_t)tier]--;
+            return true;
+        }
+    }
+    return false;
+}
+
 // In this function, we try to remove as many as possible candidates that are not evictable from the
-// eviction queue until we hit a candidate that is evictable.
+// front of the shard until we hit a candidate that is evictable.
 // 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
-// remove the candidate from the queue.
+// remove the candidate from the shard.
 // 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
 // the page was optimistically read, we give a second chance to evict the page by marking the page
-// as MARKED, and moving the candidate to the back of the queue.
-// 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
-void EvictionQueue::removeNonEvictableCandidates() {
-    std::shared_lock sLck{mtx};
-    while (true) {
-        EvictionCandidate evictionCandidate;
-        if (!queue->try_dequeue(evictionCandidate)) {
-            break;
-        }
+// as MARKED, and moving the candidate to the back of the PROTECTED tier.
+// 3) If the candidate page's state is LOCKED, we remove the candidate from the shard.
+// The caller must hold the lock of the shard.
+std::vector<EvictionCandidate> EvictionQueue::removeNonEvictableCandidates(EvictionTier tier,
+    Shard& shard) {
+    std::vector<EvictionCandidate> candidatesToProtect;
+    while (!shard.candidates.empty()) {
+        auto evictionCandidate = shard.candidates.front();
         auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
         if (evictionCandidate.isEvictable(pageStateAndVersion)) {
-            queue->enqueue(evictionCandidate);
             break;
-        } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
+        }
+        shard.candidates.pop_front();
+        numCandidates[(uint8_t)tier]--;
+        if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
             // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
             evictionCandidate.pageState->tryMark(pageStateAndVersion);
-            queue->enqueue(evictionCandidate);
-            continue;
-        } else {
-            // Cases to remove the candidate from the queue:
-            // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
-            // the queue.
-            // 2) The page's version number has changed (it was pinned and unpinned), another
-            // candidate exists for this page in the queue. remove the candidate from the queue.
-            continue;
+            if (tier == EvictionTier::PROTECTED) {
+                shard.candidates.push_back(evictionCandidate);
+                numCandidates[(uint8_t)tier]++;
+            } else {
+                candidatesToProtect.push_back(evictionCandidate);
+            }
         }
+        // Otherwise, the candidate is removed from the shard:
+        // 1) The page is currently LOCKED (it is currently pinned).
+        // 2) The page's version number has changed (it was pinned and unpinned), another
+        // candidate exists for this page in the queue.
     }
+    return candidatesToProtect;
 }
 
 void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
-    std::unique_lock xLck{mtx};
-    EvictionCandidate candidate;
-    uint64_t loopedCandidateIdx = 0;
-    auto numCandidatesInQueue = queue->size();
-    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
-        if (candidate.fileHandle != &fileHandle) {
-            queue->enqueue(candidate);
+    for (auto tier : {EvictionTier::PROBATION, EvictionTier::PROTECTED}) {
+        for (auto& shard : shards[(uint8_t)tier]) {
+            std::scoped_lock lck{shard.mtx};
+            auto numCandidatesBefore = shard.candidates.size();
+            std::erase_if(shard.candidates, [&](const EvictionCandidate& candidate) {
+                return candidate.fileHandle == &fileHandle;
+            });
+            numCandidates[(uint8_t)tier] -= numCandidatesBefore - shard.candidates.size();
         }
-        loopedCandidateIdx++;
     }
 }
 
 BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
-    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0} {
+    : usedMemory{0}, bufferPoolSize{bufferPoolSize} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize);
@@ -186,7 +242,7 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PagePriority pagePriority) {
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
@@ -205,6 +261,16 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
             }
         } break;
         case PageState::MARKED: {
+            if (pagePriority == PagePriority::LOW) {
+                // Low priority reads don't give the page a second chance. The page is read without
+                // clearing the mark, and the read is retried if the page was evicted meanwhile.
+                if (try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
+                        fileHandle.getPageSizeClass()) &&
+                    pageState->getStateAndVersion() == currStateAndVersion) {
+                    return;
+                }
+                continue;
+            }
             // If the page is marked, we try to switch to unlocked. If we succeed, we read the page.
             if (pageState->tryClearMark(currStateAndVersion)) {
                 if (try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
@@ -215,7 +281,7 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
         } break;
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
-            unpin(fileHandle, pageIdx);
+            unpin(fileHandle, pageIdx, pagePriority);
         } break;
         default: {
             // When locked, continue the spinning.
@@ -225,10 +291,79 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
     }
 }
 
-void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
+void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx,
+    PagePriority pagePriority) {
     auto pageState = fileHandle.getPageState(pageIdx);
+    // The version of a page is reset when it is evicted and incremented by every unpin, so a
+    // non-zero version means that the page was pinned again while it was cached.
+    auto wasCached = PageState::getVersion(pageState->getStateAndVersion()) > 0;
+    auto tier = pagePriority == PagePriority::NORMAL && wasCached ? EvictionTier::PROTECTED :
+                                                                    EvictionTier::PROBATION;
     pageState->unlock();
-    addToEvictionQueue(&fileHandle, pageIdx, pageState);
+    addToEvictionQueue(&fileHandle, pageIdx, pageState, tier);
+}
+
+page_idx_t BufferManager::prefetchPages(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    auto endPageIdx = std::min<page_idx_t>(startPageIdx + numPages, fileHandle.getNumPages());
+    page_idx_t numPagesRead = 0;
+    // Pages are locked and given frames one by one, and read once the run of pages with
+    // consecutive frames ends.
+    auto runStartPageIdx = startPageIdx;
+    page_idx_t runLength = 0;
+    auto finishRun = [&]() {
+        cachePagesIntoFrames(fileHandle, runStartPageIdx, runLength);
+        numPagesRead += runLength;
+        runLength = 0;
+    };
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        auto pageState = fileHandle.getPageState(pageIdx);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        // Pages which are already in frames, or being loaded by other threads, are skipped.
+        if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+            !pageState->tryLock(currStateAndVersion)) {
+            finishRun();
+            continue;
+        }
+        if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+            pageState->resetToEvicted();
+            break;
+        }
+        if (runLength > 0 && getFrame(fileHandle, pageIdx) !=
+                                 getFrame(fileHandle, runStartPageIdx) +
+                                     (uint64_t)runLength * fileHandle.getPageSize()) {
+            finishRun();
+        }
+        if (runLength == 0) {
+            runStartPageIdx = pageIdx;
+        }
+        runLength++;
+    }
+    finishRun();
+    return numPagesRead;
+}
+
+void BufferManager::cachePagesIntoFrames(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    if (numPages == 0) {
+        return;
+    }
+    auto pageSize = fileHandle.getPageSize();
+    try {
+        fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, startPageIdx),
+            (uint64_t)numPages * pageSize, (uint64_t)startPageIdx * pageSize);
+    } catch (...) {
+        // Give the frames back, so that the pages can be pinned (and read) again.
+        for (auto pageIdx = startPageIdx; pageIdx < startPageIdx + numPages; pageIdx++) {
+            releaseFrameForPage(fileHandle, pageIdx);
+            freeUsedMemory(pageSize);
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+        }
+        throw;
+    }
+    for (auto pageIdx = startPageIdx; pageIdx < startPageIdx + numPages; pageIdx++) {
+        unpin(fileHandle, pageIdx);
+    }
 }
 
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
@@ -256,8 +391,9 @@ bool BufferManager::claimAFrame(BMFileHandle& fileHandle, page_idx_t pageIdx,
         auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
         if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
             if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
+                // The page was read again since it was enqueued, so it is protected from now on.
                 evictionCandidate.pageState->tryMark(pageStateAndVersion);
-                evictionQueue->enqueue(evictionCandidate);
+                evictionQueue->enqueue(evictionCandidate, EvictionTier::PROTECTED);
             }
             continue;
         }
@@ -279,15 +415,11 @@ bool BufferManager::claimAFrame(BMFileHandle& fileHandle, page_idx_t pageIdx,
 }
 
 void BufferManager::addToEvictionQueue(BMFileHandle* fileHandle, page_idx_t pageIdx,
-    PageState* pageState) {
+    PageState* pageState, EvictionTier tier) {
     auto currStateAndVersion = pageState->getStateAndVersion();
-    if (++numEvictionQueueInsertions == BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL) {
-        evictionQueue->removeNonEvictableCandidates();
-        numEvictionQueueInsertions = 0;
-    }
     pageState->tryMark(currStateAndVersion);
     evictionQueue->enqueue(fileHandle, pageIdx, pageState,
-        PageState::getVersion(currStateAndVersion));
+        PageState::getVersion(currStateAndVersion), tier);
 }
 
 uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
@@ -350,7 +482,9 @@ void BufferManager::removePageFromFrameIfNecessary(BMFileHandle& fileHandle, pag
     if (pageIdx >= fileHandle.getNumPages()) {
         return;
     }
-    removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
+    // Pages of committed transactions whose checkpoint has been deferred are only written back
+    // from their frames.
+    removePageFromFrame(fileHandle, pageIdx, true /* flush */);
 }
 
 // NOTE: We assume the page is not pinned (locked) here.
@@ -0,0 +1,166 @@
+#include "storage/compression/bitpacking_simd.h"
+
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace kuzu {
+namespace storage {
+
+#ifdef KUZU_X86_SIMD
+// Value i of a chunk is made of the bits [i * bitWidth, (i + 1) * bitWidth) of the chunk. Each
+// kernel below unpacks a batch of values starting at a byte boundary: the 32-bit word holding the
+// first bit of each value is moved into its lane, shifted right, and combined with the following
+// word, shifted left, for values which span two words. Bit widths are at most 32, so a batch of 8
+// (AVX2) or 16 (AVX-512) values fits into one register. If a value ends within its first word,
+// the bits of the following word are shifted beyond the mask (or out of the lane if the value
+// starts at a word boundary), so the following word may be any word.
+
+template<typename U>
+__attribute__((target("avx2"))) static inline void storeAVX2(__m256i values, U* out) {
+    if constexpr (std::is_same_v<U, uint32_t>) {
+        _mm256_storeu_si256((__m256i*)out, values);
+    } else {
+        _mm256_storeu_si256((__m256i*)out, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values)));
+        _mm256_storeu_si256((__m256i*)(out + 4),
+            _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1)));
+    }
+}
+
+// Loads min(numBytes, 32) bytes from src without reading past src + numBytes.
+__attribute__((target("avx2"))) static inline __m256i loadAVX2(const uint8_t* src,
+    uint64_t numBytes) {
+    if (numBytes >= sizeof(__m256i)) {
+        return _mm256_loadu_si256((const __m256i*)src);
+    }
+    // Masked out words are not read.
+    auto wordPositions = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    auto numWords = _mm256_set1_epi32(numBytes / 4);
+    auto words =
+        _mm256_maskload_epi32((const int*)src, _mm256_cmpgt_epi32(numWords, wordPositions));
+    if (numBytes % 4 == 0) {
+        return words;
+    }
+    uint32_t lastWord = 0;
+    auto lastWordStart = src + numBytes / 4 * 4;
+    for (auto i = 0u; i < numBytes % 4; i++) {
+        lastWord |= (uint32_t)lastWordStart[i] << (i * 8);
+    }
+    return _mm256_or_si256(words, _mm256_and_si256(_mm256_set1_epi32(lastWord),
+                                      _mm256_cmpeq_epi32(numWords, wordPositions)));
+}
+
+template<typename U>
+__attribute__((target("avx2"))) static void unpackAVX2(const uint8_t* in, U* out,
+    uint8_t bitWidth) {
+    static constexpr uint64_t BATCH_SIZE = 8;
+    auto bitOffsets =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(bitWidth));
+    auto wordIdxes = _mm256_srli_epi32(bitOffsets, 5);
+    auto nextWordIdxes = _mm256_add_epi32(wordIdxes, _mm256_set1_epi32(1));
+    auto shifts = _mm256_and_si256(bitOffsets, _mm256_set1_epi32(31));
+    auto nextShifts = _mm256_sub_epi32(_mm256_set1_epi32(32), shifts);
+    auto mask = _mm256_set1_epi32(bitWidth == 32 ? -1 : (int32_t)((1u << bitWidth) - 1));
+    auto bytesPerBatch = (uint64_t)bitWidth * BATCH_SIZE / 8;
+    auto bytesPerChunk = bytesPerBatch * (BitpackingSIMD::CHUNK_SIZE / BATCH_SIZE);
+    for (auto i = 0u; i < BitpackingSIMD::CHUNK_SIZE; i += BATCH_SIZE) {
+        auto startByte = i / BATCH_SIZE * bytesPerBatch;
+        auto words = loadAVX2(in + startByte, bytesPerChunk - startByte);
+        auto values = _mm256_or_si256(
+            _mm256_srlv_epi32(_mm256_permutevar8x32_epi32(words, wordIdxes), shifts),
+            _mm256_sllv_epi32(_mm256_permutevar8x32_epi32(words, nextWordIdxes), nextShifts));
+        storeAVX2(_mm256_and_si256(values, mask), out + i);
+    }
+}
+
+template<typename U>
+__attribute__((target("avx512f,avx512bw"))) static inline void storeAVX512(__m512i values,
+    U* out) {
+    if constexpr (std::is_same_v<U, uint32_t>) {
+        _mm512_storeu_si512(out, values);
+    } else {
+        _mm512_storeu_si512(out, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(values)));
+        _mm512_storeu_si512(out + 8, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(values, 1)));
+    }
+}
+
+template<typename U>
+__attribute__((target("avx512f,avx512bw"))) static void unpackAVX512(const uint8_t* in, U* out,
+    uint8_t bitWidth) {
+    static constexpr uint64_t BATCH_SIZE = 16;
+    auto bitOffsets = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm512_set1_epi32(bitWidth));
+    auto wordIdxes = _mm512_srli_epi32(bitOffsets, 5);
+    auto nextWordIdxes = _mm512_add_epi32(wordIdxes, _mm512_set1_epi32(1));
+    auto shifts = _mm512_and_si512(bitOffsets, _mm512_set1_epi32(31));
+    auto nextShifts = _mm512_sub_epi32(_mm512_set1_epi32(32), shifts);
+    auto mask = _mm512_set1_epi32(bitWidth == 32 ? -1 : (int32_t)((1u << bitWidth) - 1));
+    auto bytesPerBatch = (uint64_t)bitWidth * BATCH_SIZE / 8;
+    // Masked out bytes are not read, so loads never read past the end of the chunk.
+    auto loadMask = bytesPerBatch == 64 ? ~(__mmask64)0 : ((__mmask64)1 << bytesPerBatch) - 1;
+    for (auto i = 0u; i < BitpackingSIMD::CHUNK_SIZE; i += BATCH_SIZE) {
+        auto words = _mm512_maskz_loadu_epi8(loadMask, in + i / BATCH_SIZE * bytesPerBatch);
+        auto values = _mm512_or_si512(
+            _mm512_srlv_epi32(_mm512_permutexvar_epi32(wordIdxes, words), shifts),
+            _mm512_sllv_epi32(_mm512_permutexvar_epi32(nextWordIdxes, words), nextShifts));
+        storeAVX512(_mm512_and_si512(values, mask), out + i);
+    }
+}
+#endif
+
+namespace {
+
+struct UnpackKernels {
+    void (*unpack32)(const uint8_t*, uint32_t*, uint8_t) = nullptr;
+    void (*unpack64)(const uint8_t*, uint64_t*, uint8_t) = nullptr;
+    // Narrower chunks are smaller than a register, so most AVX2 loads of them have to be masked,
+    // which makes the kernel slower than the scalar one.
+    uint8_t minBitWidth = 1;
+
+    static UnpackKernels select() {
+#ifdef KUZU_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+            return UnpackKernels{unpackAVX512<uint32_t>, unpackAVX512<uint64_t>};
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return UnpackKernels{unpackAVX2<uint32_t>, unpackAVX2<uint64_t>, 16};
+        }
+#endif
+        return UnpackKernels{};
+    }
+};
+
+const UnpackKernels kernels = UnpackKernels::select();
+
+bool useKernel(uint8_t bitWidth) {
+    // Values of 16 and 32 bits are aligned to 16-bit words, which the scalar kernel copies (or
+    // splits) directly.
+    return bitWidth >= kernels.minBitWidth && bitWidth < 32 && bitWidth != 16;
+}
+
+} // namespace
+
+bool BitpackingSIMD::unpack(const uint8_t* in, uint32_t* out, uint8_t bitWidth) {
+    if (kernels.unpack32 == nullptr || !useKernel(bitWidth)) {
+        return false;
+    }
+    kernels.unpack32(in, out, bitWidth);
+    return true;
+}
+
+bool BitpackingSIMD::unpack(const uint8_t* in, uint64_t* out, uint8_t bitWidth) {
+    if (kernels.unpack64 == nullptr || !useKernel(bitWidth)) {
+        return false;
+    }
+    kernels.unpack64(in, out, bitWidth);
+    return true;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "storage/compression/compression.h"
 
+#include <cmath>
+#include <functional>
 #include <limits>
 #include <string>
 
@@ -11,8 +13,10 @@
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "fastpfor/bitpackinghelpers.h"
+#include "storage/compression/bitpacking_simd.h"
 #include "storage/compression/sign_extend.h"
 #include "storage/store/column.h"
+#include "storage/store/zone_map.h"
 #include <bit>
 
 using namespace kuzu::common;
@@ -55,7 +59,8 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::ALP: {
         return false;
     }
     default: {
@@ -142,6 +147,24 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos,
         }
         }
     }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            auto value = reinterpret_cast<const double*>(data)[pos];
+            return FloatCompression<double>::canUpdateInPlace(value, *this);
+        }
+        case PhysicalTypeID::FLOAT: {
+            auto value = reinterpret_cast<const float*>(data)[pos];
+            return FloatCompression<float>::canUpdateInPlace(value, *this);
+        }
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP but does not have a "
+                "supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -190,6 +213,20 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
         }
         }
     }
+    case CompressionType::ALP: {
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, *this);
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, *this);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP but does not have a "
+                "supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
@@ -278,6 +315,11 @@ std::string CompressionMetadata::toString() const {
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::ALP: {
+        auto header = BitpackHeader::readHeader(data);
+        return "ALP[" + std::to_string(FloatCompression<double>::getExponent(*this)) + "," +
+               std::to_string(header.bitWidth) + "]";
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -373,6 +415,9 @@ template<typename T>
 void fastunpack(const uint8_t* in, T* out, uint32_t bitWidth) {
     if constexpr (std::is_same_v<std::make_signed_t<T>, int32_t> ||
                   std::is_same_v<std::make_signed_t<T>, int64_t>) {
+        if (BitpackingSIMD::unpack(in, (std::make_unsigned_t<T>*)out, bitWidth)) {
+            return;
+        }
         FastPForLib::fastunpack((const uint32_t*)in, out, bitWidth);
     } else if constexpr (std::is_same_v<std::make_signed_t<T>, int16_t>) {
         FastPForLib::fastunpack((const uint16_t*)in, out, bitWidth);
@@ -561,6 +606,99 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
     }
 }
 
+template<typename T, typename OP>
+static void evaluateComparison(const T* values, uint64_t numValues, T literal, uint8_t* result,
+    OP op) {
+    for (auto i = 0u; i < numValues; i++) {
+        result[i] = op(values[i], literal);
+    }
+}
+
+// Writes the result of `value <comparison> literal` for each of the numValues values to result.
+template<typename T>
+static void evaluateComparison(ExpressionType comparison, const T* values, uint64_t numValues,
+    T literal, uint8_t* result) {
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+        return evaluateComparison(values, numValues, literal, result, std::equal_to<T>());
+    case ExpressionType::NOT_EQUALS:
+        return evaluateComparison(values, numValues, literal, result, std::not_equal_to<T>());
+    case ExpressionType::GREATER_THAN:
+        return evaluateComparison(values, numValues, literal, result, std::greater<T>());
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return evaluateComparison(values, numValues, literal, result, std::greater_equal<T>());
+    case ExpressionType::LESS_THAN:
+        return evaluateComparison(values, numValues, literal, result, std::less<T>());
+    case ExpressionType::LESS_THAN_EQUALS:
+        return evaluateComparison(values, numValues, literal, result, std::less_equal<T>());
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+// Writes the result of `value <comparison> literal` for numValues values which are all greater
+// than the literal if isLiteralBelowValues, and all smaller than it otherwise.
+static void evaluateComparison(ExpressionType comparison, bool isLiteralBelowValues,
+    uint64_t numValues, uint8_t* result) {
+    bool satisfied = false;
+    switch (comparison) {
+    case ExpressionType::EQUALS: {
+        satisfied = false;
+    } break;
+    case ExpressionType::NOT_EQUALS: {
+        satisfied = true;
+    } break;
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        satisfied = isLiteralBelowValues;
+    } break;
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS: {
+        satisfied = !isLiteralBelowValues;
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    memset(result, satisfied, numValues);
+}
+
+template<typename T>
+void IntegerBitpacking<T>::filterFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* result, uint64_t numValues, const CompressionMetadata& metadata,
+    ExpressionType comparison, T literal) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    if (header.hasNegative || header.bitWidth == 0) {
+        T values[CHUNK_SIZE];
+        for (auto i = 0u; i < numValues; i += CHUNK_SIZE) {
+            auto numValuesInBatch = std::min(CHUNK_SIZE, numValues - i);
+            decompressFromPage(srcBuffer, srcOffset + i, (uint8_t*)values, 0 /*dstOffset*/,
+                numValuesInBatch, metadata);
+            evaluateComparison(comparison, values, numValuesInBatch, literal, result + i);
+        }
+        return;
+    }
+    // Values are stored as value - offset, which is in [0, 2^bitWidth).
+    if (literal < (T)header.offset) {
+        return evaluateComparison(comparison, true /*isLiteralBelowValues*/, numValues, result);
+    }
+    auto packedLiteral = (U)((U)literal - (U)header.offset);
+    if (packedLiteral > (U)(((U)1 << header.bitWidth) - 1)) {
+        return evaluateComparison(comparison, false /*isLiteralBelowValues*/, numValues, result);
+    }
+    auto srcCursor = getChunkStart(srcBuffer, srcOffset, header.bitWidth);
+    auto bytesPerChunk = CHUNK_SIZE / 8 * header.bitWidth;
+    auto posInChunk = srcOffset % CHUNK_SIZE;
+    U chunk[CHUNK_SIZE];
+    for (auto i = 0u; i < numValues; srcCursor += bytesPerChunk) {
+        fastunpack(srcCursor, chunk, header.bitWidth);
+        auto numValuesInChunk = std::min(CHUNK_SIZE - posInChunk, numValues - i);
+        evaluateComparison(comparison, chunk + posInChunk, numValuesInChunk, packedLiteral,
+            result + i);
+        i += numValuesInChunk;
+        posInChunk = 0;
+    }
+}
+
 template class IntegerBitpacking<int8_t>;
 template class IntegerBitpacking<int16_t>;
 template class IntegerBitpacking<int32_t>;
@@ -570,6 +708,139 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+static constexpr double POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+// Integers with larger magnitudes cannot all be represented by doubles.
+static constexpr double MAX_ENCODED_VALUE = (double)((int64_t)1 << 52);
+
+template<typename T>
+std::optional<int64_t> FloatCompression<T>::encode(T value, uint8_t exponent) {
+    auto scaled = (double)value * POW10[exponent];
+    // Also fails for NaN.
+    if (!(std::abs(scaled) < MAX_ENCODED_VALUE)) {
+        return std::nullopt;
+    }
+    auto encoded = (int64_t)std::llround(scaled);
+    // Compare bits, so that e.g. -0.0 is not restored as 0.0.
+    auto decoded = decode(encoded, exponent);
+    if (std::memcmp(&decoded, &value, sizeof(T)) != 0) {
+        return std::nullopt;
+    }
+    return encoded;
+}
+
+template<typename T>
+T FloatCompression<T>::decode(int64_t value, uint8_t exponent) {
+    return (T)((double)value / POW10[exponent]);
+}
+
+template<typename T>
+CompressionMetadata FloatCompression<T>::getCompressionMetadata(const uint8_t* srcBuffer,
+    uint64_t numValues) const {
+    auto values = (const T*)srcBuffer;
+    auto encoded = std::make_unique<int64_t[]>(numValues);
+    for (uint8_t exponent = 0; exponent <= MAX_EXPONENT; exponent++) {
+        auto canEncode = true;
+        for (auto i = 0u; i < numValues; i++) {
+            auto encodedValue = encode(values[i], exponent);
+            if (!encodedValue.has_value()) {
+                canEncode = false;
+                break;
+            }
+            encoded[i] = *encodedValue;
+        }
+        if (!canEncode) {
+            continue;
+        }
+        auto header = IntegerBitpacking<int64_t>().getBitWidth((const uint8_t*)encoded.get(),
+            numValues);
+        // Use uncompressed if the encoding does not save any space
+        if (header.bitWidth >= sizeof(T) * 8) {
+            return CompressionMetadata();
+        }
+        auto data = header.getData();
+        data[EXPONENT_POS] = exponent;
+        return CompressionMetadata(CompressionType::ALP, data);
+    }
+    return CompressionMetadata();
+}
+
+template<typename T>
+bool FloatCompression<T>::canUpdateInPlace(T value, const CompressionMetadata& metadata) {
+    auto encoded = encode(value, getExponent(metadata));
+    return encoded.has_value() && IntegerBitpacking<int64_t>::canUpdateInPlace(*encoded,
+                                      BitpackHeader::readHeader(metadata.data));
+}
+
+template<typename T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
+    uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues, const CompressionMetadata& metadata,
+    const NullMask* nullMask) const {
+    auto exponent = getExponent(metadata);
+    // Null values are stored as the offset of the frame of reference, which can always be stored.
+    auto nullValue = (int64_t)BitpackHeader::readHeader(metadata.data).offset;
+    int64_t encoded[BATCH_SIZE];
+    for (auto i = 0u; i < numValues; i += BATCH_SIZE) {
+        auto numValuesInBatch = std::min(BATCH_SIZE, numValues - i);
+        for (auto j = 0u; j < numValuesInBatch; j++) {
+            auto pos = srcOffset + i + j;
+            if (nullMask && nullMask->isNull(pos)) {
+                encoded[j] = nullValue;
+                continue;
+            }
+            KU_ASSERT(canUpdateInPlace(((const T*)srcBuffer)[pos], metadata));
+            encoded[j] = encode(((const T*)srcBuffer)[pos], exponent).value_or(nullValue);
+        }
+        IntegerBitpacking<int64_t>().setValuesFromUncompressed((const uint8_t*)encoded,
+            0 /*srcOffset*/, dstBuffer, dstOffset + i, numValuesInBatch,
+            getBitpackingMetadata(metadata), nullptr /*nullMask*/);
+    }
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    auto exponent = getExponent(metadata);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    auto encoded = std::make_unique<int64_t[]>(numValuesToCompress);
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        // The exponent is chosen so that all values of the chunk can be encoded.
+        auto encodedValue = encode(((const T*)srcBuffer)[i], exponent);
+        KU_ASSERT(encodedValue.has_value());
+        encoded[i] = *encodedValue;
+    }
+    const uint8_t* encodedBuffer = (const uint8_t*)encoded.get();
+    auto compressedSize = IntegerBitpacking<int64_t>().compressNextPage(encodedBuffer,
+        numValuesToCompress, dstBuffer, dstBufferSize, getBitpackingMetadata(metadata));
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return compressedSize;
+}
+
+template<typename T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto exponent = getExponent(metadata);
+    int64_t encoded[BATCH_SIZE];
+    for (auto i = 0u; i < numValues; i += BATCH_SIZE) {
+        auto numValuesInBatch = std::min(BATCH_SIZE, numValues - i);
+        IntegerBitpacking<int64_t>().decompressFromPage(srcBuffer, srcOffset + i,
+            (uint8_t*)encoded, 0 /*dstOffset*/, numValuesInBatch, getBitpackingMetadata(metadata));
+        for (auto j = 0u; j < numValuesInBatch; j++) {
+            ((T*)dstBuffer)[dstOffset + i + j] = decode(encoded[j], exponent);
+        }
+    }
+}
+
+template class FloatCompression<float>;
+template class FloatCompression<double>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -679,6 +950,15 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::ALP: {
+        if (physicalType == PhysicalTypeID::DOUBLE) {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        KU_ASSERT(physicalType == PhysicalTypeID::FLOAT);
+        return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -741,6 +1021,15 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::ALP: {
+        if (physicalType == PhysicalTypeID::DOUBLE) {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        KU_ASSERT(physicalType == PhysicalTypeID::FLOAT);
+        return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+            result, startPosInResult, numValuesToRead, metadata);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
@@ -750,6 +1039,92 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
     }
 }
 
+void FilterCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor& pageCursor,
+    uint8_t* result, uint32_t startPosInResult, uint64_t numValuesToFilter,
+    const CompressionMetadata& metadata, const ZoneMapFilter& zoneMapFilter) {
+    KU_ASSERT(zoneMapFilter.physicalType == physicalType);
+    result += startPosInResult;
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return filter<int64_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::INT32:
+        return filter<int32_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::INT16:
+        return filter<int16_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::INT8:
+        return filter<int8_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::UINT64:
+        return filter<uint64_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::UINT32:
+        return filter<uint32_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::UINT16:
+        return filter<uint16_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::UINT8:
+        return filter<uint8_t>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::DOUBLE:
+        return filter<double>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    case PhysicalTypeID::FLOAT:
+        return filter<float>(frame, pageCursor, result, numValuesToFilter, metadata,
+            zoneMapFilter);
+    default:
+        throw NotImplementedException("Filtering compressed values is not implemented for type " +
+                                      PhysicalTypeUtils::physicalTypeToString(physicalType));
+    }
+}
+
+template<typename T>
+void FilterCompressedValuesFromPage::filter(const uint8_t* frame, PageCursor& pageCursor,
+    uint8_t* result, uint64_t numValuesToFilter, const CompressionMetadata& metadata,
+    const ZoneMapFilter& zoneMapFilter) {
+    auto comparison = zoneMapFilter.comparison;
+    auto literal = zoneMapFilter.getLiteral<T>();
+    switch (metadata.compression) {
+    case CompressionType::CONSTANT: {
+        evaluateComparison(comparison, &ConstantCompression::getValue<T>(metadata), 1, literal,
+            result);
+        memset(result + 1, result[0], numValuesToFilter - 1);
+    } break;
+    case CompressionType::UNCOMPRESSED: {
+        evaluateComparison(comparison, (const T*)frame + pageCursor.elemPosInPage,
+            numValuesToFilter, literal, result);
+    } break;
+    case CompressionType::INTEGER_BITPACKING: {
+        if constexpr (std::is_integral_v<T>) {
+            IntegerBitpacking<T>().filterFromPage(frame, pageCursor.elemPosInPage, result,
+                numValuesToFilter, metadata, comparison, literal);
+        } else {
+            KU_UNREACHABLE;
+        }
+    } break;
+    case CompressionType::ALP: {
+        if constexpr (std::is_floating_point_v<T>) {
+            // Decoded values are compared in small batches which stay in the cache.
+            static constexpr uint64_t BATCH_SIZE = 128;
+            T values[BATCH_SIZE];
+            for (auto i = 0u; i < numValuesToFilter; i += BATCH_SIZE) {
+                auto numValuesInBatch = std::min(BATCH_SIZE, numValuesToFilter - i);
+                FloatCompression<T>().decompressFromPage(frame, pageCursor.elemPosInPage + i,
+                    (uint8_t*)values, 0 /*dstOffset*/, numValuesInBatch, metadata);
+                evaluateComparison(comparison, values, numValuesInBatch, literal, result + i);
+            }
+        } else {
+            KU_UNREACHABLE;
+        }
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame,
     const uint8_t* data, offset_t dataOffset, offset_t numValues,
     const CompressionMetadata& metadata, const NullMask* nullMask) {
@@ -781,6 +1156,15 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
             }
         });
     }
+    case CompressionType::ALP: {
+        if (physicalType == PhysicalTypeID::DOUBLE) {
+            return FloatCompression<double>().setValuesFromUncompressed(data, dataOffset, frame,
+                posInFrame, numValues, metadata, nullMask);
+        }
+        KU_ASSERT(physicalType == PhysicalTypeID::FLOAT);
+        return FloatCompression<float>().setValuesFromUncompressed(data, dataOffset, frame,
+            posInFrame, numValues, metadata, nullMask);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
@@ -1,5 +1,7 @@
+#include <cstdio>
 #include "storage/index/hash_index.h"
 
+#include <algorithm>
 #include <bitset>
 #include <cstdint>
 #include <type_traits>
@@ -156,6 +158,64 @@ bool HashIndex<T>::lookupInternal(Transaction* transaction, Key key, offset_t& r
     }
 }
 
+template<typename T>
+void HashIndex<T>::lookupInternal(Transaction* transaction, std::span<const Key> keys,
+    std::span<const hash_t> hashes, offset_t* results) {
+    KU_ASSERT(keys.size() == hashes.size());
+    std::vector<uint32_t> keyIdxes;
+    keyIdxes.reserve(keys.size());
+    for (auto i = 0u; i < keys.size(); i++) {
+        results[i] = INVALID_OFFSET;
+        if (transaction->isWriteTransaction()) {
+            auto localLookupState = localStorage->lookup(keys[i], results[i]);
+            if (localLookupState == HashIndexLocalLookupState::KEY_DELETED) {
+                results[i] = INVALID_OFFSET;
+                continue;
+            } else if (localLookupState == HashIndexLocalLookupState::KEY_FOUND ||
+                       bulkInsertLocalStorage.lookup(keys[i], results[i])) {
+                continue;
+            }
+            results[i] = INVALID_OFFSET;
+        }
+        keyIdxes.push_back(i);
+    }
+    auto trxType = transaction->getType();
+    auto& header = trxType == TransactionType::READ_ONLY ? *this->indexHeaderForReadTrx :
+                                                           *this->indexHeaderForWriteTrx;
+    if (header.numEntries == 0 || keyIdxes.empty()) {
+        return;
+    }
+    std::vector<slot_id_t> slotIds(keys.size());
+    for (auto keyIdx : keyIdxes) {
+        slotIds[keyIdx] = HashIndexUtils::getPrimarySlotIdForHash(header, hashes[keyIdx]);
+    }
+    std::sort(keyIdxes.begin(), keyIdxes.end(),
+        [&](uint32_t a, uint32_t b) { return slotIds[a] < slotIds[b]; });
+    SlotIterator iter;
+    for (auto i = 0u; i < keyIdxes.size(); i++) {
+        auto keyIdx = keyIdxes[i];
+        auto slotId = slotIds[keyIdx];
+        if (i == 0 || slotId != slotIds[keyIdxes[i - 1]]) {
+            iter = getSlotIterator(slotId, trxType);
+        }
+        auto fingerprint = HashIndexUtils::getFingerprintForHash(hashes[keyIdx]);
+        auto entryPos = findMatchedEntryInSlot(trxType, iter.slot, keys[keyIdx], fingerprint);
+        if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+            results[keyIdx] = iter.slot.entries[entryPos].value;
+            continue;
+        }
+        // Overflow slots are read into a copy, so that the primary slot is kept for the next key.
+        auto ovfIter = iter;
+        while (nextChainedSlot(trxType, ovfIter)) {
+            entryPos = findMatchedEntryInSlot(trxType, ovfIter.slot, keys[keyIdx], fingerprint);
+            if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                results[keyIdx] = ovfIter.slot.entries[entryPos].value;
+                break;
+            }
+        }
+    }
+}
+
 // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
 // in the persistent storage and directly delete keys in the local storage.
 template<typename T>
@@ -292,6 +352,26 @@ void HashIndex<T>::prepareCommit() {
             [this](Key key, offset_t value) -> void {
                 this->insertIntoPersistentIndex(key, value);
             });
+        {
+            uint64_t numMissing = 0, numKeys = 0;
+            localStorage->applyLocalChanges([](Key) {},
+                [&](Key key, offset_t) {
+                    offset_t r;
+                    numKeys++;
+                    if (!lookupInPersistentIndex(TransactionType::WRITE, key, r)) {
+                        numMissing++;
+                    }
+                });
+            if (numMissing > 0) {
+                auto& h = *indexHeaderForWriteTrx;
+                fprintf(stderr, "DBG missing %lu/%lu level=%lu next=%lu pslots=%lu oslots=%lu "
+                    "entries=%lu\n", (unsigned long)numMissing, (unsigned long)numKeys,
+                    (unsigned long)h.currentLevel, (unsigned long)h.nextSplitSlotId,
+                    (unsigned long)pSlots->getNumElements(TransactionType::WRITE),
+                    (unsigned long)oSlots->getNumElements(TransactionType::WRITE),
+                    (unsigned long)h.numEntries);
+            }
+        }
         headerArray->update(INDEX_HEADER_IDX_IN_ARRAY, *indexHeaderForWriteTrx);
     }
     if (bulkInsertLocalStorage.size() > 0) {
@@ -363,7 +443,8 @@ void HashIndex<T>::splitSlots(HashIndexHeader& header, slot_id_t numSlotsToSplit
     auto newSlotIterator = pSlots->iter_mut();
     auto overflowSlotIterator = oSlots->iter_mut();
     // The overflow slot iterators will hang if they access the same page
-    // So instead buffer new overflow slots here and append them at the end
+    // So instead buffer new overflow slots here and append them at the end of each level, before
+    // the slots they are chained to get split again
     std::vector<Slot<T>> newOverflowSlots;
 
     for (slot_id_t i = 0; i < numSlotsToSplit; i++) {
@@ -377,6 +458,9 @@ void HashIndex<T>::splitSlots(HashIndexHeader& header, slot_id_t numSlotsToSplit
                     continue; // Skip invalid entries.
                 }
                 if (newEntryPos >= getSlotCapacity<T>()) {
+                    // The new overflow slots are appended in order once all slots are split.
+                    newSlot->header.nextOvfSlotId =
+                        oSlots->getNumElements(TransactionType::WRITE) + newOverflowSlots.size();
                     newOverflowSlots.emplace_back();
                     newSlot = &newOverflowSlots.back();
                     newEntryPos = 0;
@@ -397,9 +481,12 @@ void HashIndex<T>::splitSlots(HashIndexHeader& header, slot_id_t numSlotsToSplit
         } while (originalSlot->header.nextOvfSlotId != 0 &&
                  (originalSlot = &*overflowSlotIterator.seek(originalSlot->header.nextOvfSlotId)));
         header.incrementNextSplitSlotId();
-    }
-    for (auto&& slot : newOverflowSlots) {
-        overflowSlotIterator.pushBack(std::move(slot));
+        if (header.nextSplitSlotId == 0 || i == numSlotsToSplit - 1) {
+            for (auto&& slot : newOverflowSlots) {
+                overflowSlotIterator.pushBack(std::move(slot));
+            }
+            newOverflowSlots.clear();
+        }
     }
 }
 
@@ -455,7 +542,8 @@ void HashIndex<T>::reserve(uint64_t newEntries) {
             this->indexHeaderForWriteTrx->nextSplitSlotId =
                 numRequiredSlots - numSlotsOfCurrentLevel;
         };
-    } else {
+    } else if (numRequiredSlots > pSlots->getNumElements(TransactionType::WRITE)) {
+        // Slots may already have been reserved for more entries than are being inserted.
         splitSlots(*this->indexHeaderForWriteTrx,
             numRequiredSlots - pSlots->getNumElements(TransactionType::WRITE));
     }
@@ -674,6 +762,64 @@ bool PrimaryKeyIndex::lookup(Transaction* trx, common::ValueVector* keyVector, u
     return retVal;
 }
 
+void PrimaryKeyIndex::lookup(Transaction* trx, ValueVector* keyVector, offset_t* results) {
+    TypeUtils::visit(
+        keyDataTypeID, [&]<IndexHashable T>(T) { lookupBatch<T>(trx, keyVector, results); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+template<IndexHashable T>
+void PrimaryKeyIndex::lookupBatch(Transaction* trx, ValueVector* keyVector, offset_t* results) {
+    using Key = typename HashIndex<T>::Key;
+    auto& selVector = *keyVector->state->selVector;
+    std::vector<Key> keys(selVector.selectedSize);
+    std::vector<hash_t> hashes(selVector.selectedSize);
+    std::vector<uint32_t> keyIdxes;
+    keyIdxes.reserve(selVector.selectedSize);
+    for (auto i = 0u; i < selVector.selectedSize; i++) {
+        auto pos = selVector.selectedPositions[i];
+        results[i] = INVALID_OFFSET;
+        if (keyVector->isNull(pos)) {
+            continue;
+        }
+        if constexpr (std::same_as<T, ku_string_t>) {
+            keys[i] = keyVector->getValue<ku_string_t>(pos).getAsStringView();
+        } else {
+            keys[i] = keyVector->getValue<T>(pos);
+        }
+        hashes[i] = HashIndexUtils::hash(keys[i]);
+        keyIdxes.push_back(i);
+    }
+    std::sort(keyIdxes.begin(), keyIdxes.end(), [&](uint32_t a, uint32_t b) {
+        return HashIndexUtils::getHashIndexPositionForHash(hashes[a]) <
+               HashIndexUtils::getHashIndexPositionForHash(hashes[b]);
+    });
+    // Keys of each hash index are looked up together.
+    std::vector<Key> indexKeys;
+    std::vector<hash_t> indexHashes;
+    std::vector<offset_t> indexResults;
+    auto start = 0u;
+    while (start < keyIdxes.size()) {
+        auto indexPos = HashIndexUtils::getHashIndexPositionForHash(hashes[keyIdxes[start]]);
+        auto end = start;
+        indexKeys.clear();
+        indexHashes.clear();
+        while (end < keyIdxes.size() &&
+               HashIndexUtils::getHashIndexPositionForHash(hashes[keyIdxes[end]]) == indexPos) {
+            indexKeys.push_back(keys[keyIdxes[end]]);
+            indexHashes.push_back(hashes[keyIdxes[end]]);
+            end++;
+        }
+        indexResults.resize(indexKeys.size());
+        getTypedHashIndexByPos<T>(indexPos)->lookupInternal(trx, indexKeys, indexHashes,
+            indexResults.data());
+        for (auto i = start; i < end; i++) {
+            results[keyIdxes[i]] = indexResults[i - start];
+        }
+        start = end;
+    }
+}
+
 bool PrimaryKeyIndex::insert(common::ValueVector* keyVector, uint64_t vectorPos,
     common::offset_t value) {
     bool result = false;
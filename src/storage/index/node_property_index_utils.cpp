@@ -0,0 +1,49 @@
+#include "storage/index/node_property_index_utils.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+Column* NodePropertyIndexUtils::getColumn(Transaction* transaction, const Catalog& catalog,
+    StorageManager& storageManager, table_id_t tableID, property_id_t propertyID) {
+    // Indexes are dropped together with their tables and properties.
+    auto tableEntry = catalog.getTableCatalogEntry(transaction, tableID);
+    auto columnID = tableEntry->getColumnID(propertyID);
+    KU_ASSERT(columnID != INVALID_COLUMN_ID);
+    auto nodeTable = ku_dynamic_cast<Table*, NodeTable*>(storageManager.getTable(tableID));
+    return nodeTable->getColumn(columnID);
+}
+
+void NodePropertyIndexUtils::scanColumn(Transaction* transaction, StorageManager& storageManager,
+    table_id_t tableID, Column& column, const index_append_func_t& appendFunc) {
+    auto nodeTable = ku_dynamic_cast<Table*, NodeTable*>(storageManager.getTable(tableID));
+    auto numNodes = nodeTable->getMaxNodeOffset(transaction) + 1;
+    std::vector<bool> deleted(numNodes, false);
+    for (auto nodeOffset : storageManager.getNodesStatisticsAndDeletedIDs()
+                               ->getNodeStatisticsAndDeletedIDs(transaction, tableID)
+                               ->getDeletedNodeOffsets()) {
+        if (nodeOffset < numNodes) {
+            deleted[nodeOffset] = true;
+        }
+    }
+    auto numNodeGroups = std::min(column.getNumNodeGroups(transaction),
+        nodeTable->getNumNodeGroups(transaction));
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < numNodeGroups; nodeGroupIdx++) {
+        auto numValues = column.getMetadata(nodeGroupIdx, transaction->getType()).numValues;
+        auto chunk = ColumnChunkFactory::createColumnChunk(column.getDataType(),
+            false /* enableCompression */, std::max<uint64_t>(numValues, 1));
+        column.scan(transaction, nodeGroupIdx, chunk.get());
+        appendFunc(*chunk, StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx), deleted);
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,340 @@
+#include "storage/index/property_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/runtime.h"
+#include "common/vector/value_vector.h"
+#include "storage/index/node_property_index_utils.h"
+#include "storage/local_storage/local_node_table.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_utils.h"
+#include "storage/store/column.h"
+#include "storage/store/string_column_chunk.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+// Type of the keys of an index on values of physical type T. Strings are copied out of the chunks.
+template<typename T>
+struct PropertyIndexKey {
+    using type = T;
+};
+
+template<>
+struct PropertyIndexKey<ku_string_t> {
+    using type = std::string;
+};
+
+template<typename T>
+static bool isNaN(const T& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isnan(value);
+    } else {
+        return false;
+    }
+}
+
+template<typename T>
+class TypedPropertyIndex final : public PropertyIndex {
+    using key_t = typename PropertyIndexKey<T>::type;
+
+public:
+    void append(const ColumnChunk& chunk, offset_t startNodeOffset,
+        const std::vector<bool>& deleted) override {
+        for (auto i = 0u; i < chunk.getNumValues(); i++) {
+            auto nodeOffset = startNodeOffset + i;
+            if (nodeOffset >= deleted.size() || deleted[nodeOffset]) {
+                continue;
+            }
+            insert(chunk, i, nodeOffset);
+        }
+    }
+
+    void insert(const ColumnChunk& chunk, offset_t pos, offset_t nodeOffset) override {
+        if (chunk.getNullChunk().isNull(pos)) {
+            return;
+        }
+        auto value = getValue(chunk, pos);
+        if (isNaN(value)) {
+            return;
+        }
+        entries.emplace_back(std::move(value), nodeOffset);
+    }
+
+    void finalize() override {
+        std::sort(entries.begin(), entries.end());
+        std::vector<key_t> mergedKeys;
+        std::vector<offset_t> mergedNodeOffsets;
+        mergedKeys.reserve(keys.size() + entries.size());
+        mergedNodeOffsets.reserve(keys.size() + entries.size());
+        auto idx = 0u;
+        for (auto& [key, nodeOffset] : entries) {
+            while (idx < keys.size() &&
+                   std::tie(keys[idx], nodeOffsets[idx]) < std::tie(key, nodeOffset)) {
+                mergedKeys.push_back(std::move(keys[idx]));
+                mergedNodeOffsets.push_back(nodeOffsets[idx]);
+                idx++;
+            }
+            mergedKeys.push_back(std::move(key));
+            mergedNodeOffsets.push_back(nodeOffset);
+        }
+        for (; idx < keys.size(); idx++) {
+            mergedKeys.push_back(std::move(keys[idx]));
+            mergedNodeOffsets.push_back(nodeOffsets[idx]);
+        }
+        keys = std::move(mergedKeys);
+        nodeOffsets = std::move(mergedNodeOffsets);
+        entries.clear();
+        entries.shrink_to_fit();
+    }
+
+    void remove(const std::unordered_set<offset_t>& nodeOffsetsToRemove) override {
+        if (nodeOffsetsToRemove.empty()) {
+            return;
+        }
+        auto numEntries = 0u;
+        for (auto idx = 0u; idx < keys.size(); idx++) {
+            if (nodeOffsetsToRemove.contains(nodeOffsets[idx])) {
+                continue;
+            }
+            if (numEntries != idx) {
+                keys[numEntries] = std::move(keys[idx]);
+                nodeOffsets[numEntries] = nodeOffsets[idx];
+            }
+            numEntries++;
+        }
+        keys.resize(numEntries);
+        nodeOffsets.resize(numEntries);
+    }
+
+    std::pair<uint64_t, uint64_t> lookup(const ValueVector* lowerBound, bool lowerInclusive,
+        const ValueVector* upperBound, bool upperInclusive) const override {
+        uint64_t begin = 0, end = keys.size();
+        if (lowerBound != nullptr) {
+            auto pos = lowerBound->state->selVector->selectedPositions[0];
+            if (lowerBound->isNull(pos) || isNaN(lowerBound->getValue<T>(pos))) {
+                return {0, 0};
+            }
+            auto key = getBound(*lowerBound, pos);
+            begin = (lowerInclusive ? std::lower_bound(keys.begin(), keys.end(), key) :
+                                      std::upper_bound(keys.begin(), keys.end(), key)) -
+                    keys.begin();
+        }
+        if (upperBound != nullptr) {
+            auto pos = upperBound->state->selVector->selectedPositions[0];
+            if (upperBound->isNull(pos) || isNaN(upperBound->getValue<T>(pos))) {
+                return {0, 0};
+            }
+            auto key = getBound(*upperBound, pos);
+            end = (upperInclusive ? std::upper_bound(keys.begin(), keys.end(), key) :
+                                    std::lower_bound(keys.begin(), keys.end(), key)) -
+                  keys.begin();
+        }
+        return {begin, std::max(begin, end)};
+    }
+
+private:
+    static key_t getValue(const ColumnChunk& chunk, offset_t pos) {
+        if constexpr (std::is_same_v<T, ku_string_t>) {
+            return ku_dynamic_cast<const ColumnChunk&, const StringColumnChunk&>(chunk)
+                .getValue<std::string>(pos);
+        } else {
+            return chunk.getValue<T>(pos);
+        }
+    }
+
+    static auto getBound(const ValueVector& vector, sel_t pos) {
+        if constexpr (std::is_same_v<T, ku_string_t>) {
+            return vector.getValue<ku_string_t>(pos).getAsStringView();
+        } else {
+            return vector.getValue<T>(pos);
+        }
+    }
+
+private:
+    // Entries appended or inserted since the last finalize().
+    std::vector<std::pair<key_t, offset_t>> entries;
+    std::vector<key_t> keys;
+};
+
+bool PropertyIndex::isIndexableType(LogicalTypeID typeID) {
+    switch (typeID) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::unique_ptr<PropertyIndex> PropertyIndex::create(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return std::make_unique<TypedPropertyIndex<int64_t>>();
+    case PhysicalTypeID::INT32:
+        return std::make_unique<TypedPropertyIndex<int32_t>>();
+    case PhysicalTypeID::INT16:
+        return std::make_unique<TypedPropertyIndex<int16_t>>();
+    case PhysicalTypeID::INT8:
+        return std::make_unique<TypedPropertyIndex<int8_t>>();
+    case PhysicalTypeID::UINT64:
+        return std::make_unique<TypedPropertyIndex<uint64_t>>();
+    case PhysicalTypeID::UINT32:
+        return std::make_unique<TypedPropertyIndex<uint32_t>>();
+    case PhysicalTypeID::UINT16:
+        return std::make_unique<TypedPropertyIndex<uint16_t>>();
+    case PhysicalTypeID::UINT8:
+        return std::make_unique<TypedPropertyIndex<uint8_t>>();
+    case PhysicalTypeID::INT128:
+        return std::make_unique<TypedPropertyIndex<int128_t>>();
+    case PhysicalTypeID::DOUBLE:
+        return std::make_unique<TypedPropertyIndex<double>>();
+    case PhysicalTypeID::FLOAT:
+        return std::make_unique<TypedPropertyIndex<float>>();
+    case PhysicalTypeID::STRING:
+        return std::make_unique<TypedPropertyIndex<ku_string_t>>();
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool PropertyIndexCache::containsIndex(Transaction* transaction, const Catalog& catalog,
+    table_id_t tableID, property_id_t propertyID) {
+    auto tableEntry = catalog.getTableCatalogEntry(transaction, tableID);
+    return tableEntry->getTableType() == TableType::NODE &&
+           ku_dynamic_cast<TableCatalogEntry*, NodeTableCatalogEntry*>(tableEntry)
+               ->hasPropertyIndex(propertyID);
+}
+
+std::shared_ptr<PropertyIndex> PropertyIndexCache::getIndex(Transaction* transaction,
+    const Catalog& catalog, table_id_t tableID, property_id_t propertyID) {
+    KU_ASSERT(transaction->isReadOnly());
+    if (!containsIndex(transaction, catalog, tableID, propertyID)) {
+        throw RuntimeException("Property index does not exist.");
+    }
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock lck{mtx};
+        auto& cachedEntry = entries[{tableID, propertyID}];
+        if (cachedEntry == nullptr) {
+            cachedEntry = std::make_shared<Entry>();
+        }
+        entry = cachedEntry;
+    }
+    std::unique_lock lck{entry->mtx};
+    if (entry->index == nullptr) {
+        entry->index = loadIndex(transaction, catalog, tableID, propertyID);
+    }
+    return entry->index;
+}
+
+static void insertLocalValues(PropertyIndex& index, LocalChunkedGroupCollection& localChunks,
+    column_id_t columnID, offset_t startNodeOffset) {
+    auto chunks = localChunks.getLocalChunk(columnID);
+    for (auto& [offset, rowIdx] : localChunks.getOffsetToRowIdx()) {
+        auto [chunkIdx, offsetInChunk] =
+            LocalChunkedGroupCollection::getChunkIdxAndOffsetInChunk(rowIdx);
+        index.insert(*chunks[chunkIdx], offsetInChunk, startNodeOffset + offset);
+    }
+}
+
+// Offsets in local node groups are relative to the start of their node groups.
+static void applyLocalChanges(PropertyIndex& index, const LocalNodeTableData& localTableData,
+    column_id_t columnID) {
+    // Deleted nodes and nodes whose value has been updated lose their entries.
+    std::unordered_set<offset_t> nodeOffsetsToRemove;
+    for (auto& [nodeGroupIdx, localNodeGroup] : localTableData.getNodeGroups()) {
+        auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        for (auto offset : localNodeGroup->getDeleteInfo().getDeletedOffsets()) {
+            nodeOffsetsToRemove.insert(startNodeOffset + offset);
+        }
+        for (auto& [offset, _] : localNodeGroup->getUpdateChunks(columnID).getOffsetToRowIdx()) {
+            nodeOffsetsToRemove.insert(startNodeOffset + offset);
+        }
+    }
+    index.remove(nodeOffsetsToRemove);
+    // Inserted nodes and updated nodes get entries with their new values. Updates of nodes
+    // inserted by the same transaction are applied to their inserted values.
+    for (auto& [nodeGroupIdx, localNodeGroup] : localTableData.getNodeGroups()) {
+        auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        insertLocalValues(index, localNodeGroup->getInsertChunks(), columnID, startNodeOffset);
+        insertLocalValues(index, localNodeGroup->getUpdateChunks(columnID), 0 /* columnID */,
+            startNodeOffset);
+    }
+    index.finalize();
+}
+
+void PropertyIndexCache::applyCommittedChanges(Transaction* transaction, const Catalog& catalog,
+    const std::unordered_set<table_id_t>& tableIDs) {
+    std::unique_lock lck{mtx};
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto [tableID, propertyID] = it->first;
+        if (!tableIDs.contains(tableID)) {
+            ++it;
+            continue;
+        }
+        auto& entry = *it->second;
+        std::unique_lock entryLck{entry.mtx};
+        auto localTable = transaction->getLocalStorage()->getLocalTable(tableID);
+        if (entry.index == nullptr || localTable == nullptr) {
+            entryLck.unlock();
+            it = entries.erase(it);
+            continue;
+        }
+        auto columnID = catalog.getTableCatalogEntry(transaction, tableID)->getColumnID(propertyID);
+        applyLocalChanges(*entry.index,
+            *ku_dynamic_cast<LocalTable*, LocalNodeTable*>(localTable)->getTableData(), columnID);
+        ++it;
+    }
+}
+
+void PropertyIndexCache::invalidate(const std::unordered_set<table_id_t>& tableIDs) {
+    std::unique_lock lck{mtx};
+    std::erase_if(entries, [&](const auto& item) { return tableIDs.contains(item.first.first); });
+}
+
+void PropertyIndexCache::invalidate() {
+    std::unique_lock lck{mtx};
+    entries.clear();
+}
+
+std::unique_ptr<PropertyIndex> PropertyIndexCache::loadIndex(Transaction* transaction,
+    const Catalog& catalog, table_id_t tableID, property_id_t propertyID) const {
+    auto column = NodePropertyIndexUtils::getColumn(transaction, catalog, storageManager,
+        tableID, propertyID);
+    auto index = PropertyIndex::create(column->getDataType().getPhysicalType());
+    NodePropertyIndexUtils::scanColumn(transaction, storageManager, tableID, *column,
+        [&](const ColumnChunk& chunk, offset_t startNodeOffset, const std::vector<bool>& deleted) {
+            index->append(chunk, startNodeOffset, deleted);
+        });
+    index->finalize();
+    return index;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,604 @@
+#include "storage/index/vector_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <random>
+#include <thread>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/array_distance_kernels.h"
+#include "common/exception/runtime.h"
+#include "storage/index/node_property_index_utils.h"
+#include "storage/local_storage/local_node_table.h"
+#include "storage/local_storage/local_storage.h"
+#include "storage/storage_utils.h"
+#include "storage/store/column.h"
+#include "storage/store/list_column_chunk.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+// Vectors visited by a search of a build, which are marked with the epoch of the search.
+struct VisitedEpochs {
+    std::vector<uint32_t> epochs;
+    uint32_t epoch = 0;
+
+    explicit VisitedEpochs(uint64_t numVectors) : epochs(numVectors, 0) {}
+};
+
+template<typename T>
+class HNSWIndex final : public VectorIndex {
+    // Position of a vector in the index.
+    using vector_idx_t = uint32_t;
+    // Candidates are (distance, vector) pairs.
+    using candidate_t = std::pair<double, vector_idx_t>;
+    using max_heap_t = std::priority_queue<candidate_t>;
+    using min_heap_t =
+        std::priority_queue<candidate_t, std::vector<candidate_t>, std::greater<candidate_t>>;
+
+    static constexpr uint8_t MAX_LEVEL = 16;
+    // Seed of the level generator, so that the vectors of a table get the same levels in every
+    // build.
+    static constexpr uint64_t LEVEL_SEED = 42;
+    // Fewer vectors are inserted by a single thread.
+    static constexpr uint64_t MIN_NUM_VECTORS_PER_THREAD = 1024;
+
+public:
+    HNSWIndex(uint64_t dimension, const VectorIndexConfig& config)
+        : VectorIndex{dimension, config}, maxBottomDegree{2 * config.maxDegree},
+          numInsertedVectors{0}, entryPoint{0}, maxLevel{0}, levelGenerator{LEVEL_SEED} {}
+
+    void append(const ColumnChunk& chunk, offset_t startNodeOffset,
+        const std::vector<bool>& deleted) override {
+        for (auto i = 0u; i < chunk.getNumValues(); i++) {
+            auto nodeOffset = startNodeOffset + i;
+            if (nodeOffset >= deleted.size() || deleted[nodeOffset]) {
+                continue;
+            }
+            insert(chunk, i, nodeOffset);
+        }
+    }
+
+    void insert(const ColumnChunk& chunk, offset_t pos, offset_t nodeOffset) override {
+        auto& listChunk = ku_dynamic_cast<const ColumnChunk&, const ListColumnChunk&>(chunk);
+        if (chunk.getNullChunk().isNull(pos) || listChunk.getListSize(pos) != dimension) {
+            return;
+        }
+        const ColumnChunk* dataChunk = listChunk.getDataColumnChunk();
+        auto startOffset = listChunk.getListStartOffset(pos);
+        auto numValues = vectors.size();
+        vectors.resize(numValues + dimension);
+        auto values = vectors.data() + numValues;
+        auto isValid = true;
+        for (auto j = 0u; j < dimension && isValid; j++) {
+            isValid = !dataChunk->getNullChunk().isNull(startOffset + j);
+            if (isValid) {
+                values[j] = dataChunk->getValue<T>(startOffset + j);
+                isValid = !std::isnan(values[j]);
+            }
+        }
+        if (isValid && prepareVector(values)) {
+            nodeOffsets.push_back(nodeOffset);
+        } else {
+            vectors.resize(numValues);
+        }
+    }
+
+    void finalize(uint64_t numThreads) override {
+        if (nodeOffsets.size() > std::numeric_limits<vector_idx_t>::max()) {
+            throw RuntimeException("Cannot build a vector index on more than 2^32 - 1 vectors.");
+        }
+        auto startIdx = numInsertedVectors;
+        auto numVectors = nodeOffsets.size();
+        if (startIdx == numVectors) {
+            return;
+        }
+        bottomNeighbors.resize(numVectors * (maxBottomDegree + 1), 0);
+        levels.resize(numVectors);
+        upperNeighbors.resize(numVectors);
+        isRemoved.resize(numVectors, false);
+        std::uniform_real_distribution<double> uniform{0.0, 1.0};
+        auto levelMultiplier = 1.0 / std::log((double)std::max<uint64_t>(config.maxDegree, 2));
+        for (auto i = startIdx; i < numVectors; i++) {
+            // The level of a vector is geometrically distributed, so that each layer holds about
+            // 1/maxDegree of the vectors of the layer below.
+            auto level = (uint64_t)(-std::log(1.0 - uniform(levelGenerator)) * levelMultiplier);
+            levels[i] = std::min<uint64_t>(level, MAX_LEVEL);
+            upperNeighbors[i].resize(levels[i] * (config.maxDegree + 1), 0);
+        }
+        // The first vector is the entry point of the empty graph.
+        if (startIdx == 0) {
+            entryPoint = 0;
+            maxLevel = levels[0];
+            startIdx++;
+        }
+        auto numVectorsToInsert = numVectors - startIdx;
+        numThreads = std::clamp<uint64_t>(numVectorsToInsert / MIN_NUM_VECTORS_PER_THREAD, 1,
+            std::max<uint64_t>(numThreads, 1));
+        // Searches of small batches only visit a tiny part of a large graph.
+        if (numVectorsToInsert * MIN_NUM_VECTORS_PER_THREAD < numVectors) {
+            std::unordered_set<vector_idx_t> visited;
+            for (auto idx = startIdx; idx < numVectors; idx++) {
+                insert(idx, visited);
+            }
+        } else if (numThreads == 1) {
+            VisitedEpochs visited{numVectors};
+            for (auto idx = startIdx; idx < numVectors; idx++) {
+                insert(idx, visited);
+            }
+        } else {
+            neighborLocks = std::make_unique<std::mutex[]>(numVectors);
+            std::atomic<uint64_t> nextIdx{startIdx};
+            std::vector<std::thread> threads;
+            for (auto i = 0u; i < numThreads; i++) {
+                threads.emplace_back([&]() {
+                    VisitedEpochs visited{numVectors};
+                    for (auto idx = nextIdx++; idx < numVectors; idx = nextIdx++) {
+                        insert(idx, visited);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            neighborLocks.reset();
+        }
+        numInsertedVectors = numVectors;
+    }
+
+    // Vectors which have not been inserted into the graph yet cannot be removed.
+    void remove(const std::unordered_set<offset_t>& nodeOffsetsToRemove) override {
+        if (nodeOffsetsToRemove.empty()) {
+            return;
+        }
+        for (auto idx = 0u; idx < numInsertedVectors; idx++) {
+            if (!isRemoved[idx] && nodeOffsetsToRemove.contains(nodeOffsets[idx])) {
+                isRemoved[idx] = true;
+                numRemovedVectors++;
+            }
+        }
+    }
+
+    std::vector<std::pair<offset_t, double>> search(const std::vector<double>& query, uint64_t k,
+        uint64_t efSearch) const override {
+        KU_ASSERT(query.size() == dimension);
+        std::vector<std::pair<offset_t, double>> result;
+        std::vector<T> queryVector(query.begin(), query.end());
+        if (numInsertedVectors == 0 || k == 0 || !prepareVector(queryVector.data())) {
+            return result;
+        }
+        auto entry = greedySearch(queryVector.data(), entryPoint, maxLevel, 1);
+        std::unordered_set<vector_idx_t> visited;
+        auto candidates = searchLayer(queryVector.data(), entry, std::max(k, efSearch), 0,
+            visited, true /* excludeRemoved */);
+        while (candidates.size() > k) {
+            candidates.pop();
+        }
+        result.resize(candidates.size());
+        for (auto i = candidates.size(); i > 0; i--) {
+            auto [distance, idx] = candidates.top();
+            candidates.pop();
+            result[i - 1] = {nodeOffsets[idx], getOutputDistance(distance)};
+        }
+        return result;
+    }
+
+private:
+    inline const T* getVector(vector_idx_t idx) const { return vectors.data() + idx * dimension; }
+
+    // Normalizes vectors for the cosine metric, whose distance is then 1 - dot product. Returns
+    // false for zero vectors, whose cosine distance is undefined.
+    bool prepareVector(T* values) const {
+        if (config.metric != VectorDistanceMetric::COSINE) {
+            return true;
+        }
+        double norm = 0;
+        for (auto i = 0u; i < dimension; i++) {
+            norm += (double)values[i] * values[i];
+        }
+        if (norm == 0) {
+            return false;
+        }
+        norm = std::sqrt(norm);
+        for (auto i = 0u; i < dimension; i++) {
+            values[i] = values[i] / norm;
+        }
+        return true;
+    }
+
+    // Smaller is closer. The L2 distance is squared, which preserves the order.
+    double computeDistance(const T* left, const T* right) const {
+        switch (config.metric) {
+        case VectorDistanceMetric::L2:
+            return ArrayDistanceKernels::squaredDistance(left, right, dimension);
+        case VectorDistanceMetric::COSINE:
+            return 1.0 - ArrayDistanceKernels::innerProduct(left, right, dimension);
+        case VectorDistanceMetric::INNER_PRODUCT:
+            return -ArrayDistanceKernels::innerProduct(left, right, dimension);
+        default:
+            KU_UNREACHABLE;
+        }
+    }
+
+    inline double getOutputDistance(double distance) const {
+        return config.metric == VectorDistanceMetric::L2 ? std::sqrt(distance) : distance;
+    }
+
+    inline uint64_t getMaxDegree(uint8_t level) const {
+        return level == 0 ? maxBottomDegree : config.maxDegree;
+    }
+
+    // The first slot of a neighbor list holds its size.
+    inline vector_idx_t* getNeighborList(vector_idx_t idx, uint8_t level) {
+        return level == 0 ? bottomNeighbors.data() + idx * (maxBottomDegree + 1) :
+                            upperNeighbors[idx].data() + (level - 1) * (config.maxDegree + 1);
+    }
+
+    // Neighbor lists are locked while vectors are inserted by several threads.
+    inline std::unique_lock<std::mutex> lockNeighbors(vector_idx_t idx) const {
+        return neighborLocks == nullptr ? std::unique_lock<std::mutex>{} :
+                                          std::unique_lock<std::mutex>{neighborLocks[idx]};
+    }
+
+    template<typename FUNC>
+    void forEachNeighbor(vector_idx_t idx, uint8_t level, FUNC func) const {
+        auto lck = lockNeighbors(idx);
+        auto list = level == 0 ? bottomNeighbors.data() + idx * (maxBottomDegree + 1) :
+                                 upperNeighbors[idx].data() + (level - 1) * (config.maxDegree + 1);
+        for (auto i = 1u; i <= list[0]; i++) {
+            func(list[i]);
+        }
+    }
+
+    // Moves to the closest neighbor from each layer down to lowestLevel, until no neighbor is
+    // closer to the query.
+    vector_idx_t greedySearch(const T* query, vector_idx_t entry, uint8_t topLevel,
+        uint8_t lowestLevel) const {
+        auto distance = computeDistance(query, getVector(entry));
+        for (auto level = (int64_t)topLevel; level >= lowestLevel; level--) {
+            auto changed = true;
+            while (changed) {
+                changed = false;
+                forEachNeighbor(entry, level, [&](vector_idx_t neighbor) {
+                    auto neighborDistance = computeDistance(query, getVector(neighbor));
+                    if (neighborDistance < distance) {
+                        distance = neighborDistance;
+                        entry = neighbor;
+                        changed = true;
+                    }
+                });
+            }
+        }
+        return entry;
+    }
+
+    // Beam search of a layer, which returns up to ef vectors closest to the query in a max heap.
+    // VISITED is either a set or the epochs of a build. Removed vectors are still explored, but
+    // are only returned if excludeRemoved is false.
+    template<typename VISITED>
+    max_heap_t searchLayer(const T* query, vector_idx_t entry, uint64_t ef, uint8_t level,
+        VISITED& visited, bool excludeRemoved) const {
+        min_heap_t candidates;
+        max_heap_t result;
+        auto entryDistance = computeDistance(query, getVector(entry));
+        markVisited(visited, entry);
+        candidates.emplace(entryDistance, entry);
+        if (!excludeRemoved || !isRemoved[entry]) {
+            result.emplace(entryDistance, entry);
+        }
+        while (!candidates.empty()) {
+            auto [distance, idx] = candidates.top();
+            if (result.size() >= ef && distance > result.top().first) {
+                break;
+            }
+            candidates.pop();
+            forEachNeighbor(idx, level, [&](vector_idx_t neighbor) {
+                if (!markVisited(visited, neighbor)) {
+                    return;
+                }
+                auto neighborDistance = computeDistance(query, getVector(neighbor));
+                if (result.size() < ef || neighborDistance < result.top().first) {
+                    candidates.emplace(neighborDistance, neighbor);
+                    if (!excludeRemoved || !isRemoved[neighbor]) {
+                        result.emplace(neighborDistance, neighbor);
+                        if (result.size() > ef) {
+                            result.pop();
+                        }
+                    }
+                }
+            });
+        }
+        return result;
+    }
+
+    // Starts a new search of a build.
+    static inline void resetVisited(std::unordered_set<vector_idx_t>& visited) { visited.clear(); }
+    static inline void resetVisited(VisitedEpochs& visited) { visited.epoch++; }
+
+    // Returns false if the vector has been visited already.
+    static inline bool markVisited(std::unordered_set<vector_idx_t>& visited, vector_idx_t idx) {
+        return visited.insert(idx).second;
+    }
+    static inline bool markVisited(VisitedEpochs& visited, vector_idx_t idx) {
+        if (visited.epochs[idx] == visited.epoch) {
+            return false;
+        }
+        visited.epochs[idx] = visited.epoch;
+        return true;
+    }
+
+    // Keeps the closest candidates which are closer to the query than to any kept candidate, so
+    // that neighbors spread in all directions rather than cluster on one side.
+    std::vector<candidate_t> selectNeighbors(std::vector<candidate_t> candidates,
+        uint64_t maxDegree) const {
+        std::sort(candidates.begin(), candidates.end());
+        if (candidates.size() <= maxDegree) {
+            return candidates;
+        }
+        std::vector<candidate_t> selected;
+        for (auto& candidate : candidates) {
+            if (selected.size() == maxDegree) {
+                break;
+            }
+            auto isDiverse = true;
+            for (auto& [_, selectedIdx] : selected) {
+                if (computeDistance(getVector(candidate.second), getVector(selectedIdx)) <
+                    candidate.first) {
+                    isDiverse = false;
+                    break;
+                }
+            }
+            if (isDiverse) {
+                selected.push_back(candidate);
+            }
+        }
+        return selected;
+    }
+
+    void setNeighbors(vector_idx_t idx, uint8_t level, const std::vector<candidate_t>& neighbors) {
+        auto lck = lockNeighbors(idx);
+        auto list = getNeighborList(idx, level);
+        list[0] = neighbors.size();
+        for (auto i = 0u; i < neighbors.size(); i++) {
+            list[i + 1] = neighbors[i].second;
+        }
+    }
+
+    // Adds a link from idx to neighbor. Once the list of idx is full, it is pruned again.
+    void addLink(vector_idx_t idx, vector_idx_t neighbor, uint8_t level) {
+        auto lck = lockNeighbors(idx);
+        auto list = getNeighborList(idx, level);
+        auto maxDegree = getMaxDegree(level);
+        if (list[0] < maxDegree) {
+            list[++list[0]] = neighbor;
+            return;
+        }
+        std::vector<candidate_t> candidates;
+        candidates.reserve(maxDegree + 1);
+        auto vector = getVector(idx);
+        for (auto i = 1u; i <= list[0]; i++) {
+            candidates.emplace_back(computeDistance(vector, getVector(list[i])), list[i]);
+        }
+        candidates.emplace_back(computeDistance(vector, getVector(neighbor)), neighbor);
+        auto neighbors = selectNeighbors(std::move(candidates), maxDegree);
+        list[0] = neighbors.size();
+        for (auto i = 0u; i < neighbors.size(); i++) {
+            list[i + 1] = neighbors[i].second;
+        }
+    }
+
+    template<typename VISITED>
+    void insert(vector_idx_t idx, VISITED& visited) {
+        auto level = levels[idx];
+        auto vector = getVector(idx);
+        // An insertion which raises the top level holds the lock until it is done, so that the
+        // entry point is linked in all layers once other insertions start from it.
+        std::unique_lock entryPointLck{entryPointMtx};
+        auto entry = entryPoint;
+        auto topLevel = maxLevel;
+        if (level <= topLevel) {
+            entryPointLck.unlock();
+        }
+        if (topLevel > level) {
+            entry = greedySearch(vector, entry, topLevel, level + 1);
+        }
+        for (auto currentLevel = (int64_t)std::min(level, topLevel); currentLevel >= 0;
+             currentLevel--) {
+            resetVisited(visited);
+            auto result = searchLayer(vector, entry, config.efConstruction, currentLevel, visited,
+                false /* excludeRemoved */);
+            std::vector<candidate_t> candidates;
+            candidates.reserve(result.size());
+            while (!result.empty()) {
+                candidates.push_back(result.top());
+                result.pop();
+            }
+            // The closest candidate is the entry point of the layer below.
+            entry = candidates.back().second;
+            auto neighbors = selectNeighbors(std::move(candidates), config.maxDegree);
+            setNeighbors(idx, currentLevel, neighbors);
+            for (auto& [_, neighbor] : neighbors) {
+                addLink(neighbor, idx, currentLevel);
+            }
+        }
+        if (level > topLevel) {
+            entryPoint = idx;
+            maxLevel = level;
+        }
+    }
+
+private:
+    uint64_t maxBottomDegree;
+    // Vectors stored one after another, in the order of nodeOffsets.
+    std::vector<T> vectors;
+    // Vectors [0, numInsertedVectors) are part of the graph.
+    uint64_t numInsertedVectors;
+    std::vector<uint8_t> levels;
+    std::vector<bool> isRemoved;
+    // Neighbor lists of the bottom layer, of maxBottomDegree + 1 slots per vector.
+    std::vector<vector_idx_t> bottomNeighbors;
+    // Neighbor lists of the layers [1, level] of each vector, of maxDegree + 1 slots per layer.
+    std::vector<std::vector<vector_idx_t>> upperNeighbors;
+    std::mutex entryPointMtx;
+    vector_idx_t entryPoint;
+    uint8_t maxLevel;
+    std::mt19937_64 levelGenerator;
+    // Locks of the neighbor lists of all vectors, while they are inserted by several threads.
+    std::unique_ptr<std::mutex[]> neighborLocks;
+};
+
+bool VectorIndex::isIndexableType(const LogicalType& type) {
+    if (type.getLogicalTypeID() != LogicalTypeID::ARRAY) {
+        return false;
+    }
+    auto childTypeID = ArrayType::getChildType(&type)->getLogicalTypeID();
+    return childTypeID == LogicalTypeID::FLOAT || childTypeID == LogicalTypeID::DOUBLE;
+}
+
+std::unique_ptr<VectorIndex> VectorIndex::create(const LogicalType& type,
+    const VectorIndexConfig& config) {
+    KU_ASSERT(isIndexableType(type));
+    auto dimension = ArrayType::getNumElements(&type);
+    switch (ArrayType::getChildType(&type)->getLogicalTypeID()) {
+    case LogicalTypeID::FLOAT:
+        return std::make_unique<HNSWIndex<float>>(dimension, config);
+    case LogicalTypeID::DOUBLE:
+        return std::make_unique<HNSWIndex<double>>(dimension, config);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool VectorIndexCache::containsIndex(Transaction* transaction, const Catalog& catalog,
+    table_id_t tableID, property_id_t propertyID) {
+    auto tableEntry = catalog.getTableCatalogEntry(transaction, tableID);
+    return tableEntry->getTableType() == TableType::NODE &&
+           ku_dynamic_cast<TableCatalogEntry*, NodeTableCatalogEntry*>(tableEntry)
+               ->hasVectorIndex(propertyID);
+}
+
+std::shared_ptr<VectorIndex> VectorIndexCache::getIndex(Transaction* transaction,
+    const Catalog& catalog, table_id_t tableID, property_id_t propertyID, uint64_t numThreads) {
+    if (!containsIndex(transaction, catalog, tableID, propertyID)) {
+        throw RuntimeException("Vector index does not exist.");
+    }
+    // Graphs only hold committed values and are dropped when the catalog changes.
+    if (!transaction->isReadOnly() &&
+        (catalog.hasUpdates() ||
+            transaction->getLocalStorage()->getLocalTable(tableID) != nullptr)) {
+        return loadIndex(transaction, catalog, tableID, propertyID, numThreads);
+    }
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock lck{mtx};
+        auto& cachedEntry = entries[{tableID, propertyID}];
+        if (cachedEntry == nullptr) {
+            cachedEntry = std::make_shared<Entry>();
+        }
+        entry = cachedEntry;
+    }
+    std::unique_lock lck{entry->mtx};
+    if (entry->index == nullptr) {
+        entry->index = loadIndex(transaction, catalog, tableID, propertyID, numThreads);
+    }
+    return entry->index;
+}
+
+static void insertLocalVectors(VectorIndex& index, LocalChunkedGroupCollection& localChunks,
+    column_id_t columnID, offset_t startNodeOffset) {
+    auto chunks = localChunks.getLocalChunk(columnID);
+    for (auto& [offset, rowIdx] : localChunks.getOffsetToRowIdx()) {
+        auto [chunkIdx, offsetInChunk] =
+            LocalChunkedGroupCollection::getChunkIdxAndOffsetInChunk(rowIdx);
+        index.insert(*chunks[chunkIdx], offsetInChunk, startNodeOffset + offset);
+    }
+}
+
+// Offsets in local node groups are relative to the start of their node groups.
+static void applyLocalChanges(VectorIndex& index, const LocalNodeTableData& localTableData,
+    column_id_t columnID, uint64_t numThreads) {
+    // Deleted nodes and nodes whose vector has been updated lose their vectors.
+    std::unordered_set<offset_t> nodeOffsetsToRemove;
+    for (auto& [nodeGroupIdx, localNodeGroup] : localTableData.getNodeGroups()) {
+        auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        for (auto offset : localNodeGroup->getDeleteInfo().getDeletedOffsets()) {
+            nodeOffsetsToRemove.insert(startNodeOffset + offset);
+        }
+        for (auto& [offset, _] : localNodeGroup->getUpdateChunks(columnID).getOffsetToRowIdx()) {
+            nodeOffsetsToRemove.insert(startNodeOffset + offset);
+        }
+    }
+    index.remove(nodeOffsetsToRemove);
+    // Inserted nodes and updated nodes get their new vectors. Updates of nodes inserted by the
+    // same transaction are applied to their inserted vectors.
+    for (auto& [nodeGroupIdx, localNodeGroup] : localTableData.getNodeGroups()) {
+        auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        insertLocalVectors(index, localNodeGroup->getInsertChunks(), columnID, startNodeOffset);
+        insertLocalVectors(index, localNodeGroup->getUpdateChunks(columnID), 0 /* columnID */,
+            startNodeOffset);
+    }
+    index.finalize(numThreads);
+}
+
+void VectorIndexCache::applyCommittedChanges(Transaction* transaction, const Catalog& catalog,
+    const std::unordered_set<table_id_t>& tableIDs, uint64_t numThreads) {
+    std::unique_lock lck{mtx};
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto [tableID, propertyID] = it->first;
+        if (!tableIDs.contains(tableID)) {
+            ++it;
+            continue;
+        }
+        auto& entry = *it->second;
+        std::unique_lock entryLck{entry.mtx};
+        auto localTable = transaction->getLocalStorage()->getLocalTable(tableID);
+        if (entry.index != nullptr && localTable != nullptr) {
+            auto columnID =
+                catalog.getTableCatalogEntry(transaction, tableID)->getColumnID(propertyID);
+            applyLocalChanges(*entry.index,
+                *ku_dynamic_cast<LocalTable*, LocalNodeTable*>(localTable)->getTableData(),
+                columnID, numThreads);
+            // Removed vectors still slow down searches, which pass through them.
+            if (entry.index->getNumRemovedVectors() * 2 <= entry.index->getNumVectors()) {
+                ++it;
+                continue;
+            }
+        }
+        entryLck.unlock();
+        it = entries.erase(it);
+    }
+}
+
+void VectorIndexCache::invalidate() {
+    std::unique_lock lck{mtx};
+    entries.clear();
+}
+
+std::unique_ptr<VectorIndex> VectorIndexCache::loadIndex(Transaction* transaction,
+    const Catalog& catalog, table_id_t tableID, property_id_t propertyID,
+    uint64_t numThreads) const {
+    auto column = NodePropertyIndexUtils::getColumn(transaction, catalog, storageManager,
+        tableID, propertyID);
+    auto tableEntry = ku_dynamic_cast<TableCatalogEntry*, NodeTableCatalogEntry*>(
+        catalog.getTableCatalogEntry(transaction, tableID));
+    auto index = VectorIndex::create(column->getDataType(),
+        tableEntry->getVectorIndexConfig(propertyID));
+    NodePropertyIndexUtils::scanColumn(transaction, storageManager, tableID, *column,
+        [&](const ColumnChunk& chunk, offset_t startNodeOffset, const std::vector<bool>& deleted) {
+            index->append(chunk, startNodeOffset, deleted);
+        });
+    index->finalize(numThreads);
+    return index;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -32,6 +32,9 @@ StorageManager::StorageManager(bool readOnly, const Catalog& catalog, MemoryMana
     relsStatistics = std::make_unique<RelsStoreStats>(metadataFH.get(),
         memoryManager.getBufferManager(), wal, vfs);
     loadTables(readOnly, catalog);
+    csrGraphCache = std::make_unique<CSRGraphCache>(*this);
+    propertyIndexCache = std::make_unique<PropertyIndexCache>(*this);
+    vectorIndexCache = std::make_unique<VectorIndexCache>(*this);
 }
 
 static void setCommonTableIDToRdfRelTable(RelTable* relTable,
@@ -144,6 +147,28 @@ void StorageManager::createTable(table_id_t tableID, Catalog* catalog, Transacti
     }
 }
 
+void StorageManager::flushAllDirtyPages() {
+    std::vector<BMFileHandle*> fileHandles{dataFH.get(), metadataFH.get()};
+    for (auto& [tableID, table] : tables) {
+        if (table->getTableType() != TableType::NODE) {
+            continue;
+        }
+        auto pkIndex = getPKIndex(tableID);
+        if (pkIndex == nullptr) {
+            continue;
+        }
+        fileHandles.push_back(pkIndex->getFileHandle());
+        if (pkIndex->getOverflowFile()) {
+            fileHandles.push_back(pkIndex->getOverflowFile()->getBMFileHandle());
+        }
+    }
+    auto bufferManager = memoryManager.getBufferManager();
+    for (auto fileHandle : fileHandles) {
+        bufferManager->flushAllDirtyPagesInFrames(*fileHandle);
+        fileHandle->getFileInfo()->syncFile();
+    }
+}
+
 PrimaryKeyIndex* StorageManager::getPKIndex(table_id_t tableID) {
     KU_ASSERT(tables.contains(tableID));
     KU_ASSERT(tables.at(tableID)->getTableType() == TableType::NODE);
@@ -230,6 +230,7 @@ Column::Column(std::string name, LogicalType dataType, const MetadataDAHInfo& me
     readToVectorFunc = getReadValuesToVectorFunc(this->dataType);
     readToPageFunc = ReadCompressedValuesFromPage(this->dataType);
     batchLookupFunc = ReadCompressedValuesFromPage(this->dataType);
+    filterFunc = FilterCompressedValuesFromPage(this->dataType);
     writeFromVectorFunc = getWriteValueFromVectorFunc(this->dataType);
     writeFunc = getWriteValuesFunc(this->dataType);
     KU_ASSERT(numBytesPerFixedSizedValue <= BufferPoolConstants::PAGE_4KB_SIZE);
@@ -281,6 +282,7 @@ void Column::initChunkState(Transaction* transaction, node_group_idx_t nodeGroup
         // due to lock acquiring in DiskArray.
         readState.nodeGroupIdx = nodeGroupIdx;
         readState.metadata = metadataDA->get(nodeGroupIdx, transaction->getType());
+        readState.readAheadEndPageIdx = 0;
         readState.numValuesPerPage =
             readState.metadata.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
     }
@@ -304,6 +306,7 @@ void Column::scan(Transaction* transaction, ChunkState& readState, offset_t star
     }
     auto pageCursor = getPageCursorForOffsetInGroup(startOffsetInGroup, readState);
     auto numValuesToScan = endOffsetInGroup - startOffsetInGroup;
+    readAhead(transaction, readState, pageCursor.pageIdx);
     scanUnfiltered(transaction, pageCursor, numValuesToScan, resultVector, readState.metadata,
         offsetInVector);
 }
@@ -339,10 +342,13 @@ void Column::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx, Colum
             auto numValuesToReadInPage = std::min(numValuesPerPage - cursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
             KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMetadata));
-            readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-                readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
-                    numValuesToReadInPage, chunkMetadata.compMeta);
-            });
+            readFromPage(
+                transaction, cursor.pageIdx,
+                [&](uint8_t* frame) -> void {
+                    readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
+                        numValuesToReadInPage, chunkMetadata.compMeta);
+                },
+                BufferManager::PagePriority::LOW);
             numValuesScanned += numValuesToReadInPage;
             cursor.nextPage();
         }
@@ -360,10 +366,13 @@ void Column::scan(Transaction* transaction, const ChunkState& state, offset_t st
         uint64_t numValuesToScanInPage =
             std::min((uint64_t)state.numValuesPerPage - cursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
-        readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
-                state.metadata.compMeta);
-        });
+        readFromPage(
+            transaction, cursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
+                    state.metadata.compMeta);
+            },
+            BufferManager::PagePriority::LOW);
         numValuesScanned += numValuesToScanInPage;
         cursor.nextPage();
     }
@@ -375,6 +384,7 @@ void Column::scanInternal(Transaction* transaction, ChunkState& readState,
         StorageUtils::getNodeGroupIdxAndOffsetInChunk(nodeIDVector->readNodeOffset(0));
     KU_ASSERT(nodeGroupIdx == readState.nodeGroupIdx);
     auto cursor = getPageCursorForOffsetInGroup(startOffsetInChunk, readState);
+    readAhead(transaction, readState, cursor.pageIdx);
     if (nodeIDVector->state->selVector->isUnfiltered()) {
         scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
             resultVector, readState.metadata);
@@ -394,10 +404,13 @@ void Column::scanUnfiltered(Transaction* transaction, PageCursor& pageCursor,
             std::min((uint64_t)numValuesPerPage - pageCursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
-        readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned + startPosInVector,
-                numValuesToScanInPage, chunkMeta.compMeta);
-        });
+        readFromPage(
+            transaction, pageCursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                readToVectorFunc(frame, pageCursor, resultVector,
+                    numValuesScanned + startPosInVector, numValuesToScanInPage, chunkMeta.compMeta);
+            },
+            BufferManager::PagePriority::LOW);
         numValuesScanned += numValuesToScanInPage;
         pageCursor.nextPage();
     }
@@ -417,10 +430,13 @@ void Column::scanFiltered(Transaction* transaction, PageCursor& pageCursor,
         if (isInRange(nodeIDVector->state->selVector->selectedPositions[posInSelVector],
                 numValuesScanned, numValuesScanned + numValuesToScanInPage)) {
             KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
-            readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-                readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned,
-                    numValuesToScanInPage, chunkMeta.compMeta);
-            });
+            readFromPage(
+                transaction, pageCursor.pageIdx,
+                [&](uint8_t* frame) -> void {
+                    readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned,
+                        numValuesToScanInPage, chunkMeta.compMeta);
+                },
+                BufferManager::PagePriority::LOW);
         }
         numValuesScanned += numValuesToScanInPage;
         pageCursor.nextPage();
@@ -432,6 +448,41 @@ void Column::scanFiltered(Transaction* transaction, PageCursor& pageCursor,
     }
 }
 
+sel_t Column::filter(Transaction* transaction, const ChunkState& state,
+    const ValueVector* nodeIDVector, const ZoneMapFilter& filter) {
+    KU_ASSERT(nodeIDVector->isSequential());
+    auto startOffsetInChunk =
+        StorageUtils::getNodeGroupIdxAndOffsetInChunk(nodeIDVector->readNodeOffset(0)).second;
+    auto cursor = getPageCursorForOffsetInGroup(startOffsetInChunk, state);
+    auto numValuesToFilter = nodeIDVector->state->getOriginalSize();
+    uint64_t numValuesFiltered = 0;
+    uint8_t result[DEFAULT_VECTOR_CAPACITY];
+    while (numValuesFiltered < numValuesToFilter) {
+        uint64_t numValuesToFilterInPage = std::min(state.numValuesPerPage - cursor.elemPosInPage,
+            numValuesToFilter - numValuesFiltered);
+        KU_ASSERT(isPageIdxValid(cursor.pageIdx, state.metadata));
+        readFromPage(
+            transaction, cursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                filterFunc(frame, cursor, result, numValuesFiltered, numValuesToFilterInPage,
+                    state.metadata.compMeta, filter);
+            },
+            BufferManager::PagePriority::LOW);
+        numValuesFiltered += numValuesToFilterInPage;
+        cursor.nextPage();
+    }
+    auto& selVector = *nodeIDVector->state->selVector;
+    auto buffer = selVector.getMultableBuffer();
+    sel_t numSelectedValues = 0;
+    for (auto i = 0u; i < selVector.selectedSize; i++) {
+        auto pos = selVector.selectedPositions[i];
+        buffer[numSelectedValues] = pos;
+        numSelectedValues += result[pos];
+    }
+    selVector.setToFiltered(numSelectedValues);
+    return numSelectedValues;
+}
+
 void Column::lookup(Transaction* transaction, ChunkState& readState, ValueVector* nodeIDVector,
     ValueVector* resultVector) {
     if (nullColumn) {
@@ -465,7 +516,7 @@ void Column::lookupValue(transaction::Transaction* transaction, ChunkState& read
 }
 
 void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, BufferManager::PagePriority pagePriority) {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
@@ -473,7 +524,32 @@ void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
     }
     auto [fileHandleToPin, pageIdxToPin] = DBFileUtils::getFileHandleAndPhysicalPageIdxToPin(
         *dataFH, pageIdx, *wal, transaction->getType());
-    bufferManager->optimisticRead(*fileHandleToPin, pageIdxToPin, func);
+    bufferManager->optimisticRead(*fileHandleToPin, pageIdxToPin, func, pagePriority);
+}
+
+void Column::readAhead(Transaction* transaction, ChunkState& state, page_idx_t pageIdx) {
+    // Write transactions may read pages from the WAL instead, and constant chunks have no pages.
+    if (!transaction->isReadOnly() || state.metadata.numPages == 0 ||
+        pageIdx < state.readAheadEndPageIdx) {
+        return;
+    }
+    auto chunkEndPageIdx = state.metadata.pageIdx + state.metadata.numPages;
+    if (pageIdx >= chunkEndPageIdx) {
+        return;
+    }
+    auto numPagesToLoad = std::min<page_idx_t>(StorageConstants::SCAN_READ_AHEAD_NUM_PAGES,
+        chunkEndPageIdx - pageIdx);
+    auto numPagesRead = bufferManager->prefetchPages(*dataFH, pageIdx, numPagesToLoad);
+    state.readAheadEndPageIdx = pageIdx + numPagesToLoad;
+    // If the pages had to be read from disk, let the file system read the following pages in the
+    // background, so that they are cached by the time the scan loads them.
+    auto numPagesToHint = std::min<page_idx_t>(StorageConstants::SCAN_READ_AHEAD_NUM_PAGES,
+        chunkEndPageIdx - state.readAheadEndPageIdx);
+    if (numPagesRead > 0 && numPagesToHint > 0) {
+        auto pageSize = dataFH->getPageSize();
+        dataFH->getFileInfo()->prefetch((uint64_t)state.readAheadEndPageIdx * pageSize,
+            (uint64_t)numPagesToHint * pageSize);
+    }
 }
 
 static bool sanityCheckForWrites(const ColumnChunkMetadata& metadata,
@@ -526,6 +602,8 @@ void Column::writeValue(ChunkState& state, offset_t offsetInChunk, ValueVector*
             writeFromVectorFunc(frame, posInPage, vectorToWriteFrom, posInVectorToWriteFrom,
                 state.metadata.compMeta);
         });
+    state.metadata.zoneMap.update(vectorToWriteFrom->getData(), posInVectorToWriteFrom,
+        dataType.getPhysicalType());
 }
 
 void Column::write(ChunkState& state, offset_t offsetInChunk, ColumnChunk* data,
@@ -557,6 +635,14 @@ void Column::writeValues(ChunkState& state, common::offset_t dstOffset, const ui
         numValuesWritten += numValuesToWriteInPage;
         cursor.nextPage();
     }
+    if (state.metadata.zoneMap.isValid) {
+        for (auto i = 0u; i < numValues; i++) {
+            if (nullChunkData && nullChunkData->isNull(srcOffset + i)) {
+                continue;
+            }
+            state.metadata.zoneMap.update(data, srcOffset + i, dataType.getPhysicalType());
+        }
+    }
 }
 
 // Apend to the end of the chunk.
@@ -140,6 +140,12 @@ static std::shared_ptr<CompressionAlg> getCompression(const LogicalType& dataTyp
     case PhysicalTypeID::UINT8: {
         return std::make_shared<IntegerBitpacking<uint8_t>>();
     }
+    case PhysicalTypeID::DOUBLE: {
+        return std::make_shared<FloatCompression<double>>();
+    }
+    case PhysicalTypeID::FLOAT: {
+        return std::make_shared<FloatCompression<float>>();
+    }
     default: {
         return std::make_shared<Uncompressed>(dataType);
     }
@@ -188,6 +194,8 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
     case PhysicalTypeID::INT128: {
         auto compression = getCompression(this->dataType, enableCompression);
         flushBufferFunction = CompressedFlushBuffer(compression, this->dataType);
@@ -386,22 +394,42 @@ bool ColumnChunk::sanityCheck() {
 
 ColumnChunkMetadata ColumnChunk::getMetadataToFlush() const {
     KU_ASSERT(numValues <= capacity);
+    ColumnChunkMetadata metadata;
+    std::optional<CompressionMetadata> constantMetadata;
     if (enableCompression) {
         // Determine if we can make use of constant compression
-        auto constantMetadata = ConstantCompression::analyze(*this);
-        if (constantMetadata) {
-            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
-        }
+        constantMetadata = ConstantCompression::analyze(*this);
     }
-    KU_ASSERT(bufferSize == getBufferSize(capacity));
-    return getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    if (constantMetadata) {
+        metadata = ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+    } else {
+        KU_ASSERT(bufferSize == getBufferSize(capacity));
+        metadata = getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    }
+    metadata.zoneMap = getZoneMap();
+    return metadata;
+}
+
+ZoneMap ColumnChunk::getZoneMap() const {
+    auto physicalType = dataType.getPhysicalType();
+    if (!ZoneMap::isSupported(physicalType)) {
+        return ZoneMap();
+    }
+    if (nullChunk) {
+        auto nullMask = nullChunk->getNullMask();
+        return ZoneMap::compute(buffer.get(), numValues, physicalType, &nullMask);
+    }
+    return ZoneMap::compute(buffer.get(), numValues, physicalType, nullptr /*nullMask*/);
 }
 
 ColumnChunkMetadata ColumnChunk::flushBuffer(BMFileHandle* dataFH, page_idx_t startPageIdx,
     const ColumnChunkMetadata& metadata) {
     if (!metadata.compMeta.isConstant()) {
         KU_ASSERT(bufferSize == getBufferSize(capacity));
-        return flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        auto flushedMetadata =
+            flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        flushedMetadata.zoneMap = metadata.zoneMap;
+        return flushedMetadata;
     }
     return metadata;
 }
@@ -0,0 +1,323 @@
+#include "storage/store/csr_graph.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/runtime.h"
+#include "storage/local_storage/local_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/chunked_node_group.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+bool GraphProjection::isFilterableType(LogicalTypeID typeID) {
+    switch (typeID) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static double getNumericValue(const ColumnChunk& chunk, offset_t pos) {
+    switch (chunk.getDataType().getLogicalTypeID()) {
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return chunk.getValue<int64_t>(pos);
+    case LogicalTypeID::INT32:
+        return chunk.getValue<int32_t>(pos);
+    case LogicalTypeID::INT16:
+        return chunk.getValue<int16_t>(pos);
+    case LogicalTypeID::INT8:
+        return chunk.getValue<int8_t>(pos);
+    case LogicalTypeID::UINT64:
+        return chunk.getValue<uint64_t>(pos);
+    case LogicalTypeID::UINT32:
+        return chunk.getValue<uint32_t>(pos);
+    case LogicalTypeID::UINT16:
+        return chunk.getValue<uint16_t>(pos);
+    case LogicalTypeID::UINT8:
+        return chunk.getValue<uint8_t>(pos);
+    case LogicalTypeID::DOUBLE:
+        return chunk.getValue<double>(pos);
+    case LogicalTypeID::FLOAT:
+        return chunk.getValue<float>(pos);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+CSRGraph::CSRGraph(GraphProjection projection, column_id_t filterColumnID, offset_t numNodes,
+    const std::vector<offset_t>& deletedNodeOffsets)
+    : projection{projection}, filterColumnID{filterColumnID}, numNodes{numNodes},
+      numDeletedNodes{0} {
+    deleted.resize(numNodes, false);
+    for (auto nodeOffset : deletedNodeOffsets) {
+        if (nodeOffset < numNodes && !deleted[nodeOffset]) {
+            deleted[nodeOffset] = true;
+            numDeletedNodes++;
+        }
+    }
+    auto numNodeGroups = (numNodes + StorageConstants::NODE_GROUP_SIZE - 1) >>
+                         StorageConstants::NODE_GROUP_SIZE_LOG2;
+    fwdCSRs.resize(numNodeGroups);
+    bwdCSRs.resize(numNodeGroups);
+}
+
+uint64_t CSRGraph::getNumRels() const {
+    uint64_t numRels = 0;
+    for (auto& csr : fwdCSRs) {
+        numRels += csr.nbrOffsets.size();
+    }
+    return numRels;
+}
+
+static std::unique_ptr<ColumnChunk> scanChunk(Transaction* transaction, Column* column,
+    node_group_idx_t nodeGroupIdx) {
+    auto numValues = column->getMetadata(nodeGroupIdx, transaction->getType()).numValues;
+    auto chunk = ColumnChunkFactory::createColumnChunk(column->getDataType(),
+        false /* enableCompression */, std::max<uint64_t>(numValues, 1));
+    column->scan(transaction, nodeGroupIdx, chunk.get());
+    return chunk;
+}
+
+static void loadCSR(Transaction* transaction, RelTableData* tableData,
+    const GraphProjection& projection, column_id_t filterColumnID, offset_t numNodesInGroup,
+    node_group_idx_t nodeGroupIdx,
+    std::vector<offset_t>& csrOffsets, std::vector<offset_t>& nbrOffsets,
+    std::vector<offset_t>& relOffsets) {
+    csrOffsets.assign(numNodesInGroup + 1, 0);
+    if (nodeGroupIdx >= tableData->getNbrIDColumn()->getNumNodeGroups(transaction)) {
+        return;
+    }
+    ChunkedCSRHeader header(false /* enableCompression */);
+    tableData->getCSROffsetColumn()->scan(transaction, nodeGroupIdx, header.offset.get());
+    tableData->getCSRLengthColumn()->scan(transaction, nodeGroupIdx, header.length.get());
+    auto nbrIDs = scanChunk(transaction, tableData->getNbrIDColumn(), nodeGroupIdx);
+    auto relIDs = scanChunk(transaction, tableData->getColumn(REL_ID_COLUMN_ID), nodeGroupIdx);
+    std::unique_ptr<ColumnChunk> filterValues;
+    if (projection.hasFilter()) {
+        filterValues =
+            scanChunk(transaction, tableData->getColumn(filterColumnID), nodeGroupIdx);
+    }
+    auto nbrIDData = reinterpret_cast<const offset_t*>(nbrIDs->getData());
+    auto relIDData = reinterpret_cast<const offset_t*>(relIDs->getData());
+    auto numNodesWithCSR = std::min<offset_t>(numNodesInGroup, header.length->getNumValues());
+    nbrOffsets.reserve(nbrIDs->getNumValues());
+    relOffsets.reserve(nbrIDs->getNumValues());
+    for (auto i = 0u; i < numNodesWithCSR; i++) {
+        auto startCSROffset = header.getStartCSROffset(i);
+        auto endCSROffset = startCSROffset + header.getCSRLength(i);
+        for (auto csrOffset = startCSROffset; csrOffset < endCSROffset; csrOffset++) {
+            if (filterValues != nullptr) {
+                if (filterValues->getNullChunk()->isNull(csrOffset)) {
+                    continue;
+                }
+                auto value = getNumericValue(*filterValues, csrOffset);
+                if (!(value >= projection.lowerBound && value <= projection.upperBound)) {
+                    continue;
+                }
+            }
+            nbrOffsets.push_back(nbrIDData[csrOffset]);
+            relOffsets.push_back(relIDData[csrOffset]);
+        }
+        csrOffsets[i + 1] = nbrOffsets.size();
+    }
+    for (auto i = numNodesWithCSR; i < numNodesInGroup; i++) {
+        csrOffsets[i + 1] = nbrOffsets.size();
+    }
+    nbrOffsets.shrink_to_fit();
+    relOffsets.shrink_to_fit();
+}
+
+void CSRGraph::loadNodeGroup(Transaction* transaction, RelTable* relTable,
+    node_group_idx_t nodeGroupIdx) {
+    auto startNodeOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    auto numNodesInGroup =
+        std::min<offset_t>(StorageConstants::NODE_GROUP_SIZE, numNodes - startNodeOffset);
+    for (auto direction : {RelDataDirection::FWD, RelDataDirection::BWD}) {
+        auto& csr = direction == RelDataDirection::FWD ? fwdCSRs[nodeGroupIdx] :
+                                                         bwdCSRs[nodeGroupIdx];
+        loadCSR(transaction, relTable->getDirectedTableData(direction), projection,
+            filterColumnID, numNodesInGroup, nodeGroupIdx, csr.csrOffsets, csr.nbrOffsets,
+            csr.relOffsets);
+    }
+}
+
+void CSRGraph::load(Transaction* transaction, RelTable* relTable) {
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < getNumNodeGroups(); nodeGroupIdx++) {
+        loadNodeGroup(transaction, relTable, nodeGroupIdx);
+    }
+}
+
+std::span<const offset_t> CSRGraph::getCSRSpan(offset_t nodeOffset, RelDataDirection direction,
+    bool isRel) const {
+    if (nodeOffset >= numNodes) {
+        return {};
+    }
+    auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(nodeOffset);
+    auto& csr =
+        direction == RelDataDirection::FWD ? fwdCSRs[nodeGroupIdx] : bwdCSRs[nodeGroupIdx];
+    auto offsetInGroup = nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    auto startCSROffset = csr.csrOffsets[offsetInGroup];
+    auto& offsets = isRel ? csr.relOffsets : csr.nbrOffsets;
+    return std::span<const offset_t>(offsets.data() + startCSROffset,
+        csr.csrOffsets[offsetInGroup + 1] - startCSROffset);
+}
+
+void CSRGraphCache::addProjection(const std::string& name, GraphProjection projection) {
+    std::unique_lock lck{mtx};
+    if (entries.contains(name)) {
+        throw RuntimeException(stringFormat("Projected graph {} already exists.", name));
+    }
+    entries.emplace(name, std::make_shared<Entry>(projection));
+}
+
+void CSRGraphCache::dropProjection(const std::string& name) {
+    std::unique_lock lck{mtx};
+    if (!entries.contains(name)) {
+        throw RuntimeException(stringFormat("Projected graph {} does not exist.", name));
+    }
+    entries.erase(name);
+}
+
+bool CSRGraphCache::containsProjection(const std::string& name) const {
+    std::unique_lock lck{mtx};
+    return entries.contains(name);
+}
+
+GraphProjection CSRGraphCache::getProjection(const std::string& name) const {
+    return getEntry(name)->projection;
+}
+
+std::string CSRGraphCache::getUnfilteredProjectionName(table_id_t relTableID) const {
+    std::unique_lock lck{mtx};
+    for (auto& [name, entry] : entries) {
+        if (entry->projection.relTableID == relTableID && !entry->projection.hasFilter()) {
+            return name;
+        }
+    }
+    return std::string();
+}
+
+std::shared_ptr<CSRGraph> CSRGraphCache::getCachedGraph(const std::string& name) const {
+    auto entry = getEntry(name);
+    std::unique_lock lck{entry->mtx};
+    return entry->graph;
+}
+
+std::shared_ptr<CSRGraph> CSRGraphCache::getGraph(Transaction* transaction,
+    const Catalog& catalog, const std::string& name) {
+    return getGraph(transaction, catalog, *getEntry(name));
+}
+
+std::shared_ptr<CSRGraph> CSRGraphCache::getUnfilteredGraph(Transaction* transaction,
+    const Catalog& catalog, table_id_t relTableID) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock lck{mtx};
+        for (auto& [_, entry_] : entries) {
+            if (entry_->projection.relTableID == relTableID && !entry_->projection.hasFilter()) {
+                entry = entry_;
+                break;
+            }
+        }
+    }
+    return entry == nullptr ? nullptr : getGraph(transaction, catalog, *entry);
+}
+
+void CSRGraphCache::cacheGraph(const std::string& name, std::shared_ptr<CSRGraph> graph) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock lck{mtx};
+        if (!entries.contains(name)) {
+            return;
+        }
+        entry = entries.at(name);
+    }
+    std::unique_lock lck{entry->mtx};
+    auto& projection = entry->projection;
+    auto& graphProjection = graph->getProjection();
+    if (projection.relTableID != graphProjection.relTableID ||
+        projection.filterPropertyID != graphProjection.filterPropertyID ||
+        projection.lowerBound != graphProjection.lowerBound ||
+        projection.upperBound != graphProjection.upperBound) {
+        return;
+    }
+    entry->graph = std::move(graph);
+}
+
+std::unique_ptr<CSRGraph> CSRGraphCache::createGraph(Transaction* transaction,
+    const Catalog& catalog, const GraphProjection& projection) const {
+    // Projections outlive the tables and properties they refer to.
+    auto relTableIDs = catalog.getRelTableIDs(transaction);
+    if (std::find(relTableIDs.begin(), relTableIDs.end(), projection.relTableID) ==
+        relTableIDs.end()) {
+        throw RuntimeException("Cannot load a projected graph whose rel table has been dropped.");
+    }
+    auto filterColumnID = INVALID_COLUMN_ID;
+    if (projection.hasFilter()) {
+        filterColumnID = catalog.getTableCatalogEntry(transaction, projection.relTableID)
+                             ->getColumnID(projection.filterPropertyID);
+        if (filterColumnID == INVALID_COLUMN_ID) {
+            throw RuntimeException(
+                "Cannot load a projected graph whose filter property has been dropped.");
+        }
+    }
+    auto nodeTable = ku_dynamic_cast<Table*, NodeTable*>(
+        storageManager.getTable(projection.nodeTableID));
+    auto numNodes = nodeTable->getMaxNodeOffset(transaction) + 1;
+    auto deletedNodeOffsets =
+        storageManager.getNodesStatisticsAndDeletedIDs()
+            ->getNodeStatisticsAndDeletedIDs(transaction, projection.nodeTableID)
+            ->getDeletedNodeOffsets();
+    return std::make_unique<CSRGraph>(projection, filterColumnID, numNodes, deletedNodeOffsets);
+}
+
+void CSRGraphCache::invalidate() {
+    std::unique_lock lck{mtx};
+    for (auto& [_, entry] : entries) {
+        std::unique_lock entryLck{entry->mtx};
+        entry->graph.reset();
+    }
+}
+
+std::shared_ptr<CSRGraph> CSRGraphCache::getGraph(Transaction* transaction,
+    const Catalog& catalog, Entry& entry) {
+    KU_ASSERT(transaction->isReadOnly());
+    std::unique_lock lck{entry.mtx};
+    if (entry.graph == nullptr) {
+        std::shared_ptr<CSRGraph> graph = createGraph(transaction, catalog, entry.projection);
+        graph->load(transaction, ku_dynamic_cast<Table*, RelTable*>(
+                                     storageManager.getTable(entry.projection.relTableID)));
+        entry.graph = std::move(graph);
+    }
+    return entry.graph;
+}
+
+std::shared_ptr<CSRGraphCache::Entry> CSRGraphCache::getEntry(const std::string& name) const {
+    std::unique_lock lck{mtx};
+    if (!entries.contains(name)) {
+        throw RuntimeException(stringFormat("Projected graph {} does not exist.", name));
+    }
+    return entries.at(name);
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -50,6 +50,41 @@ void NodeTable::read(Transaction* transaction, TableReadState& readState) {
     }
 }
 
+bool NodeTable::mayMatch(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ZoneMapFilter>& filters) {
+    if (!transaction->isReadOnly() || nodeGroupIdx >= getNumNodeGroups(transaction)) {
+        return true;
+    }
+    for (auto& filter : filters) {
+        auto metadata =
+            getColumn(filter.columnID)->getMetadata(nodeGroupIdx, transaction->getType());
+        if (!filter.mayMatch(metadata.zoneMap)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NodeTable::filter(Transaction* transaction, TableReadState& readState,
+    const std::vector<ZoneMapFilter>& filters) {
+    auto& dataReadState =
+        ku_dynamic_cast<TableDataReadState&, NodeDataReadState&>(*readState.dataReadState);
+    if (!transaction->isReadOnly() || !dataReadState.readFromPersistent ||
+        !readState.nodeIDVector->isSequential()) {
+        return true;
+    }
+    KU_ASSERT(readState.columnIDs.size() == filters.size());
+    for (auto i = 0u; i < filters.size(); i++) {
+        KU_ASSERT(readState.columnIDs[i] == filters[i].columnID);
+        if (getColumn(filters[i].columnID)
+                ->filter(transaction, dataReadState.columnReadStates[i], readState.nodeIDVector,
+                    filters[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 offset_t NodeTable::validateUniquenessConstraint(Transaction* tx,
     const std::vector<ValueVector*>& propertyVectors) {
     if (pkIndex == nullptr) {
@@ -0,0 +1,171 @@
+#include "storage/store/zone_map.h"
+
+#include <cmath>
+
+#include "common/null_mask.h"
+#include "common/type_utils.h"
+#include "common/types/value/value.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+concept ZoneMapType = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+template<typename T>
+using zone_map_value_t = std::conditional_t<std::floating_point<T>, double,
+    std::conditional_t<std::signed_integral<T>, int64_t, uint64_t>>;
+
+template<typename T>
+static inline T& getValue(ZoneMapValue& value) {
+    if constexpr (std::same_as<T, double>) {
+        return value.floatVal;
+    } else if constexpr (std::same_as<T, int64_t>) {
+        return value.signedInt;
+    } else {
+        return value.unsignedInt;
+    }
+}
+
+template<typename T>
+static inline T getValue(const ZoneMapValue& value) {
+    return getValue<T>(const_cast<ZoneMapValue&>(value));
+}
+
+template<ZoneMapType T>
+static inline ZoneMapValue toZoneMapValue(T value) {
+    ZoneMapValue result;
+    getValue<zone_map_value_t<T>>(result) = value;
+    return result;
+}
+
+template<typename T>
+static inline bool isNaN(T value) {
+    if constexpr (std::floating_point<T>) {
+        return std::isnan(value);
+    } else {
+        return false;
+    }
+}
+
+template<typename T>
+static bool mayMatch(ExpressionType comparison, T min, T max, T literal) {
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+        return min <= literal && literal <= max;
+    case ExpressionType::NOT_EQUALS:
+        return min != literal || max != literal;
+    case ExpressionType::GREATER_THAN:
+        return max > literal;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return max >= literal;
+    case ExpressionType::LESS_THAN:
+        return min < literal;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return min <= literal;
+    default:
+        return true;
+    }
+}
+
+void ZoneMap::update(const uint8_t* data, offset_t pos, PhysicalTypeID physicalType) {
+    if (!isValid) {
+        return;
+    }
+    TypeUtils::visit(
+        physicalType,
+        [&]<ZoneMapType T>(T) {
+            using U = zone_map_value_t<T>;
+            auto value = ((const T*)data)[pos];
+            if (isNaN(value)) {
+                isValid = false;
+                return;
+            }
+            getValue<U>(min) = std::min<U>(getValue<U>(min), value);
+            getValue<U>(max) = std::max<U>(getValue<U>(max), value);
+        },
+        [&](auto) { isValid = false; });
+}
+
+bool ZoneMap::mayMatch(ExpressionType comparison, ZoneMapValue literal,
+    PhysicalTypeID physicalType) const {
+    KU_ASSERT(isValid);
+    bool result = true;
+    TypeUtils::visit(
+        physicalType,
+        [&]<ZoneMapType T>(T) {
+            using U = zone_map_value_t<T>;
+            result = storage::mayMatch<U>(comparison, getValue<U>(min), getValue<U>(max),
+                getValue<U>(literal));
+        },
+        [](auto) {});
+    return result;
+}
+
+bool ZoneMap::isSupported(PhysicalTypeID physicalType) {
+    bool result = false;
+    TypeUtils::visit(
+        physicalType, [&]<ZoneMapType T>(T) { result = true; }, [](auto) {});
+    return result;
+}
+
+ZoneMap ZoneMap::compute(const uint8_t* data, uint64_t numValues, PhysicalTypeID physicalType,
+    const NullMask* nullMask) {
+    ZoneMap zoneMap;
+    TypeUtils::visit(
+        physicalType,
+        [&]<ZoneMapType T>(T) {
+            using U = zone_map_value_t<T>;
+            auto values = (const T*)data;
+            auto hasValue = false;
+            U min{}, max{};
+            for (auto i = 0u; i < numValues; i++) {
+                if (nullMask && nullMask->isNull(i)) {
+                    continue;
+                }
+                U value = values[i];
+                if (isNaN(value)) {
+                    return;
+                }
+                min = hasValue ? std::min(min, value) : value;
+                max = hasValue ? std::max(max, value) : value;
+                hasValue = true;
+            }
+            if (hasValue) {
+                zoneMap.isValid = true;
+                getValue<U>(zoneMap.min) = min;
+                getValue<U>(zoneMap.max) = max;
+            }
+        },
+        [](auto) {});
+    return zoneMap;
+}
+
+std::optional<ZoneMapFilter> ZoneMapFilter::create(column_id_t columnID, ExpressionType comparison,
+    const Value& literal) {
+    if (!isExpressionComparison(comparison) || literal.isNull()) {
+        return std::nullopt;
+    }
+    std::optional<ZoneMapValue> value;
+    TypeUtils::visit(
+        literal.getDataType()->getLogicalTypeID(),
+        [&]<ZoneMapType T>(T) {
+            auto literalValue = literal.getValue<T>();
+            if (!isNaN(literalValue)) {
+                value = toZoneMapValue(literalValue);
+            }
+        },
+        [&](date_t) { value = toZoneMapValue(literal.getValue<date_t>().days); },
+        [&]<std::derived_from<timestamp_t> T>(
+            T) { value = toZoneMapValue(literal.getValue<T>().value); },
+        [](auto) {});
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    return ZoneMapFilter{columnID, comparison, literal.getDataType()->getPhysicalType(), *value};
+}
+
+} // namespace storage
+} // namespace kuzu
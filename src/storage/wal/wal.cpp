@@ -19,7 +19,8 @@ namespace storage {
 WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManager,
     VirtualFileSystem* vfs)
     : directory{directory}, bufferManager{bufferManager}, vfs{vfs}, isEmpty{true},
-      isLastRecordCommit{false} {
+      isLastRecordCommit{false}, hasRecordsRequiringCheckpoint{false}, committedRecordsSize{0},
+      numCommittedShadowPages{0} {
     auto fileInfo =
         vfs->openFile(vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)),
             readOnly ? O_RDONLY : O_CREAT | O_RDWR);
@@ -29,7 +30,7 @@ WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManag
         readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
                    FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS,
         BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs);
-    initialize();
+    initialize(readOnly);
 }
 
 WAL::~WAL() {
@@ -60,11 +61,10 @@ page_idx_t WAL::logPageInsertRecord(DBFileID dbFileID, page_idx_t pageIdxInOrigi
 
 void WAL::logCommit(uint64_t transactionID) {
     lock_t lck{mtx};
-    // Flush all pages before committing to make sure that commits only show up in the file when
-    // their data is also written.
-    flushAllPages();
     CommitRecord walRecord(transactionID);
     addNewWALRecordNoLock(walRecord);
+    bufferedWriter->flush();
+    bufferedWriter->getFileInfo().syncFile();
 }
 
 void WAL::logTableStatisticsRecord(TableType tableType) {
@@ -135,21 +135,68 @@ void WAL::clearWAL() {
     bufferedWriter->resetOffsets();
     isEmpty = true;
     isLastRecordCommit = false;
+    hasRecordsRequiringCheckpoint = false;
+    committedRecordsSize = 0;
+    numCommittedShadowPages = 0;
+    StorageUtils::removeAllWALFiles(directory);
+    updatedTables.clear();
+}
+
+void WAL::deferCheckpoint() {
+    KU_ASSERT(isLastRecordCommit && getRecordsSize() == bufferedWriter->getFileOffset());
+    committedRecordsSize = bufferedWriter->getFileOffset();
+    numCommittedShadowPages = shadowingFH->getNumPages();
+    hasRecordsRequiringCheckpoint = false;
+    // The table statistics files have been overwritten by their WAL versions.
+    StorageUtils::removeAllWALFiles(directory);
+    updatedTables.clear();
+}
+
+void WAL::clearUncommittedRecords() {
+    if (committedRecordsSize == 0) {
+        clearWAL();
+        return;
+    }
+    for (auto pageIdx = numCommittedShadowPages; pageIdx < shadowingFH->getNumPages(); ++pageIdx) {
+        bufferManager.removePageFromFrameIfNecessary(*shadowingFH, pageIdx);
+    }
+    shadowingFH->removePageIdxAndTruncateIfNecessary(numCommittedShadowPages);
+    shadowingFH->getFileInfo()->truncate(
+        numCommittedShadowPages * BufferPoolConstants::PAGE_4KB_SIZE);
+    bufferedWriter->getFileInfo().truncate(committedRecordsSize);
+    bufferedWriter->resetOffsets(committedRecordsSize);
+    isLastRecordCommit = true;
+    hasRecordsRequiringCheckpoint = false;
     StorageUtils::removeAllWALFiles(directory);
     updatedTables.clear();
 }
 
-void WAL::flushAllPages() {
+void WAL::flushAllPages(bool shouldSync) {
     bufferedWriter->flush();
     bufferManager.flushAllDirtyPagesInFrames(*shadowingFH);
-    bufferedWriter->getFileInfo().syncFile();
+    if (shouldSync) {
+        shadowingFH->getFileInfo()->syncFile();
+        bufferedWriter->getFileInfo().syncFile();
+    }
 }
 
 bool WAL::isEmptyWAL() const {
     return isEmpty;
 }
 
-void WAL::initialize() {
+bool WAL::hasOnlyDeferredRecords() const {
+    return committedRecordsSize > 0 && getRecordsSize() == committedRecordsSize;
+}
+
+uint64_t WAL::getRecordsSize() const {
+    return bufferedWriter->getFileSize();
+}
+
+uint64_t WAL::getSizeInBytes() const {
+    return getRecordsSize() + shadowingFH->getNumPages() * BufferPoolConstants::PAGE_4KB_SIZE;
+}
+
+void WAL::initialize(bool readOnly) {
     auto& fileInfo = bufferedWriter->getFileInfo();
     auto walFileLength = fileInfo.getFileSize();
     if (walFileLength == 0) {
@@ -157,20 +204,34 @@ void WAL::initialize() {
         isEmpty = true;
         return;
     }
-    // Read the last record to check if it is a COMMIT_RECORD.
-    std::unique_ptr<WALRecord> walRecord;
+    // Find the end of the last COMMIT_RECORD. As checkpoints may be deferred, the WAL can hold
+    // multiple committed transactions, possibly followed by the records of a transaction which
+    // has not committed.
+    uint64_t lastCommitEndOffset = 0;
     try {
-        Deserializer deserializer(std::make_unique<BufferedFileReader>(vfs->openFile(
-            vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)), O_RDONLY)));
+        auto reader = std::make_unique<BufferedFileReader>(vfs->openFile(
+            vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)), O_RDONLY));
+        auto readerPtr = reader.get();
+        Deserializer deserializer(std::move(reader));
         while (!deserializer.finished()) {
-            walRecord = WALRecord::deserialize(deserializer);
+            auto walRecord = WALRecord::deserialize(deserializer);
+            if (walRecord->type == WALRecordType::COMMIT_RECORD) {
+                lastCommitEndOffset = readerPtr->getReadOffset();
+            }
         }
     } catch (const Exception& e) {
         throw RuntimeException(
             stringFormat("Failed to read the last record from WAL file. Error: {}", e.what()));
     }
-    if (walRecord->type != WALRecordType::COMMIT_RECORD) {
-        // The last record is not a COMMIT record. Nothing to replay.
+    if (lastCommitEndOffset < walFileLength && !readOnly) {
+        // Records and table statistics files of the transaction which has not committed are
+        // discarded.
+        fileInfo.truncate(lastCommitEndOffset);
+        StorageUtils::removeAllWALFiles(directory);
+    }
+    committedRecordsSize = lastCommitEndOffset;
+    if (lastCommitEndOffset == 0) {
+        // There is no COMMIT record. Nothing to replay.
         isLastRecordCommit = false;
         return;
     }
@@ -183,6 +244,14 @@ void WAL::addNewWALRecordNoLock(WALRecord& walRecord) {
     Serializer serializer(bufferedWriter);
     walRecord.serialize(serializer);
     isLastRecordCommit = walRecord.type == WALRecordType::COMMIT_RECORD;
+    switch (walRecord.type) {
+    case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD:
+    case WALRecordType::TABLE_STATISTICS_RECORD:
+    case WALRecordType::COMMIT_RECORD:
+        break;
+    default:
+        hasRecordsRequiringCheckpoint = true;
+    }
 }
 
 } // namespace storage
@@ -19,13 +19,18 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace storage {
 
-// COMMIT_CHECKPOINT:   isCheckpoint = true,  isRecovering = false
-// ROLLBACK:            isCheckpoint = false, isRecovering = false
-// RECOVERY_CHECKPOINT: isCheckpoint = true,  isRecovering = true
+// COMMIT_CHECKPOINT:          isCheckpoint = true,  isRecovering = false
+// COMMIT_DEFERRED_CHECKPOINT: isCheckpoint = true,  isRecovering = false, isCheckpointDeferred
+// ROLLBACK:                   isCheckpoint = false, isRecovering = false
+// RECOVERY_CHECKPOINT:        isCheckpoint = true,  isRecovering = true
+// Recovery replays the records of all committed transactions. Otherwise, only the records of the
+// active write transaction are replayed.
 WALReplayer::WALReplayer(WAL* wal, StorageManager* storageManager, BufferManager* bufferManager,
     Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs)
     : isRecovering{replayMode == WALReplayMode::RECOVERY_CHECKPOINT},
-      isCheckpoint{replayMode != WALReplayMode::ROLLBACK}, storageManager{storageManager},
+      isCheckpoint{replayMode != WALReplayMode::ROLLBACK},
+      isCheckpointDeferred{replayMode == WALReplayMode::COMMIT_DEFERRED_CHECKPOINT},
+      storageManager{storageManager},
       bufferManager{bufferManager}, vfs{vfs}, wal{wal}, catalog{catalog} {
     init();
 }
@@ -41,21 +46,28 @@ void WALReplayer::replay() {
         throw StorageException(
             "Cannot checkpointInMemory WAL because last logged record is not a commit record.");
     }
+    KU_ASSERT(!isCheckpointDeferred || wal->canDeferCheckpoint());
     if (!isRecovering) {
-        // Make sure wal is flushed to disk before we start to replay it.
-        wal->flushAllPages();
+        // Make sure wal is written to disk before we start to replay it. Committed transactions
+        // have already synced it.
+        wal->flushAllPages(false /* shouldSync */);
     }
     auto fileInfo = vfs->openFile(
         vfs->joinPath(wal->getDirectory(), StorageConstants::WAL_FILE_SUFFIX), O_RDONLY);
     auto walFileSize = fileInfo->getFileSize();
+    auto startOffset = isRecovering ? 0 : wal->getCommittedRecordsSize();
+    auto endOffset = isRecovering ? wal->getCommittedRecordsSize() : walFileSize;
     // Check if the wal file is empty or corrupted. so nothing to read.
-    if (walFileSize == 0) {
+    if (walFileSize == 0 || startOffset >= endOffset) {
         return;
     }
     try {
-        Deserializer deserializer(std::make_unique<BufferedFileReader>(std::move(fileInfo)));
+        auto reader = std::make_unique<BufferedFileReader>(std::move(fileInfo));
+        reader->seek(startOffset);
+        auto readerPtr = reader.get();
+        Deserializer deserializer(std::move(reader));
         std::unordered_map<DBFileID, std::unique_ptr<FileInfo>> fileCache;
-        while (!deserializer.finished()) {
+        while (!deserializer.finished() && readerPtr->getReadOffset() < endOffset) {
             auto walRecord = WALRecord::deserialize(deserializer);
             replayWALRecord(*walRecord, fileCache);
         }
@@ -113,25 +125,28 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord,
 void WALReplayer::replayPageUpdateOrInsertRecord(const WALRecord& walRecord,
     std::unordered_map<DBFileID, std::unique_ptr<FileInfo>>& fileCache) {
     // 1. As the first step we copy over the page on disk, regardless of if we are recovering
-    // (and checkpointing) or checkpointing while during regular execution.
+    // (and checkpointing) or checkpointing while during regular execution, unless the checkpoint
+    // is deferred.
     auto& pageInsertOrUpdateRecord =
         ku_dynamic_cast<const WALRecord&, const PageUpdateOrInsertRecord&>(walRecord);
     auto dbFileID = pageInsertOrUpdateRecord.dbFileID;
-    auto entry = fileCache.find(dbFileID);
-    if (entry == fileCache.end()) {
-        fileCache.insert(std::make_pair(dbFileID,
-            StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs)));
-        entry = fileCache.find(dbFileID);
-    }
-    auto& fileInfoOfDBFile = entry->second;
     if (isCheckpoint) {
         if (!wal->isLastLoggedRecordCommit()) {
             // Nothing to undo.
             return;
         }
         wal->shadowingFH->readPage(pageBuffer.get(), pageInsertOrUpdateRecord.pageIdxInWAL);
-        fileInfoOfDBFile->writeFile(pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE,
-            pageInsertOrUpdateRecord.pageIdxInOriginalFile * BufferPoolConstants::PAGE_4KB_SIZE);
+        if (!isCheckpointDeferred) {
+            auto entry = fileCache.find(dbFileID);
+            if (entry == fileCache.end()) {
+                fileCache.insert(std::make_pair(dbFileID,
+                    StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs)));
+                entry = fileCache.find(dbFileID);
+            }
+            entry->second->writeFile(pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE,
+                pageInsertOrUpdateRecord.pageIdxInOriginalFile *
+                    BufferPoolConstants::PAGE_4KB_SIZE);
+        }
     }
     if (!isRecovering) {
         // 2: If we are not recovering, we do any in-memory checkpointing or rolling back work
@@ -197,8 +212,9 @@ void WALReplayer::replayCatalogRecord() {
             catalog->checkpointInMemory();
         }
     } else {
-        // Since DDL statements are single statements that are auto committed, it is impossible
-        // for users to roll back a DDL statement.
+        // DDL statements are auto committed, but indexes are created and dropped by write
+        // transactions, which may be rolled back.
+        catalog->rollbackInMemory();
     }
 }
 
@@ -345,7 +361,16 @@ void WALReplayer::checkpointOrRollbackVersionedFileHandleAndBufferManager(
         ku_dynamic_cast<const WALRecord&, const PageUpdateOrInsertRecord&>(walRecord);
     if (fileHandle) {
         fileHandle->clearWALPageIdxIfNecessary(pageInsertOrUpdateRecord.pageIdxInOriginalFile);
-        if (isCheckpoint) {
+        if (isCheckpointDeferred) {
+            // The frame becomes the only up-to-date copy of the page outside the WAL, and is
+            // written back when it is evicted or at the next checkpoint.
+            auto pageIdx = pageInsertOrUpdateRecord.pageIdxInOriginalFile;
+            auto frame = bufferManager->pin(*fileHandle, pageIdx,
+                BufferManager::PageReadPolicy::DONT_READ_PAGE);
+            memcpy(frame, pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE);
+            fileHandle->setLockedPageDirty(pageIdx);
+            bufferManager->unpin(*fileHandle, pageIdx);
+        } else if (isCheckpoint) {
             // Update the page in buffer manager if it is in a frame. Note that we assume
             // that the pageBuffer currently contains the contents of the WALVersion, so the
             // caller needs to make sure that this assumption holds.
@@ -37,7 +37,8 @@ void TransactionContext::beginAutoTransaction(bool readOnlyStatement) {
         activeTransaction.reset();
     }
     beginTransactionInternal(
-        readOnlyStatement ? TransactionType::READ_ONLY : TransactionType::WRITE);
+        readOnlyStatement ? TransactionType::READ_ONLY : TransactionType::WRITE,
+        true /* shouldWaitForActiveWriteTransaction */);
 }
 
 void TransactionContext::validateManualTransaction(bool allowActiveTransaction,
@@ -88,7 +89,8 @@ void TransactionContext::rollbackInternal(bool skipCheckPointing) {
     mode = TransactionMode::AUTO;
 }
 
-void TransactionContext::beginTransactionInternal(TransactionType transactionType) {
+void TransactionContext::beginTransactionInternal(TransactionType transactionType,
+    bool shouldWaitForActiveWriteTransaction) {
     if (activeTransaction) {
         throw TransactionManagerException(
             "Connection already has an active transaction. Applications can have one "
@@ -104,7 +106,8 @@ void TransactionContext::beginTransactionInternal(TransactionType transactionTyp
     } break;
     case TransactionType::WRITE: {
         activeTransaction =
-            clientContext.getDatabase()->transactionManager->beginWriteTransaction(clientContext);
+            clientContext.getDatabase()->transactionManager->beginWriteTransaction(clientContext,
+                shouldWaitForActiveWriteTransaction);
     } break;
     default:
         KU_UNREACHABLE;
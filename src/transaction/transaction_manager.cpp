@@ -1,5 +1,6 @@
 #include "transaction/transaction_manager.h"
 
+#include <chrono>
 #include <thread>
 
 #include "common/exception/transaction_manager.h"
@@ -10,20 +11,34 @@ namespace kuzu {
 namespace transaction {
 
 std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction(
-    main::ClientContext& clientContext) {
-    // We obtain the lock for starting new transactions. In case this cannot be obtained this
-    // ensures calls to other public functions is not restricted.
-    lock_t newTransactionLck{mtxForStartingNewTransactions};
-    lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
-    if (hasActiveWriteTransactionNoLock()) {
-        throw TransactionManagerException(
-            "Cannot start a new write transaction in the system. Only one write transaction at a "
-            "time is allowed in the system.");
+    main::ClientContext& clientContext, bool shouldWait) {
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(writeTransactionWaitTimeoutInMicros);
+    while (true) {
+        if (shouldWait) {
+            // The lock for starting new transactions is not held while waiting, so that read-only
+            // transactions can still start.
+            lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+            cvForActiveWriteTransaction.wait_until(publicFunctionLck, deadline,
+                [&]() { return !hasActiveWriteTransactionNoLock(); });
+        }
+        // We obtain the lock for starting new transactions. In case this cannot be obtained this
+        // ensures calls to other public functions is not restricted.
+        lock_t newTransactionLck{mtxForStartingNewTransactions};
+        lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+        if (!hasActiveWriteTransactionNoLock()) {
+            auto transaction = std::make_unique<Transaction>(clientContext,
+                TransactionType::WRITE, ++lastTransactionID);
+            activeWriteTransactionID = lastTransactionID;
+            return transaction;
+        }
+        // Another waiting write transaction may have started first.
+        if (!shouldWait || std::chrono::steady_clock::now() >= deadline) {
+            throw TransactionManagerException(
+                "Cannot start a new write transaction in the system. Only one write transaction "
+                "at a time is allowed in the system.");
+        }
     }
-    auto transaction =
-        std::make_unique<Transaction>(clientContext, TransactionType::WRITE, ++lastTransactionID);
-    activeWriteTransactionID = lastTransactionID;
-    return transaction;
 }
 
 std::unique_ptr<Transaction> TransactionManager::beginReadOnlyTransaction(
@@ -87,6 +102,18 @@ void TransactionManager::allowReceivingNewTransactions() {
     mtxForStartingNewTransactions.unlock();
 }
 
+bool TransactionManager::stopNewTransactionsIfNoActiveTransaction() {
+    if (!mtxForStartingNewTransactions.try_lock()) {
+        return false;
+    }
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    if (hasActiveWriteTransactionNoLock() || !activeReadOnlyTransactionIDs.empty()) {
+        mtxForStartingNewTransactions.unlock();
+        return false;
+    }
+    return true;
+}
+
 void TransactionManager::stopNewTransactionsAndWaitUntilAllReadTransactionsLeave() {
     mtxForStartingNewTransactions.lock();
     lock_t lck{mtxForSerializingPublicFunctionCalls};
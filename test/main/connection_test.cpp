@@ -47,6 +47,28 @@ TEST_F(ApiTest, ParallelConnect) {
     }
 }
 
+static void parallel_insert(Database* database, int64_t startID) {
+    auto conn = std::make_unique<Connection>(database);
+    for (auto i = 0; i < 10; ++i) {
+        auto result = conn->query("CREATE (:person {ID: " + std::to_string(startID + i) + "})");
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+}
+
+TEST_F(ApiTest, ParallelAutoCommitWriteTransactions) {
+    const auto numThreads = 4u;
+    std::thread threads[numThreads];
+    for (auto i = 0u; i < numThreads; ++i) {
+        threads[i] = std::thread(parallel_insert, database.get(), 1000 + i * 100);
+    }
+    for (auto i = 0u; i < numThreads; ++i) {
+        threads[i].join();
+    }
+    auto result = conn->query("MATCH (a:person) WHERE a.ID >= 1000 RETURN COUNT(*)");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 40);
+}
+
 TEST_F(ApiTest, CommitRollbackRemoveActiveTransaction) {
     ASSERT_TRUE(conn->query("BEGIN TRANSACTION;")->isSuccess());
     ASSERT_TRUE(conn->query("ROLLBACK;")->isSuccess());
@@ -128,6 +150,50 @@ TEST_F(ApiTest, MultipleQuery) {
     ASSERT_EQ(result->getNextQueryResult()->toString(), "3\n3\n");
 }
 
+TEST_F(ApiTest, StreamingResults) {
+    ASSERT_TRUE(conn->query("CALL stream_results=true")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 10000) AS x RETURN x");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_THROW(result->getNumTuples(), RuntimeException);
+    int64_t numTuples = 0, sum = 0;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 10000);
+    ASSERT_EQ(sum, 50005000);
+    // Results of multiple statements are materialized.
+    result = conn->query("RETURN 1; RETURN 2;");
+    ASSERT_EQ(result->getNumTuples(), 1);
+    ASSERT_EQ(result->getNextQueryResult()->getNumTuples(), 1);
+}
+
+TEST_F(ApiTest, StreamingResultsStopReading) {
+    ASSERT_TRUE(conn->query("CALL stream_results=true")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 10000) AS x RETURN x");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // The next query over the connection finishes the streamed one.
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1000})")->isSuccess());
+    ASSERT_THROW(
+        {
+            while (result->hasNext()) {
+                result->getNext();
+            }
+        },
+        RuntimeException);
+    result = conn->query("MATCH (a:person) WHERE a.ID = 1000 RETURN COUNT(*)");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // Dropping a partially read result finishes the query, so that its transaction does not block
+    // writes over other connections.
+    result = conn->query("UNWIND range(1, 10000) AS x RETURN x");
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    auto newConn = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(newConn->query("CREATE (:person {ID: 1001})")->isSuccess());
+}
+
 TEST_F(ApiTest, SingleQueryHasNextQueryResult) {
     auto result = conn->query("MATCH (a:person) RETURN a.fName;");
     ASSERT_TRUE(result->isSuccess());
@@ -2,6 +2,7 @@
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_plan_util.h"
+#include "planner/operator/scan/logical_property_index_scan.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 #include "test_runner/test_runner.h"
 
@@ -21,6 +22,23 @@ public:
     std::shared_ptr<planner::LogicalOperator> getRoot(const std::string& query) {
         return TestRunner::getLogicalPlan(query, *conn)->getLastOperator();
     }
+
+    // Returns the first operator of the given type in the plan of the query, or nullptr.
+    std::shared_ptr<planner::LogicalOperator> findOperator(const std::string& query,
+        planner::LogicalOperatorType type) {
+        std::vector<std::shared_ptr<planner::LogicalOperator>> ops{getRoot(query)};
+        while (!ops.empty()) {
+            auto op = ops.back();
+            ops.pop_back();
+            if (op->getOperatorType() == type) {
+                return op;
+            }
+            for (auto i = 0u; i < op->getNumChildren(); i++) {
+                ops.push_back(op->getChild(i));
+            }
+        }
+        return nullptr;
+    }
 };
 
 TEST_F(OptimizerTest, CrossJoinWithFilterWithoutPushDownTest) {
@@ -138,5 +156,41 @@ TEST_F(OptimizerTest, RecursiveJoinNoTrackPathTest) {
     ASSERT_TRUE(recursiveExtend->getJoinType() == planner::RecursiveJoinType::TRACK_NONE);
 }
 
+TEST_F(OptimizerTest, PropertyIndexScanTest) {
+    auto pointQuery = "MATCH (a:person) WHERE a.age = 35 RETURN a.fName;";
+    auto rangeQuery = "MATCH (a:person) WHERE a.age > 20 AND a.age <= 45 RETURN a.fName;";
+    auto indexScanType = planner::LogicalOperatorType::PROPERTY_INDEX_SCAN;
+    ASSERT_EQ(findOperator(pointQuery, indexScanType), nullptr);
+    ASSERT_TRUE(conn->query("CALL create_property_index('person', 'age') RETURN *")->isSuccess());
+    auto op = findOperator(pointQuery, indexScanType);
+    ASSERT_NE(op, nullptr);
+    auto indexScan = (planner::LogicalPropertyIndexScan*)op.get();
+    ASSERT_TRUE(indexScan->getLowerBound().inclusive && indexScan->getUpperBound().inclusive);
+    op = findOperator(rangeQuery, indexScanType);
+    ASSERT_NE(op, nullptr);
+    indexScan = (planner::LogicalPropertyIndexScan*)op.get();
+    ASSERT_FALSE(indexScan->getLowerBound().isUnbounded());
+    ASSERT_FALSE(indexScan->getLowerBound().inclusive);
+    ASSERT_FALSE(indexScan->getUpperBound().isUnbounded());
+    ASSERT_TRUE(indexScan->getUpperBound().inclusive);
+    ASSERT_EQ(findOperator("MATCH (a:person) WHERE a.age <> 35 RETURN a.fName;", indexScanType),
+        nullptr);
+    // Snapshots only hold committed values, so write transactions scan the table. So do
+    // statements prepared before, whose index scans fall back to scanning all nodes.
+    auto preparedStatement = conn->prepare(rangeQuery);
+    ASSERT_NE(findOperator(rangeQuery, indexScanType), nullptr);
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION")->isSuccess());
+    ASSERT_EQ(findOperator(pointQuery, indexScanType), nullptr);
+    auto result = conn->execute(preparedStatement.get());
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 5);
+    ASSERT_TRUE(conn->query("COMMIT")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL drop_property_index('person', 'age') RETURN *")->isSuccess());
+    ASSERT_EQ(findOperator(pointQuery, indexScanType), nullptr);
+    result = conn->execute(preparedStatement.get());
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 5);
+}
+
 } // namespace testing
 } // namespace kuzu
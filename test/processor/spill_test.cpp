@@ -0,0 +1,75 @@
+#include <fstream>
+#include <regex>
+
+#include "common/constants.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class SpillTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    // Runs the query under PROFILE and returns the sum of the given metric over all operators.
+    uint64_t getProfiledMetric(const std::string& query, const std::string& metric) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto plan = result->getNext()->getValue(0)->toString();
+        std::regex pattern{metric + ": ([0-9]+)"};
+        uint64_t total = 0;
+        EXPECT_TRUE(std::regex_search(plan, pattern)) << plan;
+        for (auto it = std::sregex_iterator(plan.begin(), plan.end(), pattern);
+             it != std::sregex_iterator(); ++it) {
+            total += std::stoull((*it)[1].str());
+        }
+        return total;
+    }
+};
+
+TEST_F(SpillTest, HashAggregateSpills) {
+    // 500k groups take more than the share of the 64MB buffer pool each thread may hold.
+    auto query = "UNWIND range(1, 1000000) AS x WITH x % 500000 AS k, count(*) AS c "
+                 "RETURN count(*), sum(c), min(c), max(c)";
+    ASSERT_GT(getProfiledMetric(query, "NumSpilledTuples"), 0);
+    ASSERT_GT(getProfiledMetric(query, "NumSpilledBytes"), 0);
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>{"500000|1000000|2|2"});
+    // Small aggregations stay in memory.
+    ASSERT_EQ(getProfiledMetric("UNWIND range(1, 1000) AS x RETURN x % 10, count(*)",
+                  "NumSpilledTuples"),
+        0);
+}
+
+TEST_F(SpillTest, HashJoinSpills) {
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("UNWIND range(1, 100000) AS x CREATE (:T {id: x, v: (x * 7) % 100000 + 1})")
+            ->isSuccess());
+    auto query = "MATCH (a:T), (b:T) WHERE a.v = b.id RETURN count(*), sum(a.id), sum(b.v)";
+    ASSERT_TRUE(conn->query("CALL hash_join_memory_fraction=0.0")->isSuccess());
+    ASSERT_EQ(getProfiledMetric(query, "NumSpilledBytes"), 0);
+    // 1% of the 64MB buffer pool cannot hold 100k build side tuples.
+    ASSERT_TRUE(conn->query("CALL hash_join_memory_fraction=0.01")->isSuccess());
+    ASSERT_GT(getProfiledMetric(query, "NumSpilledBytes"), 0);
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>{"100000|5000050000|5000050000"});
+}
+
+TEST_F(SpillTest, LeftoverSpillFilesAreRemovedOnOpen) {
+    auto spillFilePath = databasePath + "/aggregate_0" + StorageConstants::SPILL_FILE_SUFFIX;
+    conn.reset();
+    database.reset();
+    std::ofstream{spillFilePath} << "leftover";
+    ASSERT_TRUE(std::filesystem::exists(spillFilePath));
+    createDBAndConn();
+    ASSERT_FALSE(std::filesystem::exists(spillFilePath));
+}
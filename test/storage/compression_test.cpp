@@ -288,3 +288,175 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+TEST(CompressionTests, FloatCompressionTest) {
+    std::vector<double> src(128);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (i - 40.0) / 4;
+    }
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::ALP);
+    EXPECT_EQ(FloatCompression<double>::getExponent(metadata), 2);
+    test_compression(alg, src);
+}
+
+TEST(CompressionTests, FloatCompressionTestFloat) {
+    std::vector<float> src(128);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i / 10.0f;
+    }
+    auto alg = FloatCompression<float>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::ALP);
+    test_compression(alg, src);
+}
+
+TEST(CompressionTests, FloatCompressionUpdateInPlace) {
+    std::vector<double> src{1.5, 2.25, 3.0, 100.75};
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_TRUE(FloatCompression<double>::canUpdateInPlace(50.5, metadata));
+    // Needs a larger exponent.
+    EXPECT_FALSE(FloatCompression<double>::canUpdateInPlace(50.125, metadata));
+    // Needs a larger bit width.
+    EXPECT_FALSE(FloatCompression<double>::canUpdateInPlace(1000000.5, metadata));
+}
+
+TEST(CompressionTests, FloatCompressionNotDecimal) {
+    auto alg = FloatCompression<double>();
+    std::vector<double> src{1.0, 1.0 / 3};
+    EXPECT_EQ(alg.getCompressionMetadata((uint8_t*)src.data(), src.size()).compression,
+        CompressionType::UNCOMPRESSED);
+    src = {1.0, std::numeric_limits<double>::quiet_NaN()};
+    EXPECT_EQ(alg.getCompressionMetadata((uint8_t*)src.data(), src.size()).compression,
+        CompressionType::UNCOMPRESSED);
+    src = {1.0, -0.0};
+    EXPECT_EQ(alg.getCompressionMetadata((uint8_t*)src.data(), src.size()).compression,
+        CompressionType::UNCOMPRESSED);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPage) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i - 5000.0) / 100;
+    }
+    auto alg = FloatCompression<double>();
+    auto pageSize = 4096;
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::DOUBLE));
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        alg.compressNextPage(srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize,
+            metadata);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    std::vector<double> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+}
+
+template<typename T>
+void integerPackingAllBitWidths() {
+    auto alg = IntegerBitpacking<T>();
+    for (auto bitWidth = 1u; bitWidth < sizeof(T) * 8; bitWidth++) {
+        std::vector<T> src(100);
+        auto mask = ((T)1 << bitWidth) - 1;
+        for (auto i = 0u; i < src.size(); i++) {
+            src[i] = (T)(i * 2654435761u) & mask;
+        }
+        src[0] = 0;
+        src[1] = mask;
+        std::vector<uint8_t> dest(4096);
+        auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+        EXPECT_EQ(BitpackHeader::readHeader(metadata.data).bitWidth, bitWidth);
+        const uint8_t* srcCursor = (uint8_t*)src.data();
+        alg.compressNextPage(srcCursor, src.size(), dest.data(), dest.size(), metadata);
+        std::vector<T> decompressed(src.size());
+        alg.decompressFromPage(dest.data(), 0 /*srcOffset*/, (uint8_t*)decompressed.data(),
+            0 /*dstOffset*/, src.size(), metadata);
+        EXPECT_EQ(src, decompressed);
+    }
+}
+
+TEST(CompressionTests, IntegerPackingAllBitWidths32) {
+    integerPackingAllBitWidths<uint32_t>();
+}
+
+TEST(CompressionTests, IntegerPackingAllBitWidths64) {
+    integerPackingAllBitWidths<uint64_t>();
+}
+
+template<typename T>
+void integerPackingFilter(const std::vector<T>& src, const std::vector<T>& literals) {
+    auto alg = IntegerBitpacking<T>();
+    std::vector<uint8_t> dest(4096);
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::INTEGER_BITPACKING);
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), dest.data(), dest.size(), metadata);
+    auto srcOffset = 5u;
+    std::vector<uint8_t> result(src.size() - srcOffset);
+    for (auto comparison : {ExpressionType::EQUALS, ExpressionType::NOT_EQUALS,
+             ExpressionType::GREATER_THAN, ExpressionType::GREATER_THAN_EQUALS,
+             ExpressionType::LESS_THAN, ExpressionType::LESS_THAN_EQUALS}) {
+        for (auto literal : literals) {
+            alg.filterFromPage(dest.data(), srcOffset, result.data(), result.size(), metadata,
+                comparison, literal);
+            for (auto i = 0u; i < result.size(); i++) {
+                auto value = src[srcOffset + i];
+                bool expected = false;
+                switch (comparison) {
+                case ExpressionType::EQUALS:
+                    expected = value == literal;
+                    break;
+                case ExpressionType::NOT_EQUALS:
+                    expected = value != literal;
+                    break;
+                case ExpressionType::GREATER_THAN:
+                    expected = value > literal;
+                    break;
+                case ExpressionType::GREATER_THAN_EQUALS:
+                    expected = value >= literal;
+                    break;
+                case ExpressionType::LESS_THAN:
+                    expected = value < literal;
+                    break;
+                default:
+                    expected = value <= literal;
+                    break;
+                }
+                EXPECT_EQ(result[i], expected);
+            }
+        }
+    }
+}
+
+TEST(CompressionTests, IntegerPackingFilterWithOffset) {
+    std::vector<int64_t> src(100);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1000 + i * 3;
+    }
+    integerPackingFilter<int64_t>(src,
+        {INT64_MIN, 0, 1000, 1001, 1150, 1297, 1300, INT64_MAX});
+}
+
+TEST(CompressionTests, IntegerPackingFilterNegative) {
+    std::vector<int32_t> src(100);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i % 2 == 0 ? -(int32_t)i : (int32_t)i;
+    }
+    integerPackingFilter<int32_t>(src, {INT32_MIN, -98, -3, 0, 3, 50, 99, 100});
+}